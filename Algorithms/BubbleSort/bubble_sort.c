@@ -2,7 +2,7 @@
  * @file bubble_sort.c
  * @author Xuhua Huang (xuhuahuang0412@gmail.com)
  * @brief Demonstration of bubble sort algorithm in C.
- * Time complexity: O(n)
+ * Time complexity: O(n^2), O(n) when the input is already sorted.
  * @version 0.1
  * @date 2021-11-12
  * 
@@ -18,15 +18,18 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
-void bubble_sort(int* arr) {
-    int unsorted_until_index = sizeof(arr) - 1;             /* Minus the extra null character. */
-    printf("Size of the pointer: %d.\n", sizeof(arr));
+void bubble_sort(int* arr, size_t length) {
+    /* An array decays to a pointer when passed, so its length must be passed along. */
+    if (length < 2) {
+        return;
+    }
+    size_t unsorted_until_index = length - 1;
     bool sorted = false;
 
     while (!sorted) {
         sorted = true;
         /* Loop through the rest of the array. */
-        for (int i = 0; i < unsorted_until_index; i++) {
+        for (size_t i = 0; i < unsorted_until_index; i++) {
             /* Compare the elements and determine whether to swap. */
             if (arr[i] > arr[i+1]) {
                 sorted = false;
@@ -44,10 +47,11 @@ void bubble_sort(int* arr) {
 
 int main(void) {
     int to_sort[] = { 65, 55, 45, 35, 25, 15, 10, 5 };
-    printf("Size of the array: %d.\n", sizeof(to_sort)/sizeof(to_sort[0]));
-    bubble_sort(to_sort);
+    const size_t length = sizeof(to_sort)/sizeof(to_sort[0]);
+    printf("Size of the array: %zu.\n", length);
+    bubble_sort(to_sort, length);
 
-    for(int i = 0; i < sizeof(to_sort)/sizeof(to_sort[0]); ++i) {
+    for(size_t i = 0; i < length; ++i) {
         printf("%d ", to_sort[i]);
     }
     printf("\n");
@@ -1,27 +1,33 @@
 /**
  * @file insertion_sort.cpp
  * @author Xuhua Huang (xuhuahuang0412@gmail.com)
- * @brief 
- * @version 0.1
+ * @brief Insertion sort algorithm demonstration in C++.
+ * Time complexity: O(N^2), O(N) when the input is nearly sorted.
+ * The algorithm itself lives in "../Sort/sort.hpp" as
+ * util::algorithm::insertion_sort, generic over iterators, comparators
+ * and projections.
+ *
+ * To compile and run on Windows with Makefile:
+ * $ mingw32-make
+ * $ ./insertionsort
+ *
+ * @version 1.0
  * @date 2021-11-16
  * 
  * @copyright Copyright (c) 2021
  * 
  */
 
+#include <functional>
 #include <iostream>
 #include <stdlib.h>
 #include <vector>
 
-void insertion_sort(std::vector<int>& arr) {
-
-    /* Empty return statement for consistency of the control flow. */
-    return;
-}
+#include "../Sort/sort.hpp"
 
 void print_array(const std::vector<int>& arr) {
     std::cout << "{ ";
-    for (int i = 0; i < arr.size(); ++i) {
+    for (size_t i = 0; i < arr.size(); ++i) {
         std::cout << arr[i] << " ";
     }
     std::cout << "}" << std::endl;
@@ -29,7 +35,21 @@ void print_array(const std::vector<int>& arr) {
 }
 
 int main(void) {
-    
+    std::vector<int> to_sort = { 4, 2, 7, 1, 3, 9 };
+
+    std::cout << "Before sorting: ";
+    print_array(to_sort);
+
+    std::cout << "Sorting in ascending order...\n";
+    util::algorithm::insertion_sort(to_sort);
+    std::cout << "After sorting: ";
+    print_array(to_sort);
+
+    std::cout << "Sorting in descending order...\n";
+    util::algorithm::insertion_sort(to_sort.begin(), to_sort.end(), std::ranges::greater{});
+    std::cout << "After sorting: ";
+    print_array(to_sort);
+
     system("pause");
     return 0;
-}
\ No newline at end of file
+}
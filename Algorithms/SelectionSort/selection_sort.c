@@ -3,7 +3,8 @@
  * @author Xuhua Huang (xuhuahuang0412@gmail.com)
  * @brief Selection sort algorithm implementation and demonstration in C.
  * Time complexity: o(N^2)
- * Caution: facing random poitner glitches. Waiting to implement in C++.
+ * The length is passed explicitly; `sizeof` on a pointer parameter
+ * only yields the size of the pointer itself.
  * 
  * To compile and run on Windows with Makefile:
  * $ mingw32-make
@@ -19,13 +20,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-void selection_sort(int* arr) {
-    int smallest_num_index = 0; /* Suppose the first element of the array is the smallest. */
+void selection_sort(int* arr, size_t length) {
+    size_t smallest_num_index = 0; /* Suppose the first element of the array is the smallest. */
     
-    for (int i = 0; i < sizeof(arr); i++) {
+    for (size_t i = 0; i < length; i++) {
         smallest_num_index = i; /* Update the index during each iteration. */
         /* Loop through the rest of the array. */
-        for (int j = i + 1; j < sizeof(arr); j++) {
+        for (size_t j = i + 1; j < length; j++) {
             if (arr[j] < arr[smallest_num_index]) {
                 smallest_num_index = j;
             }
@@ -45,9 +46,9 @@ void selection_sort(int* arr) {
     return;
 }
 
-void print_array(int* arr) {
+void print_array(int* arr, size_t length) {
     printf("{ ");
-    for (int i = 0; i < sizeof(arr); i++) {
+    for (size_t i = 0; i < length; i++) {
         printf("%d ", arr[i]);
     }
     printf("}\n");
@@ -55,10 +56,11 @@ void print_array(int* arr) {
 
 int main(void) {
     int to_sort[] = { 4, 2, 7, 1, 3 };
-    print_array(to_sort);
+    const size_t length = sizeof(to_sort) / sizeof(to_sort[0]);
+    print_array(to_sort, length);
 
-    selection_sort(to_sort);
-    print_array(to_sort);
+    selection_sort(to_sort, length);
+    print_array(to_sort, length);
 
     system("pause");
     return 0;
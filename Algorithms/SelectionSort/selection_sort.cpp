@@ -3,14 +3,15 @@
  * @author Xuhua Huang (xuhuahuang0412@gmail.com)
  * @brief Selection sort algorithm implementation and demonstration in C++.
  * Time complexity: o(N^2)
- * Thanks to encapsulation of array in C++, this version is working.
- * Implementation in C using raw pointer is facing stack samshing issue.
+ * The algorithm itself lives in "../Sort/sort.hpp" as
+ * util::algorithm::selection_sort, generic over iterators, comparators
+ * and projections; this file demonstrates it on a std::vector<int>.
  * 
  * @version 1.0
  * @date 2021-11-15
  * 
  * To compile and run the file on Windows with g++:
- * $ g++ -o selectionsortcpp selection_sort.cpp
+ * $ g++ -std=c++20 -o selectionsortcpp selection_sort.cpp
  * $ ./selectionsortcpp
  * 
  * @copyright Copyright (c) 2021
@@ -21,28 +22,11 @@
 #include <stdlib.h>
 #include <vector>
 
-void selection_sort(std::vector<int>& arr) {
-    int smallest_num_index = 0;
-    for (int i = 0; i < arr.size(); ++i) {
-        smallest_num_index = i;
-        for (int j = i + 1; j < arr.size(); ++j) {
-            if (arr[j] < arr[smallest_num_index]) {
-                smallest_num_index = j;
-            }
-        }
-        if (smallest_num_index != i) {
-            int temp = arr[i];
-            arr[i] = arr[smallest_num_index];
-            arr[smallest_num_index] = temp;
-        }
-    }
-    /* Empty return statement for consistency of the control flow. */
-    return;
-}
+#include "../Sort/sort.hpp"
 
 void print_array(const std::vector<int>& arr) {
     std::cout << "{ ";
-    for (int i = 0; i < arr.size(); ++i) {
+    for (size_t i = 0; i < arr.size(); ++i) {
         std::cout << arr[i] << " ";
     }
     std::cout << "}" << std::endl;
@@ -56,7 +40,7 @@ int main(void) {
     print_array(to_sort);
 
     std::cout << "Sorting...\n";
-    selection_sort(to_sort);
+    util::algorithm::selection_sort(to_sort);
 
     std::cout << "After sorting: ";
     print_array(to_sort);
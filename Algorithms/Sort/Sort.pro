@@ -0,0 +1,14 @@
+######################################################################
+# Sorting library test cases with QTest framework
+######################################################################
+
+QT += core testlib
+TEMPLATE = app
+TARGET = Sort
+INCLUDEPATH += .
+QMAKE_CXXFLAGS += -std=c++20 -Wall -Wextra -pedantic
+
+# Input
+HEADERS += sort.hpp pdqsort.hpp timsort.hpp selection.hpp parallel_sort.hpp thread_pool.hpp simd_sort.hpp simd_sort_kernels.ipp radix_sort.hpp external_sort.hpp
+SOURCES += qtest_sort.cpp
+LIBS += -pthread
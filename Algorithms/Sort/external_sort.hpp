@@ -0,0 +1,542 @@
+/**
+ * @file external_sort.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief External merge sort of binary files of fixed-size records larger
+ * than the memory available:
+ *
+ *   util::algorithm::external_sort_options options;
+ *   options.memory_budget = 512 << 20;
+ *   auto stats = util::algorithm::external_sort<std::uint64_t>("keys.bin", "sorted.bin", options);
+ *   auto stats = util::algorithm::external_sort<record>("in.bin", "out.bin", options, {}, &record::key);
+ *
+ * 1. Run formation: the input is read in chunks that fill the memory budget,
+ *    each chunk is sorted in memory (radix_sort for plain numeric keys,
+ *    pdq_sort otherwise) and written to a temporary run file. Reading the
+ *    next chunk and writing the previous run overlap with sorting.
+ * 2. Merging: up to `fan_in` runs are merged at once through a loser tree,
+ *    which finds the next record with one comparison per tree level. Every
+ *    run is read, and the output written, through two blocks: one is being
+ *    consumed or filled while the other is in flight on another thread.
+ *    When there are more runs than the fan-in allows, intermediate passes
+ *    merge groups of runs into longer runs first.
+ *
+ * Records must be trivially copyable; they are stored in native byte order.
+ * I/O errors throw std::system_error, a truncated record std::runtime_error.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_EXTERNAL_SORT_HPP
+#define UTIL_ALGORITHM_EXTERNAL_SORT_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "radix_sort.hpp"
+
+namespace util::algorithm {
+
+struct external_sort_options {
+    std::size_t memory_budget = std::size_t{ 256 } << 20;       /* bytes of record buffers */
+    std::filesystem::path temp_directory = std::filesystem::temp_directory_path();
+    std::size_t max_fan_in = 0;                                 /* 0: as many runs as the budget allows */
+};
+
+struct external_sort_stats {
+    std::uint64_t input_bytes = 0;
+    std::uint64_t bytes_read = 0;
+    std::uint64_t bytes_written = 0;
+    std::size_t runs = 0;
+    std::size_t merge_passes = 0;
+    double run_seconds = 0.0;
+    double merge_seconds = 0.0;
+
+    double seconds() const { return run_seconds + merge_seconds; }
+    /* input sorted per second */
+    double input_mb_per_second() const { return static_cast<double>(input_bytes) / seconds() / 1e6; }
+    /* bytes moved to and from the disk per second */
+    double io_mb_per_second() const { return static_cast<double>(bytes_read + bytes_written) / seconds() / 1e6; }
+};
+
+struct disk_bandwidth {
+    double read_mb_per_second = 0.0;
+    double write_mb_per_second = 0.0;
+
+    /**
+     * @brief Upper bound on input_mb_per_second() for a sort that reads and
+     * writes every byte `passes` times with reads and writes not overlapping.
+     */
+    double sort_ceiling(const std::size_t passes) const {
+        return 1.0 / (static_cast<double>(passes) * (1.0 / read_mb_per_second + 1.0 / write_mb_per_second));
+    }
+};
+
+namespace detail::external {
+
+/**
+ * @brief Owning std::FILE* that throws on errors.
+ */
+class file {
+public:
+    file(const std::filesystem::path& path, const char* const mode)
+        : handle_(std::fopen(path.string().c_str(), mode)), path_(path) {
+        if (handle_ == nullptr) {
+            throw std::system_error(errno, std::generic_category(), "cannot open " + path.string());
+        }
+        std::setvbuf(handle_, nullptr, _IONBF, 0);      /* blocks are already large */
+    }
+
+    file(const file&) = delete;
+    file& operator = (const file&) = delete;
+
+    ~file() {
+        if (handle_ != nullptr) {
+            std::fclose(handle_);
+        }
+    }
+
+    std::size_t read(void* data, const std::size_t bytes) {
+        const std::size_t got = std::fread(data, 1, bytes, handle_);
+        if (got < bytes && std::ferror(handle_)) {
+            throw std::system_error(errno, std::generic_category(), "cannot read " + path_.string());
+        }
+        return got;
+    }
+
+    void write(const void* data, const std::size_t bytes) {
+        if (std::fwrite(data, 1, bytes, handle_) != bytes) {
+            throw std::system_error(errno, std::generic_category(), "cannot write " + path_.string());
+        }
+        return;
+    }
+
+    void close() {
+        std::FILE* const handle = std::exchange(handle_, nullptr);
+        if (std::fclose(handle) != 0) {
+            throw std::system_error(errno, std::generic_category(), "cannot close " + path_.string());
+        }
+        return;
+    }
+
+private:
+    std::FILE* handle_;
+    std::filesystem::path path_;
+};
+
+template<typename T>
+std::size_t read_records(file& f, T* data, const std::size_t count) {
+    const std::size_t bytes = f.read(data, count * sizeof(T));
+    if (bytes % sizeof(T) != 0) {
+        throw std::runtime_error("external sort: the input ends in the middle of a record");
+    }
+    return bytes / sizeof(T);
+}
+
+/**
+ * @brief Temporary run files, removed when the sort finishes or fails.
+ */
+class run_files {
+public:
+    explicit run_files(std::filesystem::path directory) : directory_(std::move(directory)) {
+        std::random_device device;
+        prefix_ = "external_sort_" + std::to_string(device()) + "_";
+    }
+
+    run_files(const run_files&) = delete;
+    run_files& operator = (const run_files&) = delete;
+
+    ~run_files() {
+        for (const std::filesystem::path& path : created_) {
+            std::error_code ignored;
+            std::filesystem::remove(path, ignored);
+        }
+    }
+
+    std::filesystem::path next() {
+        created_.push_back(directory_ / (prefix_ + std::to_string(created_.size()) + ".run"));
+        return created_.back();
+    }
+
+    void remove(const std::filesystem::path& path) {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+        return;
+    }
+
+private:
+    std::filesystem::path directory_;
+    std::string prefix_;
+    std::vector<std::filesystem::path> created_;
+};
+
+/**
+ * @brief Sequential reader of a run with the next block always being read.
+ * Not movable: the read in flight refers to it.
+ */
+template<typename T>
+class run_reader {
+public:
+    run_reader(const std::filesystem::path& path, const std::size_t block_records)
+        : file_(path, "rb"), blocks_{ std::vector<T>(block_records), std::vector<T>(block_records) } {
+        pending_ = std::async(std::launch::async, [this]() { return read_records(file_, blocks_[1].data(), blocks_[1].size()); });
+        advance();
+    }
+
+    run_reader(const run_reader&) = delete;
+    run_reader& operator = (const run_reader&) = delete;
+
+    bool empty() const { return head_ == end_; }
+    const T& head() const { return *head_; }
+
+    void pop() {
+        if (++head_ == end_) {
+            advance();
+        }
+        return;
+    }
+
+private:
+    void advance() {
+        const std::size_t size = pending_.get();
+        current_ ^= 1;
+        head_ = blocks_[current_].data();
+        end_ = head_ + size;
+        if (size != 0) {
+            std::vector<T>& next = blocks_[current_ ^ 1];
+            pending_ = std::async(std::launch::async, [this, &next]() { return read_records(file_, next.data(), next.size()); });
+        }
+        return;
+    }
+
+    file file_;
+    std::vector<T> blocks_[2];
+    std::future<std::size_t> pending_;
+    std::size_t current_ = 0;
+    const T* head_ = nullptr;
+    const T* end_ = nullptr;
+};
+
+/**
+ * @brief Sequential writer that fills one block while the other is being written.
+ */
+template<typename T>
+class run_writer {
+public:
+    run_writer(const std::filesystem::path& path, const std::size_t block_records)
+        : file_(path, "wb"), blocks_{ std::vector<T>(block_records), std::vector<T>(block_records) } {}
+
+    run_writer(const run_writer&) = delete;
+    run_writer& operator = (const run_writer&) = delete;
+
+    ~run_writer() {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+    }
+
+    void push(const T& record) {
+        blocks_[current_][size_++] = record;
+        if (size_ == blocks_[current_].size()) {
+            flush();
+        }
+        return;
+    }
+
+    void finish() {
+        if (size_ != 0) {
+            flush();
+        }
+        if (pending_.valid()) {
+            pending_.get();
+        }
+        file_.close();
+        return;
+    }
+
+private:
+    void flush() {
+        if (pending_.valid()) {
+            pending_.get();
+        }
+        const std::vector<T>& block = blocks_[current_];
+        pending_ = std::async(std::launch::async, [this, &block, count = size_]() { file_.write(block.data(), count * sizeof(T)); });
+        current_ ^= 1;
+        size_ = 0;
+        return;
+    }
+
+    file file_;
+    std::vector<T> blocks_[2];
+    std::future<void> pending_;
+    std::size_t current_ = 0;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Tournament tree over k sources that keeps the loser of every match
+ * at the inner node, so replacing the winner replays only its path to the root.
+ * Players carry a pointer to their source's head record, nullptr once it is
+ * exhausted; beats(a, b) tells whether a's head must be output before b's.
+ */
+template<typename T, typename Beats>
+class loser_tree {
+public:
+    struct player {
+        const T* head;
+        std::size_t source;
+    };
+
+    loser_tree(const std::vector<const T*>& heads, Beats beats) : k_(heads.size()), tree_(heads.size()), beats_(std::move(beats)) {
+        std::vector<player> winners(2 * k_);
+        for (std::size_t i = 0; i < k_; ++i) {
+            winners[k_ + i] = player{ heads[i], i };
+        }
+        for (std::size_t node = k_ - 1; node >= 1; --node) {
+            const player& left = winners[2 * node];
+            const player& right = winners[2 * node + 1];
+            const bool left_wins = beats_(left, right);
+            winners[node] = left_wins ? left : right;
+            tree_[node] = left_wins ? right : left;
+        }
+        tree_[0] = winners[1];
+    }
+
+    const player& winner() const { return tree_[0]; }
+
+    /* the winner's source moved on to `head`: play its matches again up to the root */
+    void replace_winner(const T* head) {
+        player candidate{ head, tree_[0].source };
+        for (std::size_t node = (candidate.source + k_) / 2; node >= 1; node /= 2) {
+            /* selects rather than branches: the outcome of a match is unpredictable */
+            const player other = tree_[node];
+            const bool other_wins = beats_(other, candidate);
+            tree_[node] = other_wins ? candidate : other;
+            candidate = other_wins ? other : candidate;
+        }
+        tree_[0] = candidate;
+        return;
+    }
+
+private:
+    std::size_t k_;
+    std::vector<player> tree_;
+    Beats beats_;
+};
+
+/**
+ * @brief Merge sorted runs into `output` with a loser tree.
+ */
+template<typename T, typename Comp, typename Proj>
+void merge_runs(const std::vector<std::filesystem::path>& runs, const std::filesystem::path& output,
+                const std::size_t block_records, Comp& comp, Proj& proj) {
+    std::vector<std::unique_ptr<run_reader<T>>> readers;
+    std::vector<const T*> heads;
+    for (const std::filesystem::path& run : runs) {
+        readers.push_back(std::make_unique<run_reader<T>>(run, block_records));
+        heads.push_back(readers.back()->empty() ? nullptr : &readers.back()->head());
+    }
+    /* exhausted runs lose every match; ties go to the earlier run, which keeps the merge stable */
+    const auto beats = [&comp, &proj](const auto& a, const auto& b) {
+        if (a.head == nullptr || b.head == nullptr) {
+            return b.head == nullptr && a.head != nullptr;
+        }
+        const auto& ka = std::invoke(proj, *a.head);
+        const auto& kb = std::invoke(proj, *b.head);
+        return std::invoke(comp, ka, kb) || (a.source < b.source && !std::invoke(comp, kb, ka));
+    };
+    loser_tree<T, decltype(beats)> tree(heads, beats);
+    run_writer<T> writer(output, block_records);
+    while (tree.winner().head != nullptr) {
+        run_reader<T>& reader = *readers[tree.winner().source];
+        writer.push(reader.head());
+        reader.pop();
+        tree.replace_winner(reader.empty() ? nullptr : &reader.head());
+    }
+    writer.finish();
+    return;
+}
+
+template<typename T, typename Comp, typename Proj>
+inline constexpr bool use_radix = radix_key<T> && std::same_as<Comp, std::ranges::less> && std::same_as<Proj, std::identity>;
+
+template<typename T, typename Comp, typename Proj>
+void sort_chunk(std::vector<T>& chunk, const std::size_t count, Comp& comp, Proj& proj) {
+    if constexpr (use_radix<T, Comp, Proj>) {
+        radix_sort(std::span<T>(chunk.data(), count));
+    }
+    else {
+        pdq_sort(chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(count), comp, proj);
+    }
+    return;
+}
+
+inline double seconds_since(const std::chrono::steady_clock::time_point begin) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+} // util::algorithm::detail::external
+
+/**
+ * @brief Sort the records of `input` into `output`, using about
+ * options.memory_budget bytes of memory and temporary files in options.temp_directory.
+ * @return bytes moved and time spent in each phase
+ */
+template<typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+requires std::is_trivially_copyable_v<T> && std::sortable<T*, Comp, Proj>
+external_sort_stats external_sort(const std::filesystem::path& input, const std::filesystem::path& output,
+                                  const external_sort_options& options = {}, Comp comp = {}, Proj proj = {}) {
+    namespace ext = detail::external;
+    external_sort_stats stats;
+    ext::run_files temporaries(options.temp_directory);
+    std::vector<std::filesystem::path> runs;
+
+    /* 1. three chunks in rotation: one being read, one sorted, one written;
+     * radix sort needs a fourth as scratch space */
+    const std::size_t chunks_in_memory = ext::use_radix<T, Comp, Proj> ? 4 : 3;
+    const std::size_t chunk_records = std::max<std::size_t>(options.memory_budget / chunks_in_memory / sizeof(T), 1);
+    auto begin = std::chrono::steady_clock::now();
+    {
+        ext::file in(input, "rb");
+        std::vector<T> chunks[3] = { std::vector<T>(chunk_records), std::vector<T>(chunk_records), std::vector<T>(chunk_records) };
+        std::future<std::size_t> reading = std::async(std::launch::async, [&]() {
+            return ext::read_records(in, chunks[0].data(), chunk_records);
+        });
+        std::future<void> writing;
+        for (std::size_t i = 0; ; ++i) {
+            std::vector<T>& chunk = chunks[i % 3];
+            const std::size_t count = reading.get();
+            if (count == 0) {
+                break;
+            }
+            stats.bytes_read += count * sizeof(T);
+            std::vector<T>& next = chunks[(i + 1) % 3];      /* its write finished during the last round */
+            reading = std::async(std::launch::async, [&in, &next, chunk_records]() {
+                return ext::read_records(in, next.data(), chunk_records);
+            });
+
+            ext::sort_chunk(chunk, count, comp, proj);
+
+            if (writing.valid()) {
+                writing.get();
+            }
+            /* a single chunk is the whole input: write it straight to the output */
+            const bool only_chunk = i == 0 && count < chunk_records;
+            runs.push_back(only_chunk ? output : temporaries.next());
+            writing = std::async(std::launch::async, [&chunk, count, path = runs.back()]() {
+                ext::file out(path, "wb");
+                out.write(chunk.data(), count * sizeof(T));
+                out.close();
+            });
+            stats.bytes_written += count * sizeof(T);
+        }
+        if (writing.valid()) {
+            writing.get();
+        }
+    }
+    stats.input_bytes = stats.bytes_read;
+    stats.runs = runs.size();
+    stats.run_seconds = ext::seconds_since(begin);
+
+    /* 2. merge passes; each run is read through two blocks, and so is the output written */
+    begin = std::chrono::steady_clock::now();
+    if (runs.empty()) {
+        ext::file(output, "wb").close();
+    }
+    const std::size_t min_block_bytes = std::clamp<std::size_t>(options.memory_budget / 256, sizeof(T), std::size_t{ 1 } << 20);
+    std::size_t fan_in = std::max<std::size_t>(options.memory_budget / (2 * min_block_bytes), 3) - 1;
+    if (options.max_fan_in >= 2) {
+        fan_in = std::min(fan_in, options.max_fan_in);
+    }
+    while (runs.size() > 1) {
+        const bool last_pass = runs.size() <= fan_in;
+        const std::size_t group_size = last_pass ? runs.size() : fan_in;
+        const std::size_t block_records = std::max<std::size_t>(options.memory_budget / (2 * (group_size + 1)) / sizeof(T), 1);
+        std::vector<std::filesystem::path> merged;
+        for (std::size_t first = 0; first < runs.size(); first += group_size) {
+            const std::vector<std::filesystem::path> group(runs.begin() + static_cast<std::ptrdiff_t>(first),
+                runs.begin() + static_cast<std::ptrdiff_t>(std::min(first + group_size, runs.size())));
+            if (group.size() == 1) {
+                merged.push_back(group.front());       /* carried over to the next pass */
+                continue;
+            }
+            merged.push_back(last_pass ? output : temporaries.next());
+            ext::merge_runs<T>(group, merged.back(), block_records, comp, proj);
+            for (const std::filesystem::path& run : group) {
+                temporaries.remove(run);
+            }
+            const std::uint64_t bytes = std::filesystem::file_size(merged.back());
+            stats.bytes_read += bytes;
+            stats.bytes_written += bytes;
+        }
+        ++stats.merge_passes;
+        runs = std::move(merged);
+    }
+    /* the input filled exactly one chunk, so its run went to a temporary file */
+    if (runs.size() == 1 && runs.front() != output) {
+        std::error_code error;
+        std::filesystem::rename(runs.front(), output, error);
+        if (error) {
+            std::filesystem::copy_file(runs.front(), output, std::filesystem::copy_options::overwrite_existing);
+        }
+    }
+    stats.merge_seconds = ext::seconds_since(begin);
+    return stats;
+}
+
+/**
+ * @brief Sequential write then read speed of `bytes` in `directory`, through the
+ * same buffered file I/O as the sort, as a ceiling for its throughput. The data
+ * may stay in the page cache, which a sort of the same size would also benefit from.
+ */
+inline disk_bandwidth probe_disk_bandwidth(const std::filesystem::path& directory, const std::uint64_t bytes) {
+    namespace ext = detail::external;
+    constexpr std::size_t block = std::size_t{ 1 } << 20;
+    std::vector<char> data(block, 'x');
+    ext::run_files temporaries(directory);
+    const std::filesystem::path path = temporaries.next();
+    disk_bandwidth result;
+
+    auto begin = std::chrono::steady_clock::now();
+    {
+        ext::file out(path, "wb");
+        for (std::uint64_t written = 0; written < bytes; written += block) {
+            out.write(data.data(), block);
+        }
+        out.close();
+    }
+    const std::uint64_t total = (bytes + block - 1) / block * block;
+    result.write_mb_per_second = static_cast<double>(total) / ext::seconds_since(begin) / 1e6;
+
+    begin = std::chrono::steady_clock::now();
+    {
+        ext::file in(path, "rb");
+        while (in.read(data.data(), block) == block) {}
+    }
+    result.read_mb_per_second = static_cast<double>(total) / ext::seconds_since(begin) / 1e6;
+    return result;
+}
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_EXTERNAL_SORT_HPP
@@ -0,0 +1,129 @@
+/**
+ * @file external_sort_bench.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief External sort of a file of random 64-bit keys, and of 64-byte
+ * records, several times larger than the memory budget, with its throughput
+ * compared to the sequential bandwidth of the disk holding the files.
+ *
+ * To compile and run on Linux with Makefile:
+ * $ make externalsortbench
+ * $ ./externalsortbench [file_megabytes] [budget_megabytes] [directory]
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "external_sort.hpp"
+
+namespace {
+
+struct record {
+    std::uint64_t key;
+    char payload[56];
+};
+
+/* write `bytes` of random records to `path` */
+template<typename T>
+void generate(const std::filesystem::path& path, const std::uint64_t bytes) {
+    std::mt19937_64 engine(2021);
+    std::vector<T> block((std::size_t{ 1 } << 20) / sizeof(T));
+    std::FILE* const file = std::fopen(path.string().c_str(), "wb");
+    for (std::uint64_t written = 0; written < bytes; written += block.size() * sizeof(T)) {
+        for (T& value : block) {
+            if constexpr (std::is_same_v<T, record>) {
+                value.key = engine();
+            }
+            else {
+                value = static_cast<T>(engine());
+            }
+        }
+        std::fwrite(block.data(), sizeof(T), block.size(), file);
+    }
+    std::fclose(file);
+}
+
+/* whether `path` holds `bytes` of records in order of `key_of` */
+template<typename T, typename KeyOf>
+bool is_sorted_file(const std::filesystem::path& path, const std::uint64_t bytes, KeyOf key_of) {
+    if (std::filesystem::file_size(path) != bytes) {
+        return false;
+    }
+    std::vector<T> block((std::size_t{ 1 } << 20) / sizeof(T));
+    std::FILE* const file = std::fopen(path.string().c_str(), "rb");
+    bool sorted = true;
+    bool first = true;
+    std::uint64_t previous = 0;
+    for (std::size_t count; sorted && (count = std::fread(block.data(), sizeof(T), block.size(), file)) != 0;) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint64_t key = key_of(block[i]);
+            sorted = sorted && (first || previous <= key);
+            previous = key;
+            first = false;
+        }
+    }
+    std::fclose(file);
+    return sorted;
+}
+
+void report(const char* const name, const util::algorithm::external_sort_stats& stats,
+            const util::algorithm::disk_bandwidth& disk) {
+    const std::size_t passes = 1 + stats.merge_passes;
+    const double ceiling = disk.sort_ceiling(passes);
+    std::printf("%-8s %6zu runs %2zu merge pass(es) %7.2f s (runs %.2f s, merge %.2f s)\n",
+        name, stats.runs, stats.merge_passes, stats.seconds(), stats.run_seconds, stats.merge_seconds);
+    std::printf("         input %8.1f MB/s, disk I/O %8.1f MB/s; ceiling for %zu pass(es) %8.1f MB/s (%.0f%%)\n",
+        stats.input_mb_per_second(), stats.io_mb_per_second(), passes, ceiling,
+        100.0 * stats.input_mb_per_second() / ceiling);
+}
+
+template<typename T, typename KeyOf, typename... SortArgs>
+void bench(const char* const name, const std::filesystem::path& directory, const std::uint64_t bytes,
+           const util::algorithm::external_sort_options& options, const util::algorithm::disk_bandwidth& disk,
+           KeyOf key_of, SortArgs... sort_args) {
+    const std::filesystem::path input = directory / ("external_sort_bench_" + std::string(name) + ".in");
+    const std::filesystem::path output = directory / ("external_sort_bench_" + std::string(name) + ".out");
+    generate<T>(input, bytes);
+    const util::algorithm::external_sort_stats stats = util::algorithm::external_sort<T>(input, output, options, sort_args...);
+    if (!is_sorted_file<T>(output, std::filesystem::file_size(input), key_of)) {
+        std::fprintf(stderr, "%s: output is not sorted\n", name);
+        std::exit(EXIT_FAILURE);
+    }
+    report(name, stats, disk);
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t megabytes = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1024;
+    const std::uint64_t budget = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 64;
+    const std::filesystem::path directory = (argc > 3) ? std::filesystem::path(argv[3]) : std::filesystem::temp_directory_path();
+
+    util::algorithm::external_sort_options options;
+    options.memory_budget = budget << 20;
+    options.temp_directory = directory;
+
+    /* measured on a file as large as the input, so it sees the same page cache effects */
+    const util::algorithm::disk_bandwidth disk = util::algorithm::probe_disk_bandwidth(directory, megabytes << 20);
+    std::printf("%llu MB in %s with a %llu MB budget\n", static_cast<unsigned long long>(megabytes),
+        directory.string().c_str(), static_cast<unsigned long long>(budget));
+    std::printf("sequential read %.1f MB/s, write %.1f MB/s\n\n", disk.read_mb_per_second, disk.write_mb_per_second);
+
+    bench<std::uint64_t>("uint64", directory, megabytes << 20, options, disk,
+        [](const std::uint64_t key) { return key; });
+    bench<record>("record", directory, megabytes << 20, options, disk,
+        [](const record& r) { return r.key; }, std::ranges::less{}, &record::key);
+    return 0;
+}
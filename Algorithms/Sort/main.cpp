@@ -0,0 +1,68 @@
+/**
+ * @file main.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Demonstration of the generic sorting library on record types.
+ *
+ * To compile and run on Windows with Makefile:
+ * $ mingw32-make
+ * $ ./sortdemo
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <functional>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "sort.hpp"
+
+struct person {
+    std::string name;
+    int age;
+};
+
+void print_people(const std::vector<person>& people) {
+    std::cout << "{ ";
+    for (const person& p : people) {
+        std::cout << p.name << "(" << p.age << ") ";
+    }
+    std::cout << "}" << std::endl;
+    return;
+}
+
+int main(void) {
+    const std::vector<person> people = {
+        { "Jacob", 40 }, { "Andy", 20 }, { "Liam", 34 }, { "Emma", 20 }, { "Olivia", 28 },
+    };
+    print_people(people);
+
+    /* sort by age through a projection; insertion sort is stable, Andy stays before Emma */
+    std::vector<person> by_age = people;
+    util::algorithm::insertion_sort(by_age, {}, &person::age);
+    std::cout << "Insertion sort by age: ";
+    print_people(by_age);
+
+    /* sort by name in descending order with a comparator and a projection */
+    std::vector<person> by_name = people;
+    util::algorithm::selection_sort(by_name.begin(), by_name.end(), std::ranges::greater{}, &person::name);
+    std::cout << "Selection sort by name, descending: ";
+    print_people(by_name);
+
+    /* sort a plain C array with the default comparator */
+    int numbers[] = { 65, 55, 45, 35, 25, 15, 10, 5 };
+    util::algorithm::bubble_sort(numbers);
+    std::cout << "Bubble sort of a C array: { ";
+    for (int n : numbers) {
+        std::cout << n << " ";
+    }
+    std::cout << "}" << std::endl;
+
+    system("pause");
+    return 0;
+}
@@ -0,0 +1,339 @@
+/**
+ * @file parallel_sort.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Parallel sample sort on the work-stealing thread pool:
+ *
+ *   util::algorithm::parallel_sort(values);                    // thread_pool::shared()
+ *   util::algorithm::parallel_sort(pool, values, std::ranges::greater{}, &record::key);
+ *
+ * 1. pick bucket boundaries (splitters) from a sorted random sample;
+ * 2. in parallel blocks, find each element's bucket and count bucket sizes;
+ * 3. move every block's elements straight to their bucket in a scratch buffer;
+ * 4. sort the buckets as independent tasks, largest first, with pdq_sort;
+ * 5. move the buckets back in parallel blocks.
+ *
+ * Every step is a parallel pass over the data, so there is no sequential
+ * partitioning step at the top as in a parallel quicksort, and the speedup is
+ * bounded by memory bandwidth rather than by the span of the algorithm.
+ * When the sample shows a key repeated over several splitters, elements equal
+ * to a splitter go to an "equality bucket" that needs no sorting, so inputs
+ * with few distinct keys do not end up in one oversized bucket.
+ *
+ * Uses n elements of scratch space plus one byte per element. Not stable.
+ * A comparator or a move that throws leaves the range holding an unspecified
+ * permutation of its elements: whatever is in the scratch space is moved back.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_PARALLEL_SORT_HPP
+#define UTIL_ALGORITHM_PARALLEL_SORT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "sort.hpp"
+#include "thread_pool.hpp"
+
+namespace util::algorithm {
+
+namespace detail::parallel {
+
+inline constexpr std::ptrdiff_t sequential_threshold = 1 << 16;
+inline constexpr std::size_t max_buckets = 128;       /* with equality buckets, ids fit in a byte */
+inline constexpr std::size_t oversampling = 32;
+inline constexpr std::size_t blocks_per_thread = 4;
+
+/**
+ * @brief Call fn(block) for every block in [0, count), block 0 on the calling thread.
+ */
+template<typename F>
+void for_each_block(thread_pool& pool, const std::size_t count, F fn) {
+    task_group group(pool);
+    for (std::size_t block = 1; block < count; ++block) {
+        group.run([&fn, block]() { fn(block); });
+    }
+    fn(std::size_t{ 0 });
+    group.wait();
+    return;
+}
+
+/**
+ * @brief The scratch space of one sample sort. It moves the elements of
+ * [first, last) in by blocks (step 3) and back out by blocks (step 5), and
+ * records how far each block got, so that if a comparator or a move throws,
+ * the destructor moves every element still in the space back into the range
+ * before freeing it. A move that throws again while doing so terminates.
+ */
+template<std::random_access_iterator I>
+class scratch_space {
+public:
+    using value_type = std::iter_value_t<I>;
+
+    /* bounds: where each block of [first, first + bounds.back()) starts, then its end; ids: the bucket of every element */
+    scratch_space(const I first, std::vector<std::ptrdiff_t> bounds, const std::uint8_t* const ids)
+        : first_(first), bounds_(std::move(bounds)), ids_(ids), done_(bounds_.size() - 1, 0),
+          data_(allocator_.allocate(size())) {}
+
+    scratch_space(const scratch_space&) = delete;
+    scratch_space& operator = (const scratch_space&) = delete;
+
+    ~scratch_space() {
+        restore();
+        allocator_.deallocate(data_, size());
+    }
+
+    value_type* data() const { return data_; }
+
+    /* offsets: block-major, where each block writes the first element of each bucket */
+    void begin_scatter(std::vector<std::size_t> offsets, const std::size_t bucket_count) {
+        offsets_ = std::move(offsets);
+        bucket_count_ = bucket_count;
+        phase_ = phase::scattering;
+        return;
+    }
+
+    /* step 3 for one block: move its elements next to the others of their bucket */
+    void scatter(const std::size_t block) {
+        std::vector<std::size_t> offset(offsets_.begin() + block * bucket_count_, offsets_.begin() + (block + 1) * bucket_count_);
+        const std::ptrdiff_t begin = bounds_[block], end = bounds_[block + 1];
+        std::ptrdiff_t i = begin;
+        try {
+            for (; i < end; ++i) {
+                std::construct_at(data_ + offset[ids_[static_cast<std::size_t>(i)]]++, std::ranges::iter_move(first_ + i));
+            }
+        }
+        catch (...) {
+            done_[block] = i - begin;
+            throw;
+        }
+        done_[block] = end - begin;
+        return;
+    }
+
+    /* after step 3: every element is in the space, sorted in place by step 4 */
+    void end_scatter() {
+        std::ranges::fill(done_, 0);
+        phase_ = phase::sorting;
+        return;
+    }
+
+    /* step 5 for one block: move back the elements at the same positions */
+    void gather(const std::size_t block) {
+        const std::ptrdiff_t begin = bounds_[block], end = bounds_[block + 1];
+        std::ptrdiff_t i = begin;
+        try {
+            for (; i < end; ++i) {
+                first_[i] = std::move(data_[i]);
+                std::destroy_at(data_ + i);
+            }
+        }
+        catch (...) {
+            done_[block] = i - begin;
+            throw;
+        }
+        done_[block] = end - begin;
+        return;
+    }
+
+private:
+    enum class phase { empty, scattering, sorting };
+
+    std::size_t size() const { return static_cast<std::size_t>(bounds_.back()); }
+
+    /* move back what is still in the space, replaying step 3 to find where a partly scattered block went */
+    void restore() {
+        for (std::size_t block = 0; block + 1 < bounds_.size(); ++block) {
+            const std::ptrdiff_t begin = bounds_[block], end = bounds_[block + 1];
+            if (phase_ == phase::scattering) {
+                std::vector<std::size_t> offset(offsets_.begin() + block * bucket_count_, offsets_.begin() + (block + 1) * bucket_count_);
+                for (std::ptrdiff_t i = begin; i < begin + done_[block]; ++i) {
+                    value_type* const element = data_ + offset[ids_[static_cast<std::size_t>(i)]]++;
+                    first_[i] = std::move(*element);
+                    std::destroy_at(element);
+                }
+            }
+            else if (phase_ == phase::sorting) {
+                for (std::ptrdiff_t i = begin + done_[block]; i < end; ++i) {
+                    first_[i] = std::move(data_[i]);
+                    std::destroy_at(data_ + i);
+                }
+            }
+        }
+        return;
+    }
+
+    I first_;
+    std::vector<std::ptrdiff_t> bounds_;
+    const std::uint8_t* ids_;
+    std::vector<std::ptrdiff_t> done_;      /* elements of each block scattered, or gathered once sorting */
+    std::vector<std::size_t> offsets_;
+    std::size_t bucket_count_ = 0;
+    phase phase_ = phase::empty;
+    std::allocator<value_type> allocator_;
+    value_type* data_;
+};
+
+template<std::random_access_iterator I, typename Less>
+void sample_sort(thread_pool& pool, const I first, const I last, Less less) {
+    using value_type = std::iter_value_t<I>;
+    const std::ptrdiff_t n = last - first;
+    const std::size_t threads = pool.size();
+    if (n < sequential_threshold || threads == 1) {
+        pdq_sort_fn::sort(first, last, less);
+        return;
+    }
+
+    /* 1. splitters, as iterators into the input, which stays in place until step 5 */
+    const std::size_t bucket_target = std::min(max_buckets, std::bit_ceil(threads * blocks_per_thread));
+    std::vector<I> sample(bucket_target * oversampling);
+    std::mt19937_64 engine(static_cast<std::uint64_t>(n));
+    for (I& it : sample) {
+        it = first + static_cast<std::ptrdiff_t>(engine() % static_cast<std::uint64_t>(n));
+    }
+    const auto less_at = [&less](const I lhs, const I rhs) { return less(*lhs, *rhs); };
+    pdq_sort(sample, less_at);
+    std::vector<I> splitters;
+    for (std::size_t i = 1; i < bucket_target; ++i) {
+        const I candidate = sample[i * oversampling];
+        if (splitters.empty() || less(*splitters.back(), *candidate)) {
+            splitters.push_back(candidate);
+        }
+    }
+    const bool equality_buckets = splitters.size() + 1 < bucket_target;
+    const std::size_t bucket_count = equality_buckets ? 2 * splitters.size() + 1 : splitters.size() + 1;
+
+    /* bucket j holds the elements between splitters j - 1 and j; with equality
+     * buckets, 2j holds those strictly between and 2j - 1 those equal to splitter j - 1 */
+    const auto bucket_of = [&](const auto& value) -> std::uint8_t {
+        const std::size_t j = static_cast<std::size_t>(std::upper_bound(splitters.begin(), splitters.end(), value,
+            [&less](const auto& lhs, const I rhs) { return less(lhs, *rhs); }) - splitters.begin());
+        if (!equality_buckets) {
+            return static_cast<std::uint8_t>(j);
+        }
+        return static_cast<std::uint8_t>(j > 0 && !less(*splitters[j - 1], value) ? 2 * j - 1 : 2 * j);
+    };
+
+    /* 2. classify and count per block */
+    const std::size_t block_count = threads * blocks_per_thread;
+    const auto block_begin = [n, block_count](const std::size_t block) {
+        return static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n) * block / block_count);
+    };
+    const std::unique_ptr<std::uint8_t[]> ids = std::make_unique_for_overwrite<std::uint8_t[]>(static_cast<std::size_t>(n));
+    std::vector<std::size_t> counts(block_count * bucket_count, 0);
+    for_each_block(pool, block_count, [&](const std::size_t block) {
+        std::size_t* const count = counts.data() + block * bucket_count;
+        for (std::ptrdiff_t i = block_begin(block), end = block_begin(block + 1); i < end; ++i) {
+            const std::uint8_t id = bucket_of(first[i]);
+            ids[static_cast<std::size_t>(i)] = id;
+            ++count[id];
+        }
+    });
+
+    /* bucket-major prefix sums: where each block writes into each bucket */
+    std::vector<std::size_t> bucket_begin(bucket_count + 1, 0);
+    std::vector<std::size_t> offsets(block_count * bucket_count);
+    std::size_t position = 0;
+    for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        bucket_begin[bucket] = position;
+        for (std::size_t block = 0; block < block_count; ++block) {
+            offsets[block * bucket_count + bucket] = position;
+            position += counts[block * bucket_count + bucket];
+        }
+    }
+    bucket_begin[bucket_count] = position;
+
+    /* 3. scatter into uninitialised scratch space */
+    std::vector<std::ptrdiff_t> bounds(block_count + 1);
+    for (std::size_t block = 0; block <= block_count; ++block) {
+        bounds[block] = block_begin(block);
+    }
+    scratch_space<I> scratch(first, std::move(bounds), ids.get());
+    value_type* const buffer = scratch.data();
+    scratch.begin_scatter(std::move(offsets), bucket_count);
+    for_each_block(pool, block_count, [&scratch](const std::size_t block) { scratch.scatter(block); });
+    scratch.end_scatter();
+
+    /* 4. sort the buckets, largest first so the tail of the schedule is short */
+    std::vector<std::size_t> order;
+    for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        const bool is_equality_bucket = equality_buckets && bucket % 2 == 1;
+        if (!is_equality_bucket && bucket_begin[bucket + 1] - bucket_begin[bucket] > 1) {
+            order.push_back(bucket);
+        }
+    }
+    std::ranges::sort(order, std::ranges::greater{}, [&bucket_begin](const std::size_t bucket) {
+        return bucket_begin[bucket + 1] - bucket_begin[bucket];
+    });
+    {
+        task_group group(pool);
+        for (const std::size_t bucket : order) {
+            group.run([&, bucket]() {
+                value_type* const bucket_first = buffer + bucket_begin[bucket];
+                value_type* const bucket_last = buffer + bucket_begin[bucket + 1];
+                /* an unlucky sample: split the oversized bucket again */
+                if (bucket_last - bucket_first > 2 * n / static_cast<std::ptrdiff_t>(threads) && bucket_last - bucket_first < n) {
+                    sample_sort(pool, bucket_first, bucket_last, less);
+                }
+                else {
+                    pdq_sort_fn::sort(bucket_first, bucket_last, less);
+                }
+            });
+        }
+        group.wait();
+    }
+
+    /* 5. move back */
+    for_each_block(pool, block_count, [&scratch](const std::size_t block) { scratch.gather(block); });
+    return;
+}
+
+} // util::algorithm::detail::parallel
+
+/**
+ * @brief Parallel sample sort. Without a pool argument it runs on thread_pool::shared().
+ */
+struct parallel_sort_fn : detail::sort_fn_base<parallel_sort_fn> {
+    using detail::sort_fn_base<parallel_sort_fn>::operator ();
+
+    template<std::random_access_iterator I, std::sentinel_for<I> S,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<I, Comp, Proj>
+    I operator () (thread_pool& pool, I first, S last, Comp comp = {}, Proj proj = {}) const {
+        I last_it = std::ranges::next(first, last);
+        detail::parallel::sample_sort(pool, first, last_it, detail::projected_less{ comp, proj });
+        return last_it;
+    }
+
+    template<std::ranges::random_access_range R,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+    std::ranges::borrowed_iterator_t<R> operator () (thread_pool& pool, R&& r, Comp comp = {}, Proj proj = {}) const {
+        return (*this)(pool, std::ranges::begin(r), std::ranges::end(r), std::move(comp), std::move(proj));
+    }
+
+    template<std::random_access_iterator I, typename Less>
+    static void sort(I first, I last, Less less) {
+        detail::parallel::sample_sort(thread_pool::shared(), first, last, less);
+        return;
+    }
+};
+
+inline constexpr parallel_sort_fn parallel_sort{};
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_PARALLEL_SORT_HPP
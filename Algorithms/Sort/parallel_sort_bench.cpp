@@ -0,0 +1,78 @@
+/**
+ * @file parallel_sort_bench.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Speedup of parallel_sort over the sequential pdq_sort for growing thread counts.
+ *
+ * To compile and run on Linux with Makefile:
+ * $ make parallelsortbench
+ * $ ./parallelsortbench [element_count] [max_threads]
+ *
+ * The scratch buffer doubles the memory footprint: 1e9 64-bit keys need
+ * about 17 GB.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "parallel_sort.hpp"
+#include "pdqsort.hpp"
+
+namespace {
+
+template<typename Sorter>
+double time_sort(const std::vector<std::uint64_t>& input, Sorter sorter) {
+    std::vector<std::uint64_t> values = input;
+    const auto begin = std::chrono::steady_clock::now();
+    sorter(values);
+    const auto end = std::chrono::steady_clock::now();
+    if (!std::ranges::is_sorted(values)) {
+        std::fprintf(stderr, "output is not sorted\n");
+        std::exit(EXIT_FAILURE);
+    }
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 50000000;
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t max_threads = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : hardware;
+
+    std::vector<std::uint64_t> input(count);
+    std::mt19937_64 engine(2021);
+    std::ranges::generate(input, [&]() { return engine(); });
+
+    const double sequential = time_sort(input, [](std::vector<std::uint64_t>& v) { util::algorithm::pdq_sort(v); });
+    std::printf("%zu random 64-bit keys, %zu hardware threads\n", count, hardware);
+    std::printf("%-10s %10.3f s\n", "pdq_sort", sequential);
+
+    std::vector<std::size_t> thread_counts;
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::printf("%-10s %10s %9s %11s\n", "threads", "seconds", "speedup", "efficiency");
+    for (const std::size_t threads : thread_counts) {
+        util::algorithm::thread_pool pool(threads);
+        const double seconds = time_sort(input, [&pool](std::vector<std::uint64_t>& v) {
+            util::algorithm::parallel_sort(pool, v);
+        });
+        const double speedup = sequential / seconds;
+        std::printf("%-10zu %10.3f %8.2fx %10.1f%%\n", threads, seconds, speedup, 100.0 * speedup / (double)threads);
+    }
+    return 0;
+}
@@ -0,0 +1,430 @@
+/**
+ * @file pdqsort.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Pattern-defeating quicksort, an introsort that recognises the
+ * inputs quicksort is usually bad at:
+ *
+ *   util::algorithm::pdq_sort(records);
+ *   util::algorithm::pdq_sort(records, std::ranges::greater{}, &record::age);
+ *
+ * - partitions shorter than 24 elements go to insertion sort;
+ * - the pivot is a median of three, or a pseudo-median of nine (ninther)
+ *   for partitions longer than 128 elements;
+ * - a partition equal to the pivot of its parent is split into "equal" and
+ *   "greater" in one pass, so inputs with few distinct keys take O(n k);
+ * - a partition that needed no swap is probed with a bounded insertion
+ *   sort, so sorted and reverse-sorted runs finish in O(n);
+ * - every highly unbalanced partition shuffles a few elements to break the
+ *   pattern, and after log2(n) of them the remainder falls back to
+ *   heap_sort, bounding the worst case to O(n log n);
+ * - arithmetic keys compared with the default comparators are partitioned
+ *   in blocks of 64 without a data-dependent branch (BlockQuicksort).
+ *
+ * Not stable. A comparator that throws leaves the range holding a permutation
+ * of its elements. Reference: Orson Peters, "Pattern-defeating Quicksort", 2021.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_PDQSORT_HPP
+#define UTIL_ALGORITHM_PDQSORT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "sort.hpp"
+
+namespace util::algorithm {
+
+namespace detail::pdq {
+
+inline constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+inline constexpr std::ptrdiff_t ninther_threshold = 128;
+inline constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
+inline constexpr std::ptrdiff_t block_size = 64;
+
+template<typename Comp>
+inline constexpr bool is_default_compare = false;
+template<> inline constexpr bool is_default_compare<std::ranges::less> = true;
+template<> inline constexpr bool is_default_compare<std::ranges::greater> = true;
+template<typename T> inline constexpr bool is_default_compare<std::less<T>> = true;
+template<typename T> inline constexpr bool is_default_compare<std::greater<T>> = true;
+
+/**
+ * @brief Whether comparing elements of I through Less is cheap and free of side effects,
+ * so that evaluating every comparison of a block up front costs nothing.
+ */
+template<typename I, typename Less>
+inline constexpr bool use_branchless = false;
+
+template<typename I, typename Comp, typename Proj>
+inline constexpr bool use_branchless<I, projected_less<Comp, Proj>> =
+    is_default_compare<std::remove_cv_t<Comp>>
+    && std::is_arithmetic_v<std::remove_cvref_t<std::indirect_result_t<Proj&, I>>>;
+
+template<std::random_access_iterator I, typename Less>
+constexpr void sort2(I a, I b, Less& less) {
+    if (less(*b, *a)) {
+        std::ranges::iter_swap(a, b);
+    }
+    return;
+}
+
+/* sort *a, *b and *c */
+template<std::random_access_iterator I, typename Less>
+constexpr void sort3(I a, I b, I c, Less& less) {
+    sort2(a, b, less);
+    sort2(b, c, less);
+    sort2(a, b, less);
+    return;
+}
+
+/**
+ * @brief Insertion sort that gives up after moving partial_insertion_sort_limit elements.
+ * @return bool -> true if [first, last) ended up sorted
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr bool partial_insertion_sort(I first, I last, Less& less) {
+    if (first == last) {
+        return true;
+    }
+    std::ptrdiff_t moved = 0;
+    for (I i = first + 1; i != last; ++i) {
+        if (!less(*i, *(i - 1))) {
+            continue;
+        }
+        held_element<I> held(i);
+        do {
+            *held.hole = std::ranges::iter_move(held.hole - 1);
+            --held.hole;
+        } while (held.hole != first && less(held.value, *(held.hole - 1)));
+        moved += i - held.hole;
+        if (moved > partial_insertion_sort_limit) {
+            return i + 1 == last;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Partition [first, last) around the pivot *first into elements less than
+ * it and elements not less than it. Requires a median-of-3 pivot, so both scans
+ * stop on a sentinel.
+ * @return the pivot's final position, and whether no element had to be moved
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr std::pair<I, bool> partition_right(I begin, I end, Less& less) {
+    held_element<I> held(begin);
+    const std::iter_value_t<I>& pivot = held.value;
+    I first = begin;
+    I last = end;
+
+    /* the median of three guarantees an element not less than the pivot */
+    while (less(*++first, pivot)) {}
+    if (first - 1 == begin) {
+        while (first < last && !less(*--last, pivot)) {}
+    }
+    else {
+        while (!less(*--last, pivot)) {}
+    }
+
+    const bool already_partitioned = first >= last;
+    while (first < last) {
+        std::ranges::iter_swap(first, last);
+        while (less(*++first, pivot)) {}
+        while (!less(*--last, pivot)) {}
+    }
+
+    I pivot_pos = first - 1;
+    *begin = std::ranges::iter_move(pivot_pos);
+    held.hole = pivot_pos;
+    return { pivot_pos, already_partitioned };
+}
+
+/**
+ * @brief Swap `count` misplaced elements recorded as offsets from both ends.
+ * With unequal counts a cyclic permutation does one move per element instead of three.
+ */
+template<std::random_access_iterator I>
+constexpr void swap_offsets(I first, I last, const unsigned char* offsets_l, const unsigned char* offsets_r,
+                            const std::ptrdiff_t count, const bool use_swaps) {
+    if (use_swaps) {
+        for (std::ptrdiff_t i = 0; i < count; ++i) {
+            std::ranges::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+        }
+    }
+    else if (count > 0) {
+        I l = first + offsets_l[0];
+        I r = last - offsets_r[0];
+        std::iter_value_t<I> value = std::ranges::iter_move(l);
+        *l = std::ranges::iter_move(r);
+        for (std::ptrdiff_t i = 1; i < count; ++i) {
+            l = first + offsets_l[i];
+            *r = std::ranges::iter_move(l);
+            r = last - offsets_r[i];
+            *l = std::ranges::iter_move(r);
+        }
+        *r = std::move(value);
+    }
+    return;
+}
+
+/**
+ * @brief partition_right, except that elements are compared a block at a time and
+ * the positions of misplaced ones are recorded without branching on the result,
+ * so a random input does not cost a branch misprediction per element.
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr std::pair<I, bool> partition_right_branchless(I begin, I end, Less& less) {
+    held_element<I> held(begin);
+    const std::iter_value_t<I>& pivot = held.value;
+    I first = begin;
+    I last = end;
+
+    while (less(*++first, pivot)) {}
+    if (first - 1 == begin) {
+        while (first < last && !less(*--last, pivot)) {}
+    }
+    else {
+        while (!less(*--last, pivot)) {}
+    }
+
+    const bool already_partitioned = first >= last;
+    if (!already_partitioned) {
+        std::ranges::iter_swap(first, last);
+        ++first;
+
+        /* the offsets of misplaced elements within the current block of each side */
+        alignas(64) unsigned char offsets_l[block_size] = {};
+        alignas(64) unsigned char offsets_r[block_size] = {};
+        I offsets_l_base = first;
+        I offsets_r_base = last;
+        std::ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (first < last) {
+            /* refill the empty side(s); near the end split what is left between them */
+            const std::ptrdiff_t num_unknown = last - first;
+            const std::ptrdiff_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+            const std::ptrdiff_t right_split = num_r == 0 ? num_unknown - left_split : 0;
+
+            if (left_split >= block_size) {
+                for (std::ptrdiff_t i = 0; i < block_size; ++i) {
+                    offsets_l[num_l] = static_cast<unsigned char>(i);
+                    num_l += !less(*first, pivot);
+                    ++first;
+                }
+            }
+            else {
+                for (std::ptrdiff_t i = 0; i < left_split; ++i) {
+                    offsets_l[num_l] = static_cast<unsigned char>(i);
+                    num_l += !less(*first, pivot);
+                    ++first;
+                }
+            }
+
+            if (right_split >= block_size) {
+                for (std::ptrdiff_t i = 0; i < block_size; ) {
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += less(*--last, pivot);
+                }
+            }
+            else {
+                for (std::ptrdiff_t i = 0; i < right_split; ) {
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += less(*--last, pivot);
+                }
+            }
+
+            const std::ptrdiff_t count = std::min(num_l, num_r);
+            swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                         count, num_l == num_r);
+            num_l -= count;
+            num_r -= count;
+            start_l += count;
+            start_r += count;
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        /* one side may still hold misplaced elements; move them next to the boundary */
+        if (num_l) {
+            while (num_l--) {
+                std::ranges::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+            }
+            first = last;
+        }
+        if (num_r) {
+            while (num_r--) {
+                std::ranges::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+                ++first;
+            }
+            last = first;
+        }
+    }
+
+    I pivot_pos = first - 1;
+    *begin = std::ranges::iter_move(pivot_pos);
+    held.hole = pivot_pos;
+    return { pivot_pos, already_partitioned };
+}
+
+/**
+ * @brief Partition [first, last) into elements equal to the pivot *first and elements
+ * greater than it. Only called when an element before `begin` equals the pivot,
+ * so nothing in the range is less than it.
+ * @return the pivot's final position; everything before it equals the pivot
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr I partition_left(I begin, I end, Less& less) {
+    held_element<I> held(begin);
+    const std::iter_value_t<I>& pivot = held.value;
+    I first = begin;
+    I last = end;
+
+    while (less(pivot, *--last)) {}
+    if (last + 1 == end) {
+        while (first < last && !less(pivot, *++first)) {}
+    }
+    else {
+        while (!less(pivot, *++first)) {}
+    }
+
+    while (first < last) {
+        std::ranges::iter_swap(first, last);
+        while (less(pivot, *--last)) {}
+        while (!less(pivot, *++first)) {}
+    }
+
+    I pivot_pos = last;
+    *begin = std::ranges::iter_move(pivot_pos);
+    held.hole = pivot_pos;
+    return pivot_pos;
+}
+
+/**
+ * @brief Sort [begin, end). Recurses into the left partition and loops on the right one.
+ * @param bad_allowed highly unbalanced partitions left before falling back to heap sort
+ * @param leftmost false if the element before `begin` is not greater than any in the range
+ */
+template<bool Branchless, std::random_access_iterator I, typename Less>
+constexpr void pdqsort_loop(I begin, I end, Less& less, int bad_allowed, bool leftmost = true) {
+    while (true) {
+        const std::ptrdiff_t size = end - begin;
+        if (size < insertion_sort_threshold) {
+            if (leftmost) {
+                insertion_sort(begin, end, less);
+            }
+            else {
+                unguarded_insertion_sort(begin, end, less);
+            }
+            return;
+        }
+
+        /* leave the pivot in *begin */
+        const std::ptrdiff_t s2 = size / 2;
+        if (size > ninther_threshold) {
+            sort3(begin, begin + s2, end - 1, less);
+            sort3(begin + 1, begin + (s2 - 1), end - 2, less);
+            sort3(begin + 2, begin + (s2 + 1), end - 3, less);
+            sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), less);
+            std::ranges::iter_swap(begin, begin + s2);
+        }
+        else {
+            sort3(begin + s2, begin, end - 1, less);
+        }
+
+        /* the pivot equals the element before this partition, the parent's pivot:
+         * there is nothing less than it, so only separate the equal elements */
+        if (!leftmost && !less(*(begin - 1), *begin)) {
+            begin = partition_left(begin, end, less) + 1;
+            continue;
+        }
+
+        const auto [pivot_pos, already_partitioned] = Branchless
+            ? partition_right_branchless(begin, end, less)
+            : partition_right(begin, end, less);
+
+        const std::ptrdiff_t l_size = pivot_pos - begin;
+        const std::ptrdiff_t r_size = end - (pivot_pos + 1);
+        const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            if (--bad_allowed == 0) {
+                make_heap(begin, end, less);
+                sort_heap(begin, end, less);
+                return;
+            }
+
+            /* shuffle a few elements around the would-be pivots to break the pattern */
+            if (l_size >= insertion_sort_threshold) {
+                std::ranges::iter_swap(begin, begin + l_size / 4);
+                std::ranges::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                if (l_size > ninther_threshold) {
+                    std::ranges::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                    std::ranges::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                    std::ranges::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                    std::ranges::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                }
+            }
+            if (r_size >= insertion_sort_threshold) {
+                std::ranges::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                std::ranges::iter_swap(end - 1, end - r_size / 4);
+                if (r_size > ninther_threshold) {
+                    std::ranges::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                    std::ranges::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                    std::ranges::iter_swap(end - 2, end - (1 + r_size / 4));
+                    std::ranges::iter_swap(end - 3, end - (2 + r_size / 4));
+                }
+            }
+        }
+        else if (already_partitioned
+                 && partial_insertion_sort(begin, pivot_pos, less)
+                 && partial_insertion_sort(pivot_pos + 1, end, less)) {
+            /* a balanced partition without swaps: the input is probably (nearly) sorted */
+            return;
+        }
+
+        pdqsort_loop<Branchless>(begin, pivot_pos, less, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+} // util::algorithm::detail::pdq
+
+/**
+ * @brief Pattern-defeating quicksort, O(n log n) in the worst case and O(n) on
+ * sorted, reverse-sorted and all-equal inputs.
+ */
+struct pdq_sort_fn : detail::sort_fn_base<pdq_sort_fn> {
+    template<std::random_access_iterator I, typename Less>
+    static constexpr void sort(I first, I last, Less less) {
+        if (last - first < 2) {
+            return;
+        }
+        const int bad_allowed = std::bit_width(static_cast<std::make_unsigned_t<std::iter_difference_t<I>>>(last - first));
+        detail::pdq::pdqsort_loop<detail::pdq::use_branchless<I, Less>>(first, last, less, bad_allowed);
+        return;
+    }
+};
+
+inline constexpr pdq_sort_fn pdq_sort{};
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_PDQSORT_HPP
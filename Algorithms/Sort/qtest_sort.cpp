@@ -0,0 +1,682 @@
+/**
+ * @file qtest_sort.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Sorting library test cases with QTest framework.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include "external_sort.hpp"
+#include "parallel_sort.hpp"
+#include "pdqsort.hpp"
+#include "radix_sort.hpp"
+#include "selection.hpp"
+#include "simd_sort.hpp"
+#include "sort.hpp"
+#include "timsort.hpp"
+
+namespace {
+
+struct record {
+    int key;
+    int order;      /* position in the input, to observe stability */
+};
+
+/* a string whose move constructor throws once, after `moves_left` moves, leaving its source intact */
+struct fragile {
+    std::string text;
+    static inline std::atomic<long> moves_left{ -1 };
+
+    fragile(std::string value) : text(std::move(value)) {}
+    fragile(fragile&& other) : text(take(other.text)) {}
+    fragile& operator = (fragile&&) noexcept = default;
+
+    static std::string&& take(std::string& source) {
+        if (moves_left.fetch_sub(1) == 1) {
+            throw std::runtime_error("move");
+        }
+        return std::move(source);
+    }
+
+    friend bool operator == (const fragile&, const fragile&) = default;
+    friend auto operator <=> (const fragile&, const fragile&) = default;
+};
+
+std::vector<int> random_ints(const std::size_t count, const int max_value) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> distribution(0, max_value);
+    std::vector<int> values(count);
+    std::ranges::generate(values, [&]() { return distribution(engine); });
+    return values;
+}
+
+/* sort with `sorter` and compare against std::ranges::sort on several inputs */
+template<typename Sorter>
+bool sorts_like_std(const Sorter& sorter) {
+    for (const std::size_t count : { 0u, 1u, 2u, 3u, 17u, 256u }) {
+        for (const int max_value : { 3, 1000 }) {
+            std::vector<int> actual = random_ints(count, max_value);
+            std::vector<int> expected = actual;
+            std::ranges::sort(expected);
+            if (sorter(actual) != actual.end() || actual != expected) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename Sorter>
+bool sorts_stably(const Sorter& sorter) {
+    std::vector<record> records;
+    const std::vector<int> keys = random_ints(200, 5);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        records.push_back({ keys[i], static_cast<int>(i) });
+    }
+    sorter(records, {}, &record::key);
+    return std::ranges::is_sorted(records, [](const record& lhs, const record& rhs) {
+        return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.order < rhs.order);
+    });
+}
+
+/* random keys, biased towards the extremes to exercise the padding with the largest key */
+template<typename T>
+bool simd_sorts_like_std(const util::algorithm::simd_level level) {
+    std::mt19937_64 engine(7);
+    for (const std::size_t count : { 0u, 1u, 5u, 8u, 16u, 17u, 100u, 255u, 256u, 257u, 1000u, 5000u }) {
+        std::vector<T> actual(count);
+        for (T& key : actual) {
+            switch (engine() % 3) {
+            case 0:  key = static_cast<T>(engine()); break;
+            case 1:  key = std::numeric_limits<T>::max() - static_cast<T>(engine() % 4); break;
+            default: key = std::numeric_limits<T>::min() + static_cast<T>(engine() % 4); break;
+            }
+        }
+        std::vector<T> expected = actual;
+        std::ranges::sort(expected);
+        util::algorithm::simd_sort(actual, level);
+        if (actual != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* inputs long enough to reach the ninther, the partition and the pattern-breaking paths */
+std::vector<std::vector<int>> patterned_inputs(const std::size_t count) {
+    std::vector<std::vector<int>> inputs;
+    inputs.push_back(random_ints(count, 1 << 30));
+    inputs.push_back(random_ints(count, 3));
+    std::vector<int> ascending(count), descending(count), organ_pipe(count), sawtooth(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ascending[i] = static_cast<int>(i);
+        descending[i] = static_cast<int>(count - i);
+        organ_pipe[i] = static_cast<int>(i < count / 2 ? i : count - i);
+        sawtooth[i] = static_cast<int>(i % 100);
+    }
+    inputs.push_back(ascending);
+    inputs.push_back(descending);
+    inputs.push_back(organ_pipe);
+    inputs.push_back(sawtooth);
+    inputs.push_back(std::vector<int>(count, 7));
+    return inputs;
+}
+
+/* write `values` to a file, sort it externally and read the result back */
+template<typename T, typename... SortArgs>
+std::vector<T> external_sorted(const std::vector<T>& values, const util::algorithm::external_sort_options& options,
+                               SortArgs... sort_args) {
+    const std::filesystem::path input = options.temp_directory / "qtest_external_sort.in";
+    const std::filesystem::path output = options.temp_directory / "qtest_external_sort.out";
+    std::FILE* file = std::fopen(input.string().c_str(), "wb");
+    if (!values.empty()) {
+        std::fwrite(values.data(), sizeof(T), values.size(), file);
+    }
+    std::fclose(file);
+
+    util::algorithm::external_sort<T>(input, output, options, sort_args...);
+
+    std::vector<T> sorted(std::filesystem::file_size(output) / sizeof(T));
+    file = std::fopen(output.string().c_str(), "rb");
+    const std::size_t count = sorted.empty() ? 0 : std::fread(sorted.data(), sizeof(T), sorted.size(), file);
+    std::fclose(file);
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+    sorted.resize(count);
+    return sorted;
+}
+
+constexpr std::array<int, 6> sorted_at_compile_time() {
+    std::array<int, 6> values = { 4, 2, 7, 1, 3, 9 };
+    util::algorithm::insertion_sort(values);
+    return values;
+}
+
+constexpr bool pdq_sorts_at_compile_time() {
+    std::array<int, 300> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>((i * 7919) % 301);
+    }
+    util::algorithm::pdq_sort(values);
+    return std::ranges::is_sorted(values);
+}
+
+constexpr bool tim_sorts_at_compile_time() {
+    std::array<int, 300> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>((i * 7919) % 301);
+    }
+    util::algorithm::tim_sort(values);
+    return std::ranges::is_sorted(values);
+}
+
+constexpr bool selects_at_compile_time() {
+    std::array<int, 300> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>((i * 7919) % 301);
+    }
+    util::algorithm::nth_element(values, values.begin() + 150);
+    if (values[150] != 150) {
+        return false;
+    }
+    util::algorithm::partial_sort(values, values.begin() + 10);
+    return values[0] == 0 && values[9] == 9 && std::ranges::is_sorted(values.begin(), values.begin() + 10);
+}
+
+} // namespace
+
+class TestSort : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    /* elementary sorts */
+    void bubbleSort() const;
+    void selectionSort() const;
+    void insertionSort() const;
+    void heapSort() const;
+
+    /* pattern-defeating quicksort */
+    void pdqSort() const;
+    void pdqSortPatterns() const;
+    void pdqSortNonArithmetic() const;
+
+    /* adaptive merge sort */
+    void timSort() const;
+    void timSortPresorted() const;
+
+    /* parallel sample sort */
+    void parallelSort() const;
+    void parallelSortRecords() const;
+    void parallelSortThrowing() const;
+
+    /* vectorised sorting networks */
+    void simdSort() const;
+
+    /* radix sorts */
+    void radixSortNumbers() const;
+    void radixSortRecords() const;
+    void msdRadixSortStrings() const;
+
+    /* selection */
+    void nthElement() const;
+    void partialSort() const;
+    void topK() const;
+
+    /* external merge sort */
+    void externalSort() const;
+
+    /* call styles */
+    void comparatorAndProjection() const;
+    void iteratorSentinelPair() const;
+    void constantEvaluation() const;
+};
+
+void TestSort::bubbleSort() const
+{
+    qDebug() << "Comparing bubble sort against std::ranges::sort";
+    QVERIFY(sorts_like_std(util::algorithm::bubble_sort));
+    QVERIFY(sorts_stably(util::algorithm::bubble_sort));
+    return;
+}
+
+void TestSort::selectionSort() const
+{
+    qDebug() << "Comparing selection sort against std::ranges::sort";
+    QVERIFY(sorts_like_std(util::algorithm::selection_sort));
+    return;
+}
+
+void TestSort::insertionSort() const
+{
+    qDebug() << "Comparing insertion sort against std::ranges::sort";
+    QVERIFY(sorts_like_std(util::algorithm::insertion_sort));
+    QVERIFY(sorts_stably(util::algorithm::insertion_sort));
+    return;
+}
+
+void TestSort::heapSort() const
+{
+    qDebug() << "Comparing heap sort against std::ranges::sort";
+    QVERIFY(sorts_like_std(util::algorithm::heap_sort));
+    return;
+}
+
+void TestSort::pdqSort() const
+{
+    qDebug() << "Comparing pdqsort against std::ranges::sort";
+    QVERIFY(sorts_like_std(util::algorithm::pdq_sort));
+    return;
+}
+
+void TestSort::pdqSortPatterns() const
+{
+    qDebug() << "Sorting patterned and duplicate-heavy inputs with pdqsort";
+    for (const std::size_t count : { 100u, 1000u, 20000u }) {
+        for (std::vector<int> actual : patterned_inputs(count)) {
+            std::vector<int> expected = actual;
+            std::ranges::sort(expected, std::ranges::greater{});
+            util::algorithm::pdq_sort(actual, std::ranges::greater{});
+            QVERIFY(actual == expected);
+        }
+    }
+    return;
+}
+
+void TestSort::pdqSortNonArithmetic() const
+{
+    qDebug() << "Sorting strings and projected records with pdqsort";
+    std::vector<std::string> actual;
+    for (const int value : random_ints(5000, 200)) {
+        actual.push_back(std::to_string(value));
+    }
+    std::vector<std::string> expected = actual;
+    std::ranges::sort(expected);
+    util::algorithm::pdq_sort(actual);
+    QVERIFY(actual == expected);
+
+    std::vector<record> records;
+    for (const int key : random_ints(5000, 1000)) {
+        records.push_back({ key, static_cast<int>(records.size()) });
+    }
+    util::algorithm::pdq_sort(records, std::ranges::less{}, &record::key);
+    QVERIFY(std::ranges::is_sorted(records, {}, &record::key));
+    return;
+}
+
+void TestSort::timSort() const
+{
+    qDebug() << "Comparing TimSort against std::ranges::sort";
+    QVERIFY(sorts_like_std(util::algorithm::tim_sort));
+    QVERIFY(sorts_stably(util::algorithm::tim_sort));
+    for (const std::size_t count : { 100u, 1000u, 20000u }) {
+        for (std::vector<int> actual : patterned_inputs(count)) {
+            std::vector<int> expected = actual;
+            std::ranges::sort(expected, std::ranges::greater{});
+            util::algorithm::tim_sort(actual, std::ranges::greater{});
+            QVERIFY(actual == expected);
+        }
+    }
+    return;
+}
+
+void TestSort::timSortPresorted() const
+{
+    qDebug() << "Sorting appended logs stably and with linear comparisons";
+    /* timestamps in order, then a tail of late events with many equal timestamps */
+    std::vector<record> log;
+    for (int i = 0; i < 20000; ++i) {
+        log.push_back({ i / 4, i });
+    }
+    for (const int key : random_ints(2000, 5000)) {
+        log.push_back({ key, static_cast<int>(log.size()) });
+    }
+    std::vector<record> expected = log;
+    std::ranges::stable_sort(expected, {}, &record::key);
+    util::algorithm::tim_sort(log, {}, &record::key);
+    QVERIFY(std::ranges::equal(log, expected, [](const record& lhs, const record& rhs) {
+        return lhs.key == rhs.key && lhs.order == rhs.order;
+    }));
+
+    /* one natural run, ascending or strictly descending: n - 1 comparisons */
+    for (const bool descending : { false, true }) {
+        std::vector<int> sorted(10000);
+        for (std::size_t i = 0; i < sorted.size(); ++i) {
+            sorted[i] = descending ? static_cast<int>(sorted.size() - i) : static_cast<int>(i);
+        }
+        std::size_t comparisons = 0;
+        util::algorithm::tim_sort(sorted, [&comparisons](const int lhs, const int rhs) {
+            ++comparisons;
+            return lhs < rhs;
+        });
+        QVERIFY(std::ranges::is_sorted(sorted));
+        QCOMPARE(comparisons, sorted.size() - 1);
+    }
+    return;
+}
+
+void TestSort::parallelSort() const
+{
+    qDebug() << "Comparing parallel sort on four threads against std::ranges::sort";
+    util::algorithm::thread_pool pool(4);
+    for (std::vector<int> actual : patterned_inputs(300000)) {
+        std::vector<int> expected = actual;
+        std::ranges::sort(expected);
+        QVERIFY(util::algorithm::parallel_sort(pool, actual) == actual.end());
+        QVERIFY(actual == expected);
+    }
+    return;
+}
+
+void TestSort::parallelSortRecords() const
+{
+    qDebug() << "Sorting strings and projected records in parallel";
+    util::algorithm::thread_pool pool(3);
+    std::vector<std::string> actual;
+    for (const int value : random_ints(100000, 5000)) {
+        actual.push_back(std::to_string(value));
+    }
+    std::vector<std::string> expected = actual;
+    std::ranges::sort(expected, std::ranges::greater{});
+    util::algorithm::parallel_sort(pool, actual.begin(), actual.end(), std::ranges::greater{});
+    QVERIFY(actual == expected);
+
+    std::vector<record> records;
+    for (const int key : random_ints(100000, 20)) {
+        records.push_back({ key, static_cast<int>(records.size()) });
+    }
+    util::algorithm::parallel_sort(pool, records, {}, &record::key);
+    QVERIFY(std::ranges::is_sorted(records, {}, &record::key));
+    return;
+}
+
+void TestSort::parallelSortThrowing() const
+{
+    qDebug() << "A throwing comparator or move leaves a permutation of the input";
+    util::algorithm::thread_pool pool(4);
+    std::vector<std::string> strings;
+    for (const int value : random_ints(200000, 1 << 30)) {
+        strings.push_back(std::to_string(value));
+    }
+    std::vector<std::string> expected = strings;
+    std::ranges::sort(expected);
+
+    std::atomic<long> comparisons_left{ 3000000 };
+    const auto throwing_less = [&comparisons_left](const std::string& lhs, const std::string& rhs) {
+        if (comparisons_left.fetch_sub(1, std::memory_order_relaxed) == 1) {
+            throw std::runtime_error("compare");
+        }
+        return lhs < rhs;
+    };
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, util::algorithm::parallel_sort(pool, strings, throwing_less));
+    std::ranges::sort(strings);
+    QVERIFY(strings == expected);
+
+    std::vector<fragile> values;
+    for (const std::string& text : expected) {
+        values.emplace_back(text);
+    }
+    fragile::moves_left = static_cast<long>(values.size() / 2);
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, util::algorithm::parallel_sort(pool, values));
+    fragile::moves_left = -1;
+    std::ranges::sort(values);
+    QVERIFY(std::ranges::equal(values, expected, {}, &fragile::text));
+    return;
+}
+
+void TestSort::simdSort() const
+{
+    using util::algorithm::simd_level;
+    qDebug() << "Comparing every available simd_sort instruction set against std::ranges::sort";
+    for (const simd_level level : { simd_level::scalar, simd_level::avx2, simd_level::avx512 }) {
+        if (level > util::algorithm::simd_sort_level()) {
+            qDebug() << "Skipping an instruction set this processor lacks";
+            continue;
+        }
+        QVERIFY(simd_sorts_like_std<std::int32_t>(level));
+        QVERIFY(simd_sorts_like_std<std::uint32_t>(level));
+        QVERIFY(simd_sorts_like_std<std::int64_t>(level));
+        QVERIFY(simd_sorts_like_std<std::uint64_t>(level));
+    }
+    return;
+}
+
+void TestSort::radixSortNumbers() const
+{
+    qDebug() << "Comparing LSD radix sort of integers and floats against std::ranges::sort";
+    for (const std::size_t count : { 0u, 1u, 50u, 1000u, 300000u }) {
+        std::vector<int> ints = random_ints(count, 1 << 30);
+        for (std::size_t i = 0; i < ints.size(); i += 3) {
+            ints[i] = -ints[i];
+        }
+        std::vector<int> expected_ints = ints;
+        std::ranges::sort(expected_ints);
+        util::algorithm::radix_sort(ints);
+        QVERIFY(ints == expected_ints);
+
+        std::vector<double> doubles;
+        for (const int value : random_ints(count, 2000)) {
+            doubles.push_back((value - 1000) / 7.0);
+        }
+        if (count > 0) {
+            doubles[0] = -std::numeric_limits<double>::infinity();
+        }
+        std::vector<double> expected_doubles = doubles;
+        std::ranges::sort(expected_doubles);
+        util::algorithm::radix_sort(doubles);
+        QVERIFY(doubles == expected_doubles);
+    }
+    return;
+}
+
+void TestSort::radixSortRecords() const
+{
+    qDebug() << "Sorting records and record indices by a numeric key with radix sort";
+    std::vector<record> records;
+    for (const int key : random_ints(5000, 20)) {
+        records.push_back({ key - 10, static_cast<int>(records.size()) });
+    }
+    const std::vector<record> input = records;
+    util::algorithm::radix_sort(records, &record::key);
+    QVERIFY(std::ranges::is_sorted(records, [](const record& lhs, const record& rhs) {
+        return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.order < rhs.order);
+    }));
+
+    const std::vector<std::uint32_t> indices = util::algorithm::radix_sort_indices(input, &record::key);
+    QCOMPARE(indices.size(), input.size());
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        QCOMPARE(input[indices[i]].order, records[i].order);
+    }
+    return;
+}
+
+void TestSort::msdRadixSortStrings() const
+{
+    qDebug() << "Comparing MSD radix sort of strings against std::ranges::sort";
+    std::vector<std::string> actual = { "", "a", "", "ab", "abc", "b", "aa", "abc" };
+    for (const int value : random_ints(3000, 100000)) {
+        actual.push_back("shared/prefix/" + std::to_string(value % 7) + std::string(value % 3, '\xff') + std::to_string(value));
+    }
+    std::vector<std::string> expected = actual;
+    std::ranges::sort(expected);
+    util::algorithm::msd_radix_sort(actual);
+    QVERIFY(actual == expected);
+
+    std::vector<std::pair<std::string, int>> people = { { "Liam", 1 }, { "Andy", 2 }, { "Jacob", 3 } };
+    util::algorithm::msd_radix_sort(people, &std::pair<std::string, int>::first);
+    QCOMPARE(people[0].second, 2);
+    QCOMPARE(people[2].second, 1);
+    return;
+}
+
+void TestSort::nthElement() const
+{
+    qDebug() << "Comparing nth_element against std::ranges::sort";
+    for (const std::size_t count : { 1u, 2u, 30u, 1000u, 20000u }) {
+        for (const std::vector<int>& input : patterned_inputs(count)) {
+            std::vector<int> sorted = input;
+            std::ranges::sort(sorted);
+            for (const std::size_t n : { std::size_t{ 0 }, count / 3, count - 1 }) {
+                std::vector<int> actual = input;
+                const auto nth = actual.begin() + static_cast<std::ptrdiff_t>(n);
+                QVERIFY(util::algorithm::nth_element(actual, nth) == actual.end());
+                QCOMPARE(*nth, sorted[n]);
+                QVERIFY(std::all_of(actual.begin(), nth, [&](const int value) { return value <= *nth; }));
+                QVERIFY(std::all_of(nth, actual.end(), [&](const int value) { return value >= *nth; }));
+            }
+        }
+    }
+    return;
+}
+
+void TestSort::partialSort() const
+{
+    qDebug() << "Comparing partial_sort against std::ranges::sort";
+    for (const std::size_t count : { 0u, 1u, 30u, 1000u, 20000u }) {
+        for (const std::vector<int>& input : patterned_inputs(count)) {
+            std::vector<int> sorted = input;
+            std::ranges::sort(sorted, std::ranges::greater{});
+            /* small k go through the heap select, large ones straight to introselect */
+            for (const std::size_t k : { std::size_t{ 0 }, count / 100, count / 2, count }) {
+                std::vector<int> actual = input;
+                util::algorithm::partial_sort(actual, actual.begin() + static_cast<std::ptrdiff_t>(k), std::ranges::greater{});
+                QVERIFY(std::equal(actual.begin(), actual.begin() + static_cast<std::ptrdiff_t>(k), sorted.begin()));
+                std::ranges::sort(actual, std::ranges::greater{});
+                QVERIFY(actual == sorted);
+            }
+        }
+    }
+
+    std::vector<std::pair<std::string, int>> people = { { "Jacob", 40 }, { "Andy", 20 }, { "Liam", 34 }, { "Ann", 27 } };
+    util::algorithm::partial_sort(people, people.begin() + 2, {}, &std::pair<std::string, int>::second);
+    QCOMPARE(people[0].first, std::string("Andy"));
+    QCOMPARE(people[1].first, std::string("Ann"));
+    return;
+}
+
+void TestSort::topK() const
+{
+    qDebug() << "Selecting the top k of streams with a bounded heap";
+    const std::vector<int> values = random_ints(20000, 1 << 20);
+    std::vector<int> sorted = values;
+    std::ranges::sort(sorted, std::ranges::greater{});
+    for (const std::size_t k : { 0u, 1u, 100u, 20000u, 30000u }) {
+        const std::vector<int> best = util::algorithm::top_k(values, k, std::ranges::greater{});
+        QCOMPARE(best.size(), std::min<std::size_t>(k, values.size()));
+        QVERIFY(std::equal(best.begin(), best.end(), sorted.begin()));
+    }
+
+    /* a single-pass input that is never stored */
+    std::istringstream stream("5 3 9 1 7 2 8");
+    const std::vector<int> smallest = util::algorithm::top_k(std::istream_iterator<int>(stream), std::istream_iterator<int>(), 3);
+    QVERIFY(smallest == std::vector<int>({ 1, 2, 3 }));
+
+    using person = std::pair<std::string, int>;
+    util::algorithm::top_k_heap<person, std::ranges::greater, int person::*> oldest(2, {}, &person::second);
+    oldest.push(person{ "Andy", 20 });
+    oldest.push(person{ "Jacob", 40 });
+    QVERIFY(oldest.full());
+    oldest.push(person{ "Liam", 34 });
+    QCOMPARE(oldest.threshold().first, std::string("Liam"));
+    const std::vector<person> result = std::move(oldest).take_sorted();
+    QCOMPARE(result[0].first, std::string("Jacob"));
+    QCOMPARE(result[1].first, std::string("Liam"));
+    return;
+}
+
+void TestSort::externalSort() const
+{
+    qDebug() << "Comparing external sort with tiny memory budgets against std::ranges::sort";
+    util::algorithm::external_sort_options options;
+    std::mt19937_64 engine(11);
+    /* 1 KiB budgets: 32-key runs with radix sort, 42-record runs with pdq_sort */
+    options.memory_budget = 1024;
+    for (const std::size_t count : { 0u, 1u, 32u, 33u, 1000u, 5000u }) {
+        std::vector<std::uint64_t> keys(count);
+        std::ranges::generate(keys, [&]() { return engine() % 5000; });
+        std::vector<std::uint64_t> expected = keys;
+        std::ranges::sort(expected);
+        QVERIFY(external_sorted(keys, options) == expected);
+    }
+
+    /* records by a projected key, descending; a fan-in of 3 forces intermediate merge passes */
+    options.max_fan_in = 3;
+    std::vector<record> records;
+    for (const int key : random_ints(5000, 100)) {
+        records.push_back({ key, static_cast<int>(records.size()) });
+    }
+    const std::vector<record> actual = external_sorted(records, options, std::ranges::greater{}, &record::key);
+    QCOMPARE(actual.size(), records.size());
+    QVERIFY(std::ranges::is_sorted(actual, std::ranges::greater{}, &record::key));
+    std::vector<int> orders;
+    for (const record& r : actual) {
+        orders.push_back(r.order);
+    }
+    std::ranges::sort(orders);
+    QVERIFY(std::ranges::adjacent_find(orders) == orders.end());
+    return;
+}
+
+void TestSort::comparatorAndProjection() const
+{
+    qDebug() << "Sorting records by a projected member in descending order";
+    std::vector<std::pair<std::string, int>> people = {
+        { "Jacob", 40 }, { "Andy", 20 }, { "Liam", 34 },
+    };
+    util::algorithm::insertion_sort(people, std::ranges::greater{}, &std::pair<std::string, int>::second);
+    QCOMPARE(people[0].first, std::string("Jacob"));
+    QCOMPARE(people[1].first, std::string("Liam"));
+    QCOMPARE(people[2].first, std::string("Andy"));
+    return;
+}
+
+void TestSort::iteratorSentinelPair() const
+{
+    qDebug() << "Sorting a sub-range through an iterator pair";
+    std::vector<int> values = { 9, 8, 7, 6, 5, 4 };
+    const auto last = util::algorithm::selection_sort(values.begin() + 1, values.end() - 1);
+    QVERIFY(last == values.end() - 1);
+    QVERIFY((values == std::vector<int>{ 9, 5, 6, 7, 8, 4 }));
+    return;
+}
+
+void TestSort::constantEvaluation() const
+{
+    qDebug() << "Sorting during constant evaluation";
+    constexpr std::array<int, 6> values = sorted_at_compile_time();
+    static_assert(std::ranges::is_sorted(values));
+    static_assert(pdq_sorts_at_compile_time());
+    static_assert(tim_sorts_at_compile_time());
+    static_assert(selects_at_compile_time());
+    QVERIFY(std::ranges::is_sorted(values));
+    return;
+}
+
+QTEST_MAIN(TestSort)
+#include "qtest_sort.moc"
@@ -0,0 +1,393 @@
+/**
+ * @file radix_sort.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Radix sorts, which never compare two keys:
+ *
+ *   util::algorithm::radix_sort(keys);                          // integers, float, double
+ *   util::algorithm::radix_sort(records, &record::timestamp);   // records by a numeric key
+ *   std::vector<std::uint32_t> order = util::algorithm::radix_sort_indices(keys);
+ *   util::algorithm::msd_radix_sort(names);                     // strings, or records by a string key
+ *
+ * Numeric keys go through least-significant-digit (LSD) passes of 8 bits.
+ * Each key is first mapped to an unsigned integer with the same order:
+ * signed integers get their sign bit flipped, negative floating-point
+ * numbers all their bits and positive ones their sign bit. The histograms
+ * of every digit are built in a single read of the input, and a digit all
+ * keys share is skipped. Each pass scatters through a small cache-line
+ * buffer per bucket (software write-combining), so the writes reach
+ * memory a full line at a time instead of 256 streams of single keys.
+ * Inputs larger than the cache are first split on their top byte (an MSD
+ * pass), so the LSD passes run on cache-sized buckets.
+ *
+ * Strings go through most-significant-digit (MSD) passes, one byte of
+ * depth at a time, finishing small buckets with insertion sort.
+ *
+ * LSD sorts are stable and take O(n) extra memory. Floating-point order is
+ * that of the IEEE 754 bit patterns: -0.0 sorts before +0.0 and NaNs with
+ * the sign bit set come first, the others last.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_RADIX_SORT_HPP
+#define UTIL_ALGORITHM_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sort.hpp"
+
+namespace util::algorithm {
+
+template<typename T>
+concept radix_key = (std::integral<T> && !std::same_as<T, bool>)
+                 || std::same_as<T, float> || std::same_as<T, double>;
+
+namespace detail::radix {
+
+inline constexpr std::size_t buckets = 256;
+inline constexpr std::size_t write_combine_bytes = 64;
+/* below this many keys the write-combining buffers cost more than they save */
+inline constexpr std::size_t write_combine_threshold = 1 << 16;
+inline constexpr std::ptrdiff_t msd_insertion_threshold = 32;
+/* numeric buckets smaller than this are finished with insertion sort */
+inline constexpr std::size_t small_bucket = 64;
+/* numeric inputs larger than this get MSD passes before the LSD passes */
+inline constexpr std::size_t cache_bytes = std::size_t{ 1 } << 19;
+
+template<radix_key T>
+using unsigned_key_t = std::make_unsigned_t<
+    std::conditional_t<std::is_floating_point_v<T>,
+                       std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>, T>>;
+
+/**
+ * @brief Map a key to an unsigned integer that sorts in the same order.
+ */
+template<radix_key T>
+constexpr unsigned_key_t<T> to_unsigned(const T key) noexcept {
+    using U = unsigned_key_t<T>;
+    constexpr U sign = U{ 1 } << (sizeof(U) * 8 - 1);
+    if constexpr (std::is_floating_point_v<T>) {
+        const U bits = std::bit_cast<U>(key);
+        return bits ^ ((bits & sign) ? static_cast<U>(~U{ 0 }) : sign);
+    }
+    else if constexpr (std::is_signed_v<T>) {
+        return static_cast<U>(key) ^ sign;
+    }
+    else {
+        return key;
+    }
+}
+
+/* a key paired with the index of its record */
+template<typename U>
+struct keyed_index {
+    U key;
+    std::uint32_t index;
+};
+
+/**
+ * @brief Copy every element to out[offsets[digit]++], staged in one cache-line
+ * buffer per bucket that is flushed whenever it fills up.
+ */
+template<typename E, typename DigitFn>
+void scatter_write_combined(const E* data, E* out, const std::size_t n,
+                            std::array<std::size_t, buckets>& offsets, DigitFn digit) {
+    constexpr std::size_t per_line = std::max<std::size_t>(write_combine_bytes / sizeof(E), 1);
+    struct alignas(64) line {
+        E items[per_line];
+    };
+    const std::unique_ptr<line[]> lines = std::make_unique_for_overwrite<line[]>(buckets);
+    std::array<std::uint8_t, buckets> filled{};
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t b = digit(data[i]);
+        lines[b].items[filled[b]++] = data[i];
+        if (filled[b] == per_line) {
+            std::memcpy(out + offsets[b], lines[b].items, sizeof(lines[b].items));
+            offsets[b] += per_line;
+            filled[b] = 0;
+        }
+    }
+    for (std::size_t b = 0; b < buckets; ++b) {
+        std::memcpy(out + offsets[b], lines[b].items, filled[b] * sizeof(E));
+        offsets[b] += filled[b];
+    }
+    return;
+}
+
+template<typename E, typename DigitFn>
+void scatter_direct(const E* data, E* out, const std::size_t n,
+                    std::array<std::size_t, buckets>& offsets, DigitFn digit) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[offsets[digit(data[i])]++] = data[i];
+    }
+    return;
+}
+
+/**
+ * @brief LSD radix sort of trivially copyable elements by the low `digits`
+ * bytes of the unsigned key key_of(e). The result ends up in `data`;
+ * `buffer` holds n elements of scratch space.
+ */
+template<typename E, typename KeyFn>
+void lsd_sort(E* data, E* buffer, const std::size_t n, KeyFn& key_of, const std::size_t digits, const bool write_combine) {
+    static_assert(std::is_trivially_copyable_v<E>);
+    using U = std::invoke_result_t<KeyFn&, const E&>;
+
+    /* every histogram in one read of the input */
+    std::array<std::array<std::size_t, buckets>, sizeof(U)> histograms{};
+    for (std::size_t i = 0; i < n; ++i) {
+        const U key = key_of(data[i]);
+        for (std::size_t d = 0; d < digits; ++d) {
+            ++histograms[d][(key >> (8 * d)) & 0xFF];
+        }
+    }
+
+    E* from = data;
+    E* to = buffer;
+    for (std::size_t d = 0; d < digits; ++d) {
+        std::array<std::size_t, buckets>& counts = histograms[d];
+        if (std::ranges::find(counts, n) != counts.end()) {
+            continue;       /* every key has the same digit here */
+        }
+        std::size_t position = 0;
+        for (std::size_t& count : counts) {
+            position += std::exchange(count, position);
+        }
+        const auto digit = [&key_of, d](const E& e) { return static_cast<std::size_t>((key_of(e) >> (8 * d)) & 0xFF); };
+        if (write_combine) {
+            scatter_write_combined(from, to, n, counts, digit);
+        }
+        else {
+            scatter_direct(from, to, n, counts, digit);
+        }
+        std::swap(from, to);
+    }
+    if (from != data) {
+        std::memcpy(data, from, n * sizeof(E));
+    }
+    return;
+}
+
+/**
+ * @brief Stable sort by the low `digits` bytes of key_of(e). Inputs larger than
+ * the cache first get MSD passes on their top byte, until each bucket fits and
+ * its remaining LSD passes no longer miss the cache on every scatter.
+ */
+template<typename E, typename KeyFn>
+void sort_keys(E* data, E* buffer, const std::size_t n, KeyFn& key_of, std::size_t digits) {
+    if (n < small_bucket) {
+        insertion_sort(data, data + n, [&key_of](const E& lhs, const E& rhs) { return key_of(lhs) < key_of(rhs); });
+        return;
+    }
+    if (n * sizeof(E) <= cache_bytes || digits <= 2) {
+        lsd_sort(data, buffer, n, key_of, digits, n >= write_combine_threshold);
+        return;
+    }
+
+    const std::size_t shift = 8 * (digits - 1);
+    const auto digit = [&key_of, shift](const E& e) { return static_cast<std::size_t>((key_of(e) >> shift) & 0xFF); };
+    std::array<std::size_t, buckets> counts{};
+    for (std::size_t i = 0; i < n; ++i) {
+        ++counts[digit(data[i])];
+    }
+    if (std::ranges::find(counts, n) != counts.end()) {
+        sort_keys(data, buffer, n, key_of, digits - 1);
+        return;
+    }
+    std::array<std::size_t, buckets> offsets{};
+    std::size_t position = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        offsets[b] = position;
+        position += counts[b];
+    }
+    std::array<std::size_t, buckets> ends = offsets;
+    scatter_write_combined(data, buffer, n, ends, digit);
+
+    /* each bucket is sorted inside `buffer`, using its twin range of `data` as scratch */
+    for (std::size_t b = 0; b < buckets; ++b) {
+        if (counts[b] != 0) {
+            sort_keys(buffer + offsets[b], data + offsets[b], counts[b], key_of, digits - 1);
+            std::memcpy(data + offsets[b], buffer + offsets[b], counts[b] * sizeof(E));
+        }
+    }
+    return;
+}
+
+/* key pairs for the records of [first, last), sorted by key */
+template<std::random_access_iterator I, typename Proj>
+auto sorted_key_indices(I first, I last, Proj& proj) {
+    using T = std::remove_cvref_t<std::indirect_result_t<Proj&, I>>;
+    using U = unsigned_key_t<T>;
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("radix sort: more records than 32-bit indices can address");
+    }
+    std::vector<keyed_index<U>> pairs(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        pairs[i] = { to_unsigned(static_cast<T>(std::invoke(proj, first[static_cast<std::ptrdiff_t>(i)]))),
+                     static_cast<std::uint32_t>(i) };
+    }
+    std::vector<keyed_index<U>> buffer(n);
+    const auto key_of = [](const keyed_index<U>& e) { return e.key; };
+    sort_keys(pairs.data(), buffer.data(), n, key_of, sizeof(U));
+    return pairs;
+}
+
+/* byte `depth` of a string plus one, or 0 past its end */
+inline std::size_t byte_at(const std::string_view s, const std::size_t depth) {
+    return depth < s.size() ? static_cast<unsigned char>(s[depth]) + std::size_t{ 1 } : 0;
+}
+
+/**
+ * @brief MSD radix sort of [first, last) by the string view proj(e), all of
+ * which share their first `depth` bytes. `buffer` has room for last - first elements.
+ */
+template<std::random_access_iterator I, typename V, typename Proj>
+void msd_sort(I first, I last, V* buffer, std::size_t depth, Proj& proj) {
+    const auto view = [&proj](const auto& e) { return std::string_view(std::invoke(proj, e)); };
+    while (true) {
+        const std::ptrdiff_t n = last - first;
+        if (n < msd_insertion_threshold) {
+            insertion_sort(first, last, [&view, depth](const auto& lhs, const auto& rhs) {
+                return view(lhs).substr(std::min(depth, view(lhs).size()))
+                     < view(rhs).substr(std::min(depth, view(rhs).size()));
+            });
+            return;
+        }
+
+        std::array<std::size_t, buckets + 1> counts{};
+        for (I it = first; it != last; ++it) {
+            ++counts[byte_at(view(*it), depth)];
+        }
+        if (counts[0] == static_cast<std::size_t>(n)) {
+            return;                 /* all strings end here, so they are equal */
+        }
+        if (std::ranges::find(counts, static_cast<std::size_t>(n)) != counts.end()) {
+            ++depth;                /* one shared byte: no need to move anything */
+            continue;
+        }
+
+        std::array<std::size_t, buckets + 1> offsets{};
+        std::size_t position = 0;
+        for (std::size_t b = 0; b <= buckets; ++b) {
+            offsets[b] = position;
+            position += counts[b];
+        }
+        for (I it = first; it != last; ++it) {
+            buffer[offsets[byte_at(view(*it), depth)]++] = std::ranges::iter_move(it);
+        }
+        std::ranges::move(buffer, buffer + n, first);
+
+        /* bucket 0 holds the strings that ended, which are equal */
+        I bucket_first = first + static_cast<std::ptrdiff_t>(counts[0]);
+        for (std::size_t b = 1; b <= buckets; ++b) {
+            const I bucket_last = bucket_first + static_cast<std::ptrdiff_t>(counts[b]);
+            if (counts[b] > 1) {
+                msd_sort(bucket_first, bucket_last, buffer, depth + 1, proj);
+            }
+            bucket_first = bucket_last;
+        }
+        return;
+    }
+}
+
+} // util::algorithm::detail::radix
+
+/**
+ * @brief Sort integer or floating-point keys with LSD radix passes.
+ */
+template<std::ranges::contiguous_range R>
+requires radix_key<std::ranges::range_value_t<R>>
+void radix_sort(R&& keys) {
+    using T = std::ranges::range_value_t<R>;
+    T* const data = std::ranges::data(keys);
+    const std::size_t n = std::ranges::size(keys);
+    if (n < 2) {
+        return;
+    }
+    const std::unique_ptr<T[]> buffer = std::make_unique_for_overwrite<T[]>(n);
+    const auto key_of = [](const T key) { return detail::radix::to_unsigned(key); };
+    detail::radix::sort_keys(data, buffer.get(), n, key_of, sizeof(T));
+    return;
+}
+
+/**
+ * @brief Stable sort of records by the numeric key proj(record): the keys are
+ * sorted with their record indices as payload, then the records are moved once.
+ */
+template<std::ranges::random_access_range R, typename Proj>
+requires radix_key<std::remove_cvref_t<std::indirect_result_t<Proj&, std::ranges::iterator_t<R>>>>
+      && std::movable<std::ranges::range_value_t<R>>
+void radix_sort(R&& records, Proj proj) {
+    using V = std::ranges::range_value_t<R>;
+    const auto first = std::ranges::begin(records);
+    const auto pairs = detail::radix::sorted_key_indices(first, std::ranges::end(records), proj);
+    std::vector<V> sorted;
+    sorted.reserve(pairs.size());
+    for (const auto& pair : pairs) {
+        sorted.push_back(std::ranges::iter_move(first + static_cast<std::ptrdiff_t>(pair.index)));
+    }
+    std::ranges::move(sorted, first);
+    return;
+}
+
+/**
+ * @brief The permutation that stably sorts `keys`: keys[result[0]] is the smallest.
+ * Sorting these small pairs and gathering the records afterwards is cheaper than
+ * moving large records through every pass.
+ */
+template<std::ranges::random_access_range R, typename Proj = std::identity>
+requires radix_key<std::remove_cvref_t<std::indirect_result_t<Proj&, std::ranges::iterator_t<R>>>>
+std::vector<std::uint32_t> radix_sort_indices(R&& keys, Proj proj = {}) {
+    const auto pairs = detail::radix::sorted_key_indices(std::ranges::begin(keys), std::ranges::end(keys), proj);
+    std::vector<std::uint32_t> indices(pairs.size());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        indices[i] = pairs[i].index;
+    }
+    return indices;
+}
+
+/**
+ * @brief Sort strings, or records by the string proj(record), in byte-wise
+ * lexicographic order with MSD radix passes. Not stable. The projection must
+ * return a reference or a view, not a temporary string.
+ */
+template<std::ranges::random_access_range R, typename Proj = std::identity>
+requires std::convertible_to<std::indirect_result_t<Proj&, std::ranges::iterator_t<R>>, std::string_view>
+      && std::movable<std::ranges::range_value_t<R>>
+      && std::default_initializable<std::ranges::range_value_t<R>>
+void msd_radix_sort(R&& strings, Proj proj = {}) {
+    using V = std::ranges::range_value_t<R>;
+    const auto first = std::ranges::begin(strings);
+    const auto last = std::ranges::next(first, std::ranges::end(strings));
+    if (last - first < 2) {
+        return;
+    }
+    std::vector<V> buffer(static_cast<std::size_t>(last - first));
+    detail::radix::msd_sort(first, last, buffer.data(), 0, proj);
+    return;
+}
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_RADIX_SORT_HPP
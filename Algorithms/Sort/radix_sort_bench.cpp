@@ -0,0 +1,110 @@
+/**
+ * @file radix_sort_bench.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Radix sorts against comparison sorts on integer, floating-point,
+ * string and record keys.
+ *
+ * To compile and run on Linux with Makefile:
+ * $ make radixsortbench
+ * $ ./radixsortbench [key_count]
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "radix_sort.hpp"
+
+namespace {
+
+struct record {
+    std::uint64_t key;
+    char payload[56];
+};
+
+/* million keys per second of one run of `sorter` on a copy of `input` */
+template<typename T, typename Sorter, typename Less = std::ranges::less>
+double rate(const std::vector<T>& input, Sorter sorter, Less less = {}) {
+    std::vector<T> values = input;
+    const auto begin = std::chrono::steady_clock::now();
+    sorter(values);
+    const auto end = std::chrono::steady_clock::now();
+    if (!std::ranges::is_sorted(values, less)) {
+        std::fprintf(stderr, "output is not sorted\n");
+        std::exit(EXIT_FAILURE);
+    }
+    return static_cast<double>(values.size()) / std::chrono::duration<double>(end - begin).count() / 1e6;
+}
+
+template<typename T>
+void bench_numeric(const char* const type, const std::size_t count) {
+    std::mt19937_64 engine(2021);
+    std::vector<T> input(count);
+    for (T& key : input) {
+        if constexpr (std::is_floating_point_v<T>) {
+            key = static_cast<T>(static_cast<double>(static_cast<std::int64_t>(engine())) * 1e-6);
+        }
+        else {
+            key = static_cast<T>(engine());
+        }
+    }
+    const double standard = rate(input, [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+    const double pdq = rate(input, [](std::vector<T>& v) { util::algorithm::pdq_sort(v); });
+    const double direct = rate(input, [](std::vector<T>& v) {
+        const std::unique_ptr<T[]> buffer = std::make_unique_for_overwrite<T[]>(v.size());
+        const auto key_of = [](const T key) { return util::algorithm::detail::radix::to_unsigned(key); };
+        util::algorithm::detail::radix::lsd_sort(v.data(), buffer.get(), v.size(), key_of, sizeof(T), false);
+    });
+    const double combined = rate(input, [](std::vector<T>& v) { util::algorithm::radix_sort(v); });
+    std::printf("%-8s %10.1f %10.1f %10.1f %10.1f %8.2fx\n", type, standard, pdq, direct, combined, combined / pdq);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::printf("%zu keys, million keys per second\n", count);
+    std::printf("%-8s %10s %10s %10s %10s %9s\n", "key", "std::sort", "pdq_sort", "lsd only", "radix", "vs pdq");
+    bench_numeric<std::uint32_t>("uint32", count);
+    bench_numeric<std::int32_t>("int32", count);
+    bench_numeric<std::uint64_t>("uint64", count);
+    bench_numeric<std::int64_t>("int64", count);
+    bench_numeric<float>("float", count);
+    bench_numeric<double>("double", count);
+
+    /* 64-byte records: sorting (key, index) pairs, then moving each record once */
+    std::mt19937_64 engine(2021);
+    std::vector<record> records(count / 4);
+    for (record& r : records) {
+        r.key = engine();
+    }
+    const auto by_key = [](const record& lhs, const record& rhs) { return lhs.key < rhs.key; };
+    const double records_std = rate(records, [&](std::vector<record>& v) { std::sort(v.begin(), v.end(), by_key); }, by_key);
+    const double records_radix = rate(records, [](std::vector<record>& v) { util::algorithm::radix_sort(v, &record::key); }, by_key);
+    std::printf("\n%zu 64-byte records by a 64-bit key: std::sort %.1f, radix_sort %.1f million/s (%.2fx)\n",
+        records.size(), records_std, records_radix, records_radix / records_std);
+
+    /* strings with a shared prefix, as in file paths or URLs */
+    std::vector<std::string> strings(count / 10);
+    for (std::string& s : strings) {
+        s = "/data/batch/" + std::to_string(engine() % 1000) + "/item-" + std::to_string(engine());
+    }
+    const double strings_std = rate(strings, [](std::vector<std::string>& v) { std::sort(v.begin(), v.end()); });
+    const double strings_msd = rate(strings, [](std::vector<std::string>& v) { util::algorithm::msd_radix_sort(v); });
+    std::printf("%zu strings: std::sort %.1f, msd_radix_sort %.1f million/s (%.2fx)\n",
+        strings.size(), strings_std, strings_msd, strings_msd / strings_std);
+    return 0;
+}
@@ -0,0 +1,310 @@
+/**
+ * @file selection.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Selection algorithms for when only part of the order is needed,
+ * called the same way as the sorts:
+ *
+ *   util::algorithm::nth_element(values, values.begin() + values.size() / 2);
+ *   util::algorithm::partial_sort(records, records.begin() + 100, {}, &record::score);
+ *   auto best = util::algorithm::top_k(std::istream_iterator<int>(in), {}, 100, std::ranges::greater{});
+ *
+ *   nth_element   introselect: quickselect with pdqsort's pivots and
+ *                 partitions, switching to median-of-medians pivots once it
+ *                 has partitioned 4n elements; O(n) in the worst case
+ *   partial_sort  heap select for small k, else nth_element; then pdq_sort
+ *                 of the first k: O(n + k log k) in the worst case
+ *   top_k         one pass over an input range of any length, keeping the
+ *                 best k so far in a bounded heap: O(k) memory, O(n) expected
+ *                 on random order, O(n log k) when every element improves it
+ *
+ * "Best" means first in the comparator's order, so the default selects the
+ * k smallest and std::ranges::greater{} the k largest.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_SELECTION_HPP
+#define UTIL_ALGORITHM_SELECTION_HPP
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "sort.hpp"
+
+namespace util::algorithm {
+
+namespace detail::select {
+
+/* groups of five elements per median in median-of-medians */
+inline constexpr std::ptrdiff_t group_size = 5;
+
+/* elements quickselect may partition, as a multiple of the input size, before pivots come from median_of_medians */
+inline constexpr std::ptrdiff_t work_factor = 4;
+/* partial_sort tries heap_select when k is at most n / heap_select_ratio */
+inline constexpr std::ptrdiff_t heap_select_ratio = 16;
+
+template<std::random_access_iterator I, typename Less>
+constexpr void introselect(I begin, I nth, I end, Less& less, std::ptrdiff_t work_allowed);
+
+/**
+ * @brief Move an approximate median of [begin, end) to *begin, one that at
+ * least 3/10 of the elements are not less than and 3/10 not greater than.
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr void median_of_medians(I begin, I end, Less& less) {
+    const std::ptrdiff_t groups = (end - begin) / group_size;
+    for (std::ptrdiff_t g = 0; g < groups; ++g) {
+        I group = begin + g * group_size;
+        insertion_sort(group, group + group_size, less);
+        std::ranges::iter_swap(begin + g, group + group_size / 2);
+    }
+    I median = begin + groups / 2;
+    introselect(begin, median, begin + groups, less, std::ptrdiff_t{ 0 });
+    std::ranges::iter_swap(begin, median);
+    return;
+}
+
+/**
+ * @brief Rearrange [begin, end) so that *nth is the element a full sort would
+ * put there, with nothing greater before it and nothing less after it.
+ * Each partition keeps only the side holding nth. Once the partitions have
+ * covered work_allowed elements, pivots come from median_of_medians, which
+ * bounds the total work by O(n) whatever the pivots were before.
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr void introselect(I begin, I nth, I end, Less& less, std::ptrdiff_t work_allowed) {
+    /* whether an element before begin is not greater than anything in the range */
+    bool leftmost = true;
+    while (true) {
+        const std::ptrdiff_t size = end - begin;
+        if (size < pdq::insertion_sort_threshold) {
+            insertion_sort(begin, end, less);
+            return;
+        }
+
+        /* leave the pivot in *begin; the median of three keeps partition_right's scans bounded */
+        const std::ptrdiff_t s2 = size / 2;
+        work_allowed -= size;
+        if (work_allowed < 0) {
+            median_of_medians(begin, end, less);
+        }
+        else if (size > pdq::ninther_threshold) {
+            pdq::sort3(begin, begin + s2, end - 1, less);
+            pdq::sort3(begin + 1, begin + (s2 - 1), end - 2, less);
+            pdq::sort3(begin + 2, begin + (s2 + 1), end - 3, less);
+            pdq::sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), less);
+            std::ranges::iter_swap(begin, begin + s2);
+        }
+        else {
+            pdq::sort3(begin + s2, begin, end - 1, less);
+        }
+
+        /* the pivot equals the parent's: take the run of equal elements off the front */
+        if (!leftmost && !less(*(begin - 1), *begin)) {
+            const I equal_end = pdq::partition_left(begin, end, less) + 1;
+            if (nth < equal_end) {
+                return;
+            }
+            begin = equal_end;
+            continue;
+        }
+
+        const I pivot_pos = pdq::partition_right(begin, end, less).first;
+        if (nth == pivot_pos) {
+            return;
+        }
+        if (nth < pivot_pos) {
+            end = pivot_pos;
+        }
+        else {
+            begin = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+}
+
+/**
+ * @brief Keep the smallest middle - first elements of [first, last) in a
+ * max-heap in [first, middle), replacing its top with every smaller element.
+ * On random input few elements replace the top, so this is one comparison
+ * per element; it gives up once the replacements would cost more than about
+ * n comparisons, leaving the range permuted.
+ * @return whether [first, middle) holds the smallest elements
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr bool heap_select(I first, I middle, I last, Less& less) {
+    const std::iter_difference_t<I> k = middle - first;
+    std::iter_difference_t<I> replacements_allowed =
+        (last - first) / std::bit_width(static_cast<std::make_unsigned_t<std::iter_difference_t<I>>>(k));
+    make_heap(first, middle, less);
+    for (I i = middle; i != last; ++i) {
+        if (less(*i, *first)) {
+            if (--replacements_allowed < 0) {
+                return false;
+            }
+            std::ranges::iter_swap(i, first);
+            sift_down(first, k, std::iter_difference_t<I>{ 0 }, less);
+        }
+    }
+    return true;
+}
+
+} // util::algorithm::detail::select
+
+/**
+ * @brief Partially sort [first, last) so that *nth is the element a full sort
+ * would put there, every element before it not greater and every element
+ * after it not less. O(n) comparisons in the worst case.
+ */
+struct nth_element_fn {
+    template<std::random_access_iterator I, std::sentinel_for<I> S,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<I, Comp, Proj>
+    constexpr I operator () (I first, I nth, S last, Comp comp = {}, Proj proj = {}) const {
+        I last_it = std::ranges::next(first, last);
+        if (nth != last_it) {
+            detail::projected_less less{ comp, proj };
+            detail::select::introselect(first, nth, last_it, less, detail::select::work_factor * (last_it - first));
+        }
+        return last_it;
+    }
+
+    template<std::ranges::random_access_range R,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+    constexpr std::ranges::borrowed_iterator_t<R> operator () (R&& r, std::ranges::iterator_t<R> nth,
+                                                               Comp comp = {}, Proj proj = {}) const {
+        return (*this)(std::ranges::begin(r), std::move(nth), std::ranges::end(r), std::move(comp), std::move(proj));
+    }
+};
+
+inline constexpr nth_element_fn nth_element{};
+
+/**
+ * @brief Sort the smallest middle - first elements of [first, last) into
+ * [first, middle), leaving the rest in unspecified order. O(n + k log k):
+ * small k try a heap select first, which is faster on random input, and
+ * fall back to introselect when too many elements enter the heap.
+ */
+struct partial_sort_fn {
+    template<std::random_access_iterator I, std::sentinel_for<I> S,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<I, Comp, Proj>
+    constexpr I operator () (I first, I middle, S last, Comp comp = {}, Proj proj = {}) const {
+        I last_it = std::ranges::next(first, last);
+        if (first == middle) {
+            return last_it;
+        }
+        detail::projected_less less{ comp, proj };
+        const std::iter_difference_t<I> length = last_it - first;
+        const bool small_k = (middle - first) <= length / detail::select::heap_select_ratio;
+        if (!(small_k && detail::select::heap_select(first, middle, last_it, less)) && middle != last_it) {
+            detail::select::introselect(first, middle, last_it, less, detail::select::work_factor * length);
+        }
+        pdq_sort(first, middle, std::move(comp), std::move(proj));
+        return last_it;
+    }
+
+    template<std::ranges::random_access_range R,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+    constexpr std::ranges::borrowed_iterator_t<R> operator () (R&& r, std::ranges::iterator_t<R> middle,
+                                                               Comp comp = {}, Proj proj = {}) const {
+        return (*this)(std::ranges::begin(r), std::move(middle), std::ranges::end(r), std::move(comp), std::move(proj));
+    }
+};
+
+inline constexpr partial_sort_fn partial_sort{};
+
+/**
+ * @brief The best k values pushed so far, for streams too long to store.
+ * A heap with the worst kept value on top rejects most values of a random
+ * stream with a single comparison.
+ */
+template<std::movable T, typename Comp = std::ranges::less, typename Proj = std::identity>
+requires std::sortable<typename std::vector<T>::iterator, Comp, Proj>
+class top_k_heap {
+public:
+    explicit top_k_heap(const std::size_t k, Comp comp = {}, Proj proj = {})
+        : k_(k), comp_(std::move(comp)), proj_(std::move(proj)) {
+        heap_.reserve(k);
+    }
+
+    std::size_t size() const { return heap_.size(); }
+    bool full() const { return heap_.size() == k_; }
+
+    /* the k-th best value so far, which a value must beat to be kept; requires full() */
+    const T& threshold() const { return heap_.front(); }
+
+    template<typename U>
+    requires std::constructible_from<T, U&&>
+    void push(U&& value) {
+        detail::projected_less less{ comp_, proj_ };
+        if (heap_.size() < k_) {
+            heap_.emplace_back(std::forward<U>(value));
+            if (heap_.size() == k_) {
+                detail::make_heap(heap_.begin(), heap_.end(), less);
+            }
+        }
+        else if (k_ != 0 && less(value, heap_.front())) {
+            heap_.front() = std::forward<U>(value);
+            detail::sift_down(heap_.begin(), static_cast<std::ptrdiff_t>(k_), std::ptrdiff_t{ 0 }, less);
+        }
+        return;
+    }
+
+    /* the values kept, best first */
+    std::vector<T> take_sorted() && {
+        pdq_sort(heap_, comp_, proj_);
+        return std::move(heap_);
+    }
+
+private:
+    std::size_t k_;
+    Comp comp_;
+    Proj proj_;
+    std::vector<T> heap_;
+};
+
+/**
+ * @brief The best k elements of a single-pass input range, best first,
+ * using a top_k_heap; the input is read once and never stored.
+ */
+struct top_k_fn {
+    template<std::input_iterator I, std::sentinel_for<I> S,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::indirect_strict_weak_order<Comp, std::projected<I, Proj>>
+          && std::sortable<typename std::vector<std::iter_value_t<I>>::iterator, Comp, Proj>
+    std::vector<std::iter_value_t<I>> operator () (I first, S last, const std::size_t k, Comp comp = {}, Proj proj = {}) const {
+        top_k_heap<std::iter_value_t<I>, Comp, Proj> heap(k, std::move(comp), std::move(proj));
+        for (; first != last; ++first) {
+            heap.push(*first);
+        }
+        return std::move(heap).take_sorted();
+    }
+
+    template<std::ranges::input_range R,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::indirect_strict_weak_order<Comp, std::projected<std::ranges::iterator_t<R>, Proj>>
+          && std::sortable<typename std::vector<std::ranges::range_value_t<R>>::iterator, Comp, Proj>
+    std::vector<std::ranges::range_value_t<R>> operator () (R&& r, const std::size_t k, Comp comp = {}, Proj proj = {}) const {
+        return (*this)(std::ranges::begin(r), std::ranges::end(r), k, std::move(comp), std::move(proj));
+    }
+};
+
+inline constexpr top_k_fn top_k{};
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_SELECTION_HPP
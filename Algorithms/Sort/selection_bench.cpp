@@ -0,0 +1,116 @@
+/**
+ * @file selection_bench.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Top-k queries answered by a full sort, by partial sorts, by
+ * nth_element and by the streaming top_k, for growing k.
+ *
+ * To compile and run on Linux with Makefile:
+ * $ make selectionbench
+ * $ ./selectionbench [key_count]
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "selection.hpp"
+
+namespace {
+
+/* milliseconds of one run of `query` on a copy of `input`; `valid` checks the vector it returns */
+template<typename Query, typename Valid>
+double milliseconds(const std::vector<std::int64_t>& input, Query query, Valid valid) {
+    std::vector<std::int64_t> keys = input;
+    const auto begin = std::chrono::steady_clock::now();
+    const std::vector<std::int64_t>& result = query(keys);
+    const auto end = std::chrono::steady_clock::now();
+    if (!valid(result)) {
+        std::fprintf(stderr, "wrong answer\n");
+        std::exit(EXIT_FAILURE);
+    }
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::mt19937_64 engine(2021);
+    std::vector<std::int64_t> input(count);
+    std::ranges::generate(input, [&]() { return static_cast<std::int64_t>(engine()); });
+    std::vector<std::int64_t> sorted = input;
+    std::ranges::sort(sorted);
+
+    std::printf("smallest k of %zu random int64 keys, milliseconds\n", count);
+    std::printf("%9s %10s %13s %13s %13s %13s %10s\n",
+        "k", "pdq_sort", "std::partial", "partial_sort", "std::nth", "nth_element", "top_k");
+    for (const std::size_t k : { std::size_t{ 10 }, std::size_t{ 100 }, std::size_t{ 10000 }, count / 10 }) {
+        const auto nth = static_cast<std::ptrdiff_t>(k);
+        /* the k smallest in order in front, or the k-th smallest at position k */
+        const auto smallest_sorted = [&sorted, nth](const std::vector<std::int64_t>& v) {
+            return std::equal(v.begin(), v.begin() + nth, sorted.begin());
+        };
+        const auto nth_in_place = [&sorted, nth](const std::vector<std::int64_t>& v) { return v[nth] == sorted[nth]; };
+        std::vector<std::int64_t> streamed;
+
+        const double full = milliseconds(input, [](std::vector<std::int64_t>& v) -> auto& {
+            util::algorithm::pdq_sort(v);
+            return v;
+        }, smallest_sorted);
+        const double std_partial = milliseconds(input, [nth](std::vector<std::int64_t>& v) -> auto& {
+            std::partial_sort(v.begin(), v.begin() + nth, v.end());
+            return v;
+        }, smallest_sorted);
+        const double partial = milliseconds(input, [nth](std::vector<std::int64_t>& v) -> auto& {
+            util::algorithm::partial_sort(v, v.begin() + nth);
+            return v;
+        }, smallest_sorted);
+        const double std_nth = milliseconds(input, [nth](std::vector<std::int64_t>& v) -> auto& {
+            std::nth_element(v.begin(), v.begin() + nth, v.end());
+            return v;
+        }, nth_in_place);
+        const double nth_element = milliseconds(input, [nth](std::vector<std::int64_t>& v) -> auto& {
+            util::algorithm::nth_element(v, v.begin() + nth);
+            return v;
+        }, nth_in_place);
+        const double top = milliseconds(input, [k, &streamed](std::vector<std::int64_t>& v) -> auto& {
+            streamed = util::algorithm::top_k(v, k);
+            return streamed;
+        }, smallest_sorted);
+        std::printf("%9zu %10.1f %13.1f %13.1f %13.1f %13.1f %10.1f\n", k, full, std_partial, partial, std_nth, nth_element, top);
+    }
+
+    /* every key improves the top k when the smallest come last: top_k's O(n log k) case */
+    std::vector<std::int64_t> descending = sorted;
+    std::ranges::reverse(descending);
+    std::vector<std::int64_t> streamed;
+    const double worst = milliseconds(descending, [&streamed](std::vector<std::int64_t>& v) -> auto& {
+        streamed = util::algorithm::top_k(v, 100);
+        return streamed;
+    }, [&sorted](const std::vector<std::int64_t>& v) { return std::equal(v.begin(), v.end(), sorted.begin()); });
+    const auto first_100_sorted = [&sorted](const std::vector<std::int64_t>& v) {
+        return std::equal(v.begin(), v.begin() + 100, sorted.begin());
+    };
+    const double std_partial = milliseconds(descending, [](std::vector<std::int64_t>& v) -> auto& {
+        std::partial_sort(v.begin(), v.begin() + 100, v.end());
+        return v;
+    }, first_100_sorted);
+    const double partial = milliseconds(descending, [](std::vector<std::int64_t>& v) -> auto& {
+        util::algorithm::partial_sort(v, v.begin() + 100);
+        return v;
+    }, first_100_sorted);
+    std::printf("\nsmallest 100 of descending keys, where every key enters a heap: "
+        "std::partial_sort %.1f ms, partial_sort %.1f ms, top_k %.1f ms\n", std_partial, partial, worst);
+    return 0;
+}
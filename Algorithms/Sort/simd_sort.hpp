@@ -0,0 +1,373 @@
+/**
+ * @file simd_sort.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Vectorised sort of 32- and 64-bit integer keys in ascending order:
+ *
+ *   util::algorithm::simd_sort(keys);
+ *   util::algorithm::simd_sort(keys.data(), keys.data() + keys.size());
+ *
+ * Blocks of up to 256 keys are loaded into vector registers, padded with the
+ * largest key, and sorted by a bitonic sorting network built from min/max
+ * and lane shuffles, without a single data-dependent branch. Longer inputs
+ * are sorted block by block and merged bottom-up, two registers at a time,
+ * with a bitonic merge network.
+ *
+ * The instruction set is chosen once at run time: AVX-512F, else AVX2, else
+ * the scalar pdq_sort. The vector kernels need GCC on x86; other compilers
+ * always take the scalar path.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_SIMD_SORT_HPP
+#define UTIL_ALGORITHM_SIMD_SORT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "pdqsort.hpp"
+
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#define UTIL_SIMD_SORT_X86 1
+#include <immintrin.h>
+#else
+#define UTIL_SIMD_SORT_X86 0
+#endif
+
+namespace util::algorithm {
+
+enum class simd_level { scalar, avx2, avx512 };
+
+template<typename T>
+concept simd_sortable_key = std::same_as<T, std::int32_t> || std::same_as<T, std::uint32_t>
+                         || std::same_as<T, std::int64_t> || std::same_as<T, std::uint64_t>;
+
+namespace detail::simd {
+
+/* keys sorted by one network before merging starts */
+inline constexpr std::size_t block_size = 256;
+
+/* lanes whose partner in a compare-exchange at distance J lies above them */
+template<int Lanes, int J>
+constexpr unsigned lower_lanes() {
+    unsigned bits = 0;
+    for (int lane = 0; lane < Lanes; ++lane) {
+        bits |= ((lane & J) == 0 ? 1u : 0u) << lane;
+    }
+    return bits;
+}
+
+/* lanes that keep the minimum at step (K, J) of a network spanning less than one register */
+template<int Lanes, int K, int J>
+constexpr unsigned min_lanes() {
+    unsigned bits = 0;
+    for (int lane = 0; lane < Lanes; ++lane) {
+        bits |= (((lane & J) == 0) != ((lane & K) != 0) ? 1u : 0u) << lane;
+    }
+    return bits;
+}
+
+#if UTIL_SIMD_SORT_X86
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+
+namespace avx2 {
+
+template<bool Signed>
+struct vec32 {
+    using value_type = std::conditional_t<Signed, std::int32_t, std::uint32_t>;
+    using reg = __m256i;
+    static constexpr int lanes = 8;
+
+    static reg load(const value_type* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(value_type* p, const reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+    static void minmax(const reg a, const reg b, reg& lo, reg& hi) {
+        if constexpr (Signed) {
+            lo = _mm256_min_epi32(a, b);
+            hi = _mm256_max_epi32(a, b);
+        }
+        else {
+            lo = _mm256_min_epu32(a, b);
+            hi = _mm256_max_epu32(a, b);
+        }
+    }
+
+    /* exchange every lane with lane ^ J */
+    template<int J>
+    static reg swap_lanes(const reg v) {
+        if constexpr (J == 1) {
+            return _mm256_shuffle_epi32(v, 0xB1);
+        }
+        else if constexpr (J == 2) {
+            return _mm256_shuffle_epi32(v, 0x4E);
+        }
+        else {
+            return _mm256_permute2x128_si256(v, v, 0x01);
+        }
+    }
+
+    /* lanes set in Bits from lo, the others from hi */
+    template<unsigned Bits>
+    static reg select(const reg lo, const reg hi) { return _mm256_blend_epi32(hi, lo, Bits); }
+
+    static reg reverse(const reg v) { return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); }
+};
+
+template<bool Signed>
+struct vec64 {
+    using value_type = std::conditional_t<Signed, std::int64_t, std::uint64_t>;
+    using reg = __m256i;
+    static constexpr int lanes = 4;
+
+    static reg load(const value_type* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(value_type* p, const reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+    /* AVX2 has no 64-bit min/max: compare once and blend both ways */
+    static void minmax(const reg a, const reg b, reg& lo, reg& hi) {
+        reg greater;
+        if constexpr (Signed) {
+            greater = _mm256_cmpgt_epi64(a, b);
+        }
+        else {
+            const reg flip = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+            greater = _mm256_cmpgt_epi64(_mm256_xor_si256(a, flip), _mm256_xor_si256(b, flip));
+        }
+        lo = _mm256_blendv_epi8(a, b, greater);
+        hi = _mm256_blendv_epi8(b, a, greater);
+    }
+
+    template<int J>
+    static reg swap_lanes(const reg v) {
+        if constexpr (J == 1) {
+            return _mm256_shuffle_epi32(v, 0x4E);
+        }
+        else {
+            return _mm256_permute4x64_epi64(v, 0x4E);
+        }
+    }
+
+    /* one 64-bit lane is two 32-bit blend lanes */
+    template<unsigned Bits>
+    static reg select(const reg lo, const reg hi) {
+        constexpr int bits32 = ((Bits & 1) ? 0x03 : 0) | ((Bits & 2) ? 0x0C : 0) | ((Bits & 4) ? 0x30 : 0) | ((Bits & 8) ? 0xC0 : 0);
+        return _mm256_blend_epi32(hi, lo, bits32);
+    }
+
+    static reg reverse(const reg v) { return _mm256_permute4x64_epi64(v, 0x1B); }
+};
+
+#include "simd_sort_kernels.ipp"
+
+} // util::algorithm::detail::simd::avx2
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+
+namespace avx512 {
+
+template<bool Signed>
+struct vec32 {
+    using value_type = std::conditional_t<Signed, std::int32_t, std::uint32_t>;
+    using reg = __m512i;
+    static constexpr int lanes = 16;
+    static constexpr __mmask16 all = 0xFFFF;     /* the unmasked forms trip GCC 12 bug 105593 under -Wall */
+
+    static reg load(const value_type* p) { return _mm512_loadu_si512(p); }
+    static void store(value_type* p, const reg v) { _mm512_storeu_si512(p, v); }
+
+    static void minmax(const reg a, const reg b, reg& lo, reg& hi) {
+        if constexpr (Signed) {
+            lo = _mm512_mask_min_epi32(a, all, a, b);
+            hi = _mm512_mask_max_epi32(a, all, a, b);
+        }
+        else {
+            lo = _mm512_mask_min_epu32(a, all, a, b);
+            hi = _mm512_mask_max_epu32(a, all, a, b);
+        }
+    }
+
+    template<int J>
+    static reg swap_lanes(const reg v) {
+        if constexpr (J == 1) {
+            return _mm512_mask_shuffle_epi32(v, all, v, static_cast<_MM_PERM_ENUM>(0xB1));
+        }
+        else if constexpr (J == 2) {
+            return _mm512_mask_shuffle_epi32(v, all, v, static_cast<_MM_PERM_ENUM>(0x4E));
+        }
+        else if constexpr (J == 4) {
+            return _mm512_mask_shuffle_i32x4(v, all, v, v, 0xB1);
+        }
+        else {
+            return _mm512_mask_shuffle_i32x4(v, all, v, v, 0x4E);
+        }
+    }
+
+    template<unsigned Bits>
+    static reg select(const reg lo, const reg hi) { return _mm512_mask_blend_epi32(static_cast<__mmask16>(Bits), hi, lo); }
+
+    static reg reverse(const reg v) {
+        return _mm512_mask_permutexvar_epi32(v, all, _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+    }
+};
+
+template<bool Signed>
+struct vec64 {
+    using value_type = std::conditional_t<Signed, std::int64_t, std::uint64_t>;
+    using reg = __m512i;
+    static constexpr int lanes = 8;
+    static constexpr __mmask8 all = 0xFF;
+
+    static reg load(const value_type* p) { return _mm512_loadu_si512(p); }
+    static void store(value_type* p, const reg v) { _mm512_storeu_si512(p, v); }
+
+    static void minmax(const reg a, const reg b, reg& lo, reg& hi) {
+        if constexpr (Signed) {
+            lo = _mm512_mask_min_epi64(a, all, a, b);
+            hi = _mm512_mask_max_epi64(a, all, a, b);
+        }
+        else {
+            lo = _mm512_mask_min_epu64(a, all, a, b);
+            hi = _mm512_mask_max_epu64(a, all, a, b);
+        }
+    }
+
+    template<int J>
+    static reg swap_lanes(const reg v) {
+        if constexpr (J == 1) {
+            return _mm512_mask_shuffle_epi32(v, static_cast<__mmask16>(0xFFFF), v, static_cast<_MM_PERM_ENUM>(0x4E));
+        }
+        else if constexpr (J == 2) {
+            return _mm512_mask_shuffle_i64x2(v, all, v, v, 0xB1);
+        }
+        else {
+            return _mm512_mask_shuffle_i64x2(v, all, v, v, 0x4E);
+        }
+    }
+
+    template<unsigned Bits>
+    static reg select(const reg lo, const reg hi) { return _mm512_mask_blend_epi64(static_cast<__mmask8>(Bits), hi, lo); }
+
+    static reg reverse(const reg v) { return _mm512_mask_permutexvar_epi64(v, all, _mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), v); }
+};
+
+#include "simd_sort_kernels.ipp"
+
+} // util::algorithm::detail::simd::avx512
+
+#pragma GCC pop_options
+
+#endif // UTIL_SIMD_SORT_X86
+
+template<simd_sortable_key T>
+void sort_scalar(T* data, std::size_t n) {
+    pdq_sort(data, data + n);
+    return;
+}
+
+#if UTIL_SIMD_SORT_X86
+
+template<simd_sortable_key T>
+__attribute__((target("avx2"))) void sort_avx2(T* data, std::size_t n) {
+    if constexpr (sizeof(T) == 4) {
+        avx2::sort<avx2::vec32<std::is_signed_v<T>>>(data, n);
+    }
+    else {
+        avx2::sort<avx2::vec64<std::is_signed_v<T>>>(data, n);
+    }
+    return;
+}
+
+template<simd_sortable_key T>
+__attribute__((target("avx512f"))) void sort_avx512(T* data, std::size_t n) {
+    if constexpr (sizeof(T) == 4) {
+        avx512::sort<avx512::vec32<std::is_signed_v<T>>>(data, n);
+    }
+    else {
+        avx512::sort<avx512::vec64<std::is_signed_v<T>>>(data, n);
+    }
+    return;
+}
+
+#endif // UTIL_SIMD_SORT_X86
+
+inline simd_level detect_level() {
+#if UTIL_SIMD_SORT_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return simd_level::avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return simd_level::avx2;
+    }
+#endif
+    return simd_level::scalar;
+}
+
+} // util::algorithm::detail::simd
+
+/**
+ * @brief The best instruction set this processor supports, detected on first use.
+ */
+inline simd_level simd_sort_level() {
+    static const simd_level level = detail::simd::detect_level();
+    return level;
+}
+
+/**
+ * @brief Sort keys with the given instruction set; a level above simd_sort_level()
+ * is lowered to it, so the call never executes an unsupported instruction.
+ */
+template<std::ranges::contiguous_range R>
+requires simd_sortable_key<std::ranges::range_value_t<R>>
+void simd_sort(R&& keys, simd_level level) {
+    using T = std::ranges::range_value_t<R>;
+    T* const data = std::ranges::data(keys);
+    const std::size_t n = std::ranges::size(keys);
+    level = std::min(level, simd_sort_level());
+#if UTIL_SIMD_SORT_X86
+    if (level == simd_level::avx512) {
+        detail::simd::sort_avx512(data, n);
+        return;
+    }
+    if (level == simd_level::avx2) {
+        detail::simd::sort_avx2(data, n);
+        return;
+    }
+#endif
+    detail::simd::sort_scalar(data, n);
+    return;
+}
+
+template<std::ranges::contiguous_range R>
+requires simd_sortable_key<std::ranges::range_value_t<R>>
+void simd_sort(R&& keys) {
+    simd_sort(std::forward<R>(keys), simd_sort_level());
+    return;
+}
+
+template<simd_sortable_key T>
+void simd_sort(T* first, T* last) {
+    simd_sort(std::span<T>(first, last), simd_sort_level());
+    return;
+}
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_SIMD_SORT_HPP
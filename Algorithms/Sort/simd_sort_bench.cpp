@@ -0,0 +1,89 @@
+/**
+ * @file simd_sort_bench.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Throughput of simd_sort against scalar sorts when sorting many small
+ * arrays, and on one large array.
+ *
+ * To compile and run on Linux with Makefile:
+ * $ make simdsortbench
+ * $ ./simdsortbench [total_keys]
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "simd_sort.hpp"
+#include "sort.hpp"
+
+namespace {
+
+/* sort every `size`-key array of `input` in turn and return the rate in million keys per second */
+template<typename T, typename Sorter>
+double keys_per_second(const std::vector<T>& input, const std::size_t size, Sorter sorter) {
+    std::vector<T> keys = input;
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i + size <= keys.size(); i += size) {
+        sorter(keys.data() + i, keys.data() + i + size);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i + size <= keys.size(); i += size) {
+        if (!std::is_sorted(keys.data() + i, keys.data() + i + size)) {
+            std::fprintf(stderr, "output is not sorted\n");
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    return static_cast<double>(keys.size() / size * size) / std::chrono::duration<double>(end - begin).count() / 1e6;
+}
+
+template<typename T>
+void bench_type(const char* const type, const std::size_t total) {
+    std::mt19937_64 engine(2021);
+    std::vector<T> input(total);
+    std::ranges::generate(input, [&]() { return static_cast<T>(engine()); });
+
+    using util::algorithm::simd_level;
+    const simd_level best = util::algorithm::simd_sort_level();
+    for (const std::size_t size : { 16, 32, 64, 128, 256, 4096, 1 << 20 }) {
+        if (size > total) {
+            break;
+        }
+        const auto simd_at = [](const simd_level level) {
+            return [level](T* first, T* last) { util::algorithm::simd_sort(std::span<T>(first, last), level); };
+        };
+        const double insertion = size <= 256
+            ? keys_per_second(input, size, [](T* first, T* last) { util::algorithm::insertion_sort(first, last); })
+            : 0.0;
+        const double standard = keys_per_second(input, size, [](T* first, T* last) { std::sort(first, last); });
+        const double pdq = keys_per_second(input, size, [](T* first, T* last) { util::algorithm::pdq_sort(first, last); });
+        const double avx2 = best >= simd_level::avx2 ? keys_per_second(input, size, simd_at(simd_level::avx2)) : 0.0;
+        const double avx512 = best >= simd_level::avx512 ? keys_per_second(input, size, simd_at(simd_level::avx512)) : 0.0;
+        std::printf("%-6s %8zu %10.1f %10.1f %10.1f %10.1f %10.1f %8.2fx\n", type, size,
+            insertion, standard, pdq, avx2, avx512, std::max(avx2, avx512) / standard);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t total = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : (1 << 22);
+    static const char* const names[] = { "scalar", "AVX2", "AVX-512" };
+    std::printf("%zu keys per row, best instruction set: %s, million keys per second (0 = skipped)\n",
+        total, names[static_cast<int>(util::algorithm::simd_sort_level())]);
+    std::printf("%-6s %8s %10s %10s %10s %10s %10s %9s\n",
+        "type", "array", "insertion", "std::sort", "pdq_sort", "avx2", "avx512", "speedup");
+    bench_type<std::int32_t>("int32", total);
+    bench_type<std::int64_t>("int64", total);
+    return 0;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file simd_sort_kernels.ipp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Sorting network and merge kernels shared by every instruction set.
+ *
+ * Included by simd_sort.hpp once per instruction set, inside a namespace
+ * that defines the register types vec32 and vec64 and under the matching
+ * `#pragma GCC target`, so each copy is compiled for its own instructions.
+ * A register type V provides value_type, reg, lanes, load, store, minmax,
+ * swap_lanes<J>, select<Bits> and reverse.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+/**
+ * @brief Step (K, J) of a bitonic sorting network over R registers: every key
+ * is compare-exchanged with the key J positions away, and the pair is put in
+ * ascending order if the key's bit K is clear, in descending order otherwise.
+ */
+template<typename V, int R, int K, int J>
+inline void network_step(typename V::reg* r) {
+    constexpr int L = V::lanes;
+    if constexpr (J >= L) {
+        /* partners are the same lane of two registers */
+        for (int i = 0; i < R; ++i) {
+            if ((i & (J / L)) != 0) {
+                continue;
+            }
+            typename V::reg lo, hi;
+            V::minmax(r[i], r[i + J / L], lo, hi);
+            const bool descending = ((i * L) & K) != 0;
+            r[i] = descending ? hi : lo;
+            r[i + J / L] = descending ? lo : hi;
+        }
+    }
+    else {
+        /* partners are two lanes of one register */
+        for (int i = 0; i < R; ++i) {
+            typename V::reg lo, hi;
+            V::minmax(r[i], V::template swap_lanes<J>(r[i]), lo, hi);
+            if constexpr (K < L) {
+                r[i] = V::template select<min_lanes<L, K, J>()>(lo, hi);
+            }
+            else if (((i * L) & K) == 0) {
+                r[i] = V::template select<lower_lanes<L, J>()>(lo, hi);
+            }
+            else {
+                r[i] = V::template select<~lower_lanes<L, J>() & ((1u << L) - 1)>(lo, hi);
+            }
+        }
+    }
+    return;
+}
+
+/* steps (K, J), (K, J / 2), ..., (K, 1): merge bitonic sequences of length 2J */
+template<typename V, int R, int K, int J>
+inline void network_merge(typename V::reg* r) {
+    network_step<V, R, K, J>(r);
+    if constexpr (J > 1) {
+        network_merge<V, R, K, J / 2>(r);
+    }
+    return;
+}
+
+/* sort R * lanes keys held in registers, lowest key in lane 0 of r[0] */
+template<typename V, int R, int K = 2>
+inline void network_sort(typename V::reg* r) {
+    network_merge<V, R, K, K / 2>(r);
+    if constexpr (K < R * V::lanes) {
+        network_sort<V, R, 2 * K>(r);
+    }
+    return;
+}
+
+/**
+ * @brief Sort n <= R * lanes keys with one network, padding the tail with the largest key.
+ */
+template<typename V, int R>
+inline void sort_block(typename V::value_type* data, const std::size_t n) {
+    using T = typename V::value_type;
+    constexpr int L = V::lanes;
+    alignas(64) T buffer[R * L];
+    T* source = data;
+    if (n != static_cast<std::size_t>(R * L)) {
+        std::copy_n(data, n, buffer);
+        std::fill(buffer + n, buffer + R * L, std::numeric_limits<T>::max());
+        source = buffer;
+    }
+    typename V::reg r[R];
+    for (int i = 0; i < R; ++i) {
+        r[i] = V::load(source + i * L);
+    }
+    network_sort<V, R>(r);
+    for (int i = 0; i < R; ++i) {
+        V::store(source + i * L, r[i]);
+    }
+    if (source != data) {
+        std::copy_n(buffer, n, data);
+    }
+    return;
+}
+
+/* the smallest power-of-two register count that holds n keys */
+template<typename V, int R = 1>
+inline void sort_small(typename V::value_type* data, const std::size_t n) {
+    if constexpr (static_cast<std::size_t>(R * V::lanes) < block_size) {
+        if (n > static_cast<std::size_t>(R * V::lanes)) {
+            sort_small<V, 2 * R>(data, n);
+            return;
+        }
+    }
+    sort_block<V, R>(data, n);
+    return;
+}
+
+/**
+ * @brief Merge two sorted registers: a receives the lower half, b the upper half.
+ */
+template<typename V>
+inline void merge_registers(typename V::reg& a, typename V::reg& b) {
+    constexpr int L = V::lanes;
+    typename V::reg lo, hi;
+    V::minmax(a, V::reverse(b), lo, hi);     /* lo and hi are bitonic */
+    network_merge<V, 1, 2 * L, L / 2>(&lo);
+    network_merge<V, 1, 2 * L, L / 2>(&hi);
+    a = lo;
+    b = hi;
+    return;
+}
+
+/* load `lanes` keys from src[pos, n), padding past n with the largest key */
+template<typename V>
+inline typename V::reg load_chunk(const typename V::value_type* src, const std::size_t pos, const std::size_t n) {
+    using T = typename V::value_type;
+    constexpr std::size_t L = V::lanes;
+    if (pos + L <= n) {
+        return V::load(src + pos);
+    }
+    alignas(64) T buffer[L];
+    std::fill(buffer, buffer + L, std::numeric_limits<T>::max());
+    if (pos < n) {
+        std::copy(src + pos, src + n, buffer);
+    }
+    return V::load(buffer);
+}
+
+/**
+ * @brief Merge sorted [a, a + na) and [b, b + nb) into out. The register a always
+ * holds the smallest keys not yet written; each round refills it from the input
+ * whose next key is smaller. Tails are padded with the largest key, and padding
+ * is never written since only na + nb keys are.
+ */
+template<typename V>
+inline void merge(const typename V::value_type* a, const std::size_t na,
+                  const typename V::value_type* b, const std::size_t nb,
+                  typename V::value_type* out) {
+    using T = typename V::value_type;
+    constexpr std::size_t L = V::lanes;
+    if (na == 0 || nb == 0) {
+        std::copy_n(na == 0 ? b : a, na + nb, out);
+        return;
+    }
+    const std::size_t total = na + nb;
+    typename V::reg va = load_chunk<V>(a, 0, na);
+    typename V::reg vb = load_chunk<V>(b, 0, nb);
+    std::size_t ia = L, ib = L, written = 0;
+    while (true) {
+        merge_registers<V>(va, vb);
+        if (total - written < L) {
+            alignas(64) T buffer[L];
+            V::store(buffer, va);
+            std::copy_n(buffer, total - written, out + written);
+            return;
+        }
+        V::store(out + written, va);
+        written += L;
+        if (written == total) {
+            return;
+        }
+
+        const bool a_left = ia < na;
+        const bool b_left = ib < nb;
+        if (!a_left && !b_left) {
+            /* the rest is in vb */
+            alignas(64) T buffer[L];
+            V::store(buffer, vb);
+            std::copy_n(buffer, total - written, out + written);
+            return;
+        }
+        if (a_left && (!b_left || !(b[ib] < a[ia]))) {
+            va = load_chunk<V>(a, ia, na);
+            ia += L;
+        }
+        else {
+            va = load_chunk<V>(b, ib, nb);
+            ib += L;
+        }
+    }
+}
+
+/**
+ * @brief Sort blocks with the network, then merge pairs of runs bottom-up,
+ * alternating between the input and a scratch buffer.
+ */
+template<typename V>
+inline void sort(typename V::value_type* data, const std::size_t n) {
+    using T = typename V::value_type;
+    if (n <= block_size) {
+        sort_small<V>(data, n);
+        return;
+    }
+    for (std::size_t i = 0; i < n; i += block_size) {
+        sort_small<V>(data + i, std::min(block_size, n - i));
+    }
+
+    const std::unique_ptr<T[]> scratch = std::make_unique_for_overwrite<T[]>(n);
+    T* from = data;
+    T* to = scratch.get();
+    for (std::size_t width = block_size; width < n; width *= 2) {
+        for (std::size_t i = 0; i < n; i += 2 * width) {
+            const std::size_t mid = std::min(i + width, n);
+            const std::size_t end = std::min(i + 2 * width, n);
+            merge<V>(from + i, mid - i, from + mid, end - mid, to + i);
+        }
+        std::swap(from, to);
+    }
+    if (from != data) {
+        std::copy_n(from, n, data);
+    }
+    return;
+}
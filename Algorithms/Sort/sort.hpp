@@ -0,0 +1,253 @@
+/**
+ * @file sort.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Header-only sorting library templated on random-access iterators,
+ * a comparator and a projection, called the same way as std::ranges::sort:
+ *
+ *   util::algorithm::insertion_sort(records);
+ *   util::algorithm::insertion_sort(records, std::ranges::greater{});
+ *   util::algorithm::insertion_sort(records.begin(), records.end(), {}, &record::age);
+ *
+ * Every algorithm is a function object, so it can be passed around and
+ * does not take part in argument-dependent lookup.
+ *
+ * Complexity, n = last - first:
+ *   bubble_sort     O(n^2) comparisons and swaps, O(n) on sorted input, stable
+ *   selection_sort  O(n^2) comparisons, at most n - 1 swaps, not stable
+ *   insertion_sort  O(n + inversions) comparisons and moves, stable
+ *   heap_sort       O(n log n) comparisons and swaps in the worst case, not stable
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_SORT_HPP
+#define UTIL_ALGORITHM_SORT_HPP
+
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace util::algorithm {
+
+namespace detail {
+
+/**
+ * @brief Bind a comparator and a projection into one binary predicate on iterators' values.
+ */
+template<typename Comp, typename Proj>
+struct projected_less {
+    Comp& comp;
+    Proj& proj;
+
+    template<typename L, typename R>
+    constexpr bool operator () (L&& lhs, R&& rhs) const {
+        return std::invoke(comp, std::invoke(proj, std::forward<L>(lhs)), std::invoke(proj, std::forward<R>(rhs)));
+    }
+};
+
+template<typename Comp, typename Proj>
+projected_less(Comp&, Proj&) -> projected_less<Comp, Proj>;
+
+/**
+ * @brief An element moved out of the range, moved back into `hole` when it goes
+ * out of scope. Sorts that hold one element while comparing move the hole and
+ * let it write the element back, so a comparator that throws still leaves a
+ * permutation of the range.
+ */
+template<std::random_access_iterator I>
+struct held_element {
+    std::iter_value_t<I> value;
+    I hole;
+
+    constexpr explicit held_element(const I from) : value(std::ranges::iter_move(from)), hole(from) {}
+    held_element(const held_element&) = delete;
+    held_element& operator = (const held_element&) = delete;
+    constexpr ~held_element() { *hole = std::move(value); }
+};
+
+/**
+ * @brief Insertion sort of [first, last) with a bound predicate.
+ * Shared by insertion_sort and by the small-partition cutoff of larger sorts.
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr void insertion_sort(I first, I last, Less less) {
+    if (first == last) {
+        return;
+    }
+    for (I i = std::ranges::next(first); i != last; ++i) {
+        if (!less(*i, *std::ranges::prev(i))) {
+            continue;
+        }
+        held_element<I> held(i);
+        do {
+            *held.hole = std::ranges::iter_move(std::ranges::prev(held.hole));
+            --held.hole;
+        } while (held.hole != first && less(held.value, *std::ranges::prev(held.hole)));
+    }
+    return;
+}
+
+/**
+ * @brief Insertion sort without the lower bound check. Requires an element
+ * before `first` that is not greater than any element in [first, last).
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr void unguarded_insertion_sort(I first, I last, Less less) {
+    if (first == last) {
+        return;
+    }
+    for (I i = std::ranges::next(first); i != last; ++i) {
+        if (!less(*i, *std::ranges::prev(i))) {
+            continue;
+        }
+        held_element<I> held(i);
+        do {
+            *held.hole = std::ranges::iter_move(std::ranges::prev(held.hole));
+            --held.hole;
+        } while (less(held.value, *std::ranges::prev(held.hole)));
+    }
+    return;
+}
+
+/**
+ * @brief Restore the max-heap property below `start` in a heap of `length` elements.
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr void sift_down(I first, const std::iter_difference_t<I> length,
+                         std::iter_difference_t<I> start, Less less) {
+    held_element<I> held(first + start);
+    for (std::iter_difference_t<I> child = 2 * start + 1; child < length; child = 2 * start + 1) {
+        if (child + 1 < length && less(first[child], first[child + 1])) {
+            ++child;
+        }
+        if (!less(held.value, first[child])) {
+            break;
+        }
+        first[start] = std::ranges::iter_move(first + child);
+        start = child;
+        held.hole = first + start;
+    }
+    return;
+}
+
+template<std::random_access_iterator I, typename Less>
+constexpr void make_heap(I first, I last, Less less) {
+    const std::iter_difference_t<I> length = last - first;
+    for (std::iter_difference_t<I> start = length / 2 - 1; start >= 0; --start) {
+        sift_down(first, length, start, less);
+    }
+    return;
+}
+
+template<std::random_access_iterator I, typename Less>
+constexpr void sort_heap(I first, I last, Less less) {
+    for (std::iter_difference_t<I> length = last - first - 1; length > 0; --length) {
+        std::ranges::iter_swap(first, first + length);
+        sift_down(first, length, std::iter_difference_t<I>{ 0 }, less);
+    }
+    return;
+}
+
+/**
+ * @brief CRTP base giving every sort the iterator-pair and the range overloads.
+ * Derived classes implement `sort(I first, I last, Less less)`.
+ */
+template<typename Derived>
+struct sort_fn_base {
+    template<std::random_access_iterator I, std::sentinel_for<I> S,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<I, Comp, Proj>
+    constexpr I operator () (I first, S last, Comp comp = {}, Proj proj = {}) const {
+        I last_it = std::ranges::next(first, last);
+        Derived::sort(first, last_it, projected_less{ comp, proj });
+        return last_it;
+    }
+
+    template<std::ranges::random_access_range R,
+             typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+    constexpr std::ranges::borrowed_iterator_t<R> operator () (R&& r, Comp comp = {}, Proj proj = {}) const {
+        return (*this)(std::ranges::begin(r), std::ranges::end(r), std::move(comp), std::move(proj));
+    }
+};
+
+} // util::algorithm::detail
+
+/**
+ * @brief Repeatedly swap adjacent elements that are out of order,
+ * stopping as soon as a pass makes no swap.
+ */
+struct bubble_sort_fn : detail::sort_fn_base<bubble_sort_fn> {
+    template<std::random_access_iterator I, typename Less>
+    static constexpr void sort(I first, I last, Less less) {
+        for (bool sorted = false; !sorted && first != last; --last) {
+            sorted = true;
+            for (I i = first; std::ranges::next(i) != last; ++i) {
+                if (less(*std::ranges::next(i), *i)) {
+                    std::ranges::iter_swap(i, std::ranges::next(i));
+                    sorted = false;
+                }
+            }
+        }
+        return;
+    }
+};
+
+/**
+ * @brief Select the smallest remaining element and swap it into place.
+ */
+struct selection_sort_fn : detail::sort_fn_base<selection_sort_fn> {
+    template<std::random_access_iterator I, typename Less>
+    static constexpr void sort(I first, I last, Less less) {
+        for (; first != last; ++first) {
+            I smallest = first;
+            for (I i = std::ranges::next(first); i != last; ++i) {
+                if (less(*i, *smallest)) {
+                    smallest = i;
+                }
+            }
+            if (smallest != first) {
+                std::ranges::iter_swap(first, smallest);
+            }
+        }
+        return;
+    }
+};
+
+/**
+ * @brief Grow a sorted prefix by moving each element left to its position.
+ */
+struct insertion_sort_fn : detail::sort_fn_base<insertion_sort_fn> {
+    template<std::random_access_iterator I, typename Less>
+    static constexpr void sort(I first, I last, Less less) {
+        detail::insertion_sort(first, last, less);
+        return;
+    }
+};
+
+/**
+ * @brief Build a max-heap in place, then repeatedly move its root to the back.
+ */
+struct heap_sort_fn : detail::sort_fn_base<heap_sort_fn> {
+    template<std::random_access_iterator I, typename Less>
+    static constexpr void sort(I first, I last, Less less) {
+        detail::make_heap(first, last, less);
+        detail::sort_heap(first, last, less);
+        return;
+    }
+};
+
+inline constexpr bubble_sort_fn bubble_sort{};
+inline constexpr selection_sort_fn selection_sort{};
+inline constexpr insertion_sort_fn insertion_sort{};
+inline constexpr heap_sort_fn heap_sort{};
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_SORT_HPP
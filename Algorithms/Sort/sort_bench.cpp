@@ -0,0 +1,130 @@
+/**
+ * @file sort_bench.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Compare pdq_sort and heap_sort against std::sort on the usual input distributions.
+ *
+ * To compile and run on Linux with Makefile:
+ * $ make sortbench
+ * $ ./sortbench [element_count] [repeats]
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "sort.hpp"
+
+namespace {
+
+enum class distribution { random, sorted, reverse, organ_pipe, few_unique };
+
+const char* name_of(const distribution d) {
+    switch (d) {
+    case distribution::random:     return "random";
+    case distribution::sorted:     return "sorted";
+    case distribution::reverse:    return "reverse";
+    case distribution::organ_pipe: return "organ-pipe";
+    case distribution::few_unique: return "few-unique";
+    }
+    return "?";
+}
+
+std::vector<std::int64_t> make_keys(const distribution d, const std::size_t count) {
+    std::mt19937_64 engine(2021);
+    std::vector<std::int64_t> keys(count);
+    switch (d) {
+    case distribution::random:
+        std::ranges::generate(keys, [&]() { return static_cast<std::int64_t>(engine()); });
+        break;
+    case distribution::sorted:
+        for (std::size_t i = 0; i < count; ++i) {
+            keys[i] = static_cast<std::int64_t>(i);
+        }
+        break;
+    case distribution::reverse:
+        for (std::size_t i = 0; i < count; ++i) {
+            keys[i] = static_cast<std::int64_t>(count - i);
+        }
+        break;
+    case distribution::organ_pipe:
+        for (std::size_t i = 0; i < count; ++i) {
+            keys[i] = static_cast<std::int64_t>(i < count / 2 ? i : count - i);
+        }
+        break;
+    case distribution::few_unique:
+        std::ranges::generate(keys, [&]() { return static_cast<std::int64_t>(engine() % 16); });
+        break;
+    }
+    return keys;
+}
+
+std::vector<std::string> to_strings(const std::vector<std::int64_t>& keys) {
+    std::vector<std::string> strings;
+    strings.reserve(keys.size());
+    for (const std::int64_t key : keys) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "key-%020lld", static_cast<long long>(key));
+        strings.emplace_back(buffer);
+    }
+    return strings;
+}
+
+/* best of `repeats` runs, in milliseconds; aborts if the output is not sorted */
+template<typename T, typename Sorter>
+double time_sort(const std::vector<T>& input, const int repeats, Sorter sorter) {
+    double best = 1e300;
+    for (int run = 0; run < repeats; ++run) {
+        std::vector<T> values = input;
+        const auto begin = std::chrono::steady_clock::now();
+        sorter(values);
+        const auto end = std::chrono::steady_clock::now();
+        if (!std::ranges::is_sorted(values)) {
+            std::fprintf(stderr, "output is not sorted\n");
+            std::exit(EXIT_FAILURE);
+        }
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - begin).count());
+    }
+    return best;
+}
+
+template<typename T>
+void bench_row(const char* const type, const distribution d, const std::vector<T>& input, const int repeats) {
+    const double std_ms = time_sort(input, repeats, [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+    const double pdq_ms = time_sort(input, repeats, [](std::vector<T>& v) { util::algorithm::pdq_sort(v); });
+    const double heap_ms = time_sort(input, repeats, [](std::vector<T>& v) { util::algorithm::heap_sort(v); });
+    std::printf("%-8s %-11s %10.2f %10.2f %10.2f %8.2fx\n",
+        type, name_of(d), std_ms, pdq_ms, heap_ms, std_ms / pdq_ms);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const int repeats = (argc > 2) ? std::atoi(argv[2]) : 5;
+    const distribution distributions[] = {
+        distribution::random, distribution::sorted, distribution::reverse,
+        distribution::organ_pipe, distribution::few_unique,
+    };
+
+    std::printf("%zu elements, best of %d runs, milliseconds\n", count, repeats);
+    std::printf("%-8s %-11s %10s %10s %10s %9s\n", "type", "input", "std::sort", "pdq_sort", "heap_sort", "speedup");
+    for (const distribution d : distributions) {
+        bench_row("int64", d, make_keys(d, count), repeats);
+    }
+    for (const distribution d : distributions) {
+        bench_row("string", d, to_strings(make_keys(d, count / 4)), repeats);
+    }
+    return 0;
+}
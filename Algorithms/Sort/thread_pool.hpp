@@ -0,0 +1,246 @@
+/**
+ * @file thread_pool.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Work-stealing thread pool for fork-join algorithms.
+ *
+ * Each worker owns a task queue. A task submitted from a worker goes to the
+ * back of that worker's queue and is taken back LIFO, which keeps recently
+ * touched data in its cache; idle workers steal FIFO from the front of the
+ * other queues, taking the oldest and usually largest piece of work.
+ * Tasks submitted from outside the pool are spread round-robin.
+ *
+ *   util::algorithm::thread_pool pool(8);
+ *   util::algorithm::task_group group(pool);
+ *   group.run([&]() { left_half(); });
+ *   group.run([&]() { right_half(); });
+ *   group.wait();      // runs queued tasks while waiting, never blocks a worker
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_THREAD_POOL_HPP
+#define UTIL_ALGORITHM_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace util::algorithm {
+
+class thread_pool {
+public:
+    using task = std::function<void()>;
+
+    /**
+     * @brief Start `thread_count` workers, at least one.
+     */
+    explicit thread_pool(const std::size_t thread_count = std::thread::hardware_concurrency())
+        : queues_(std::max<std::size_t>(thread_count, 1)) {
+        workers_.reserve(queues_.size());
+        for (std::size_t i = 0; i < queues_.size(); ++i) {
+            workers_.emplace_back([this, i]() { worker_loop(i); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator = (const thread_pool&) = delete;
+
+    /**
+     * @brief Finish every queued task, then join the workers.
+     */
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stopping_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    std::size_t size() const noexcept { return workers_.size(); }
+
+    /**
+     * @brief Process-wide pool with one worker per hardware thread.
+     */
+    static thread_pool& shared() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    void submit(task work) {
+        const std::size_t index = current_pool_ == this
+            ? current_index_
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        {
+            std::lock_guard<std::mutex> lock(queues_[index].mutex);
+            queues_[index].tasks.push_back(std::move(work));
+        }
+        queued_.fetch_add(1, std::memory_order_release);
+        {
+            /* pairs with the predicate check in worker_loop, so no wake-up is lost */
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+        sleep_cv_.notify_one();
+        return;
+    }
+
+    /**
+     * @brief Run one queued task on the calling thread: the newest task of the
+     * caller's own queue if it is a worker of this pool, else the oldest task found.
+     * @return bool -> false if every queue was empty
+     */
+    bool run_one() {
+        task work;
+        if (!take(work)) {
+            return false;
+        }
+        work();
+        return true;
+    }
+
+private:
+    struct alignas(64) queue {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    bool take(task& work) {
+        if (queued_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        const bool is_worker = current_pool_ == this;
+        const std::size_t home = is_worker ? current_index_ : 0;
+        if (is_worker) {
+            queue& own = queues_[home];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                work = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        for (std::size_t step = is_worker ? 1 : 0; step < queues_.size(); ++step) {
+            queue& victim = queues_[(home + step) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                work = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker_loop(const std::size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+        while (true) {
+            if (run_one()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [this]() { return stopping_ || queued_.load(std::memory_order_acquire) > 0; });
+            if (stopping_ && queued_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<queue> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> queued_{ 0 };
+    std::atomic<std::size_t> next_queue_{ 0 };
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    bool stopping_ = false;
+
+    inline static thread_local thread_pool* current_pool_ = nullptr;
+    inline static thread_local std::size_t current_index_ = 0;
+};
+
+/**
+ * @brief A set of tasks to wait for together. The waiting thread runs queued
+ * tasks instead of blocking, so groups nest inside tasks without deadlock.
+ * The first exception thrown by a task is rethrown by wait().
+ */
+class task_group {
+public:
+    explicit task_group(thread_pool& pool) : pool_(pool) {}
+
+    task_group(const task_group&) = delete;
+    task_group& operator = (const task_group&) = delete;
+
+    ~task_group() {
+        while (pending_.load(std::memory_order_acquire) != 0) {
+            help();
+        }
+    }
+
+    template<typename F>
+    void run(F&& f) {
+        /* counted before the task can run and finish, uncounted again if it never got queued */
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        try {
+            pool_.submit([this, work = std::forward<F>(f)]() mutable {
+                try {
+                    work();
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex_);
+                    if (!error_) {
+                        error_ = std::current_exception();
+                    }
+                }
+                pending_.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        catch (...) {
+            pending_.fetch_sub(1, std::memory_order_release);
+            throw;
+        }
+        return;
+    }
+
+    void wait() {
+        while (pending_.load(std::memory_order_acquire) != 0) {
+            help();
+        }
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+        return;
+    }
+
+private:
+    void help() {
+        if (!pool_.run_one()) {
+            std::this_thread::yield();
+        }
+        return;
+    }
+
+    thread_pool& pool_;
+    std::atomic<std::size_t> pending_{ 0 };
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+};
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_THREAD_POOL_HPP
@@ -0,0 +1,335 @@
+/**
+ * @file timsort.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Adaptive, stable merge sort in the style of TimSort, for inputs that
+ * are already mostly in order, such as appended logs:
+ *
+ *   util::algorithm::tim_sort(events, {}, &event::timestamp);
+ *
+ * The input is split into natural runs, strictly descending runs being
+ * reversed in place. Runs shorter than `minrun` are extended with binary
+ * insertion sort, where minrun in [32, 64] is chosen so that n / minrun is
+ * a power of two or slightly less, which keeps the merges balanced. Pending
+ * runs live on a stack whose lengths grow at least like the Fibonacci
+ * numbers, so it stays O(log n) deep and merges pair runs of similar size.
+ *
+ * A merge first gallops to skip the prefix of the left run and the suffix of
+ * the right run that are already in place, then copies the shorter run to a
+ * buffer. When one run keeps winning, it switches from one comparison per
+ * element to galloping (exponential then binary search) and moves whole
+ * blocks; min_gallop adapts to how often that pays off.
+ *
+ * Complexity, n = last - first, r = number of natural runs:
+ *   O(n) comparisons on sorted or reverse-sorted input, O(n log r) in
+ *   general, O(n log n) in the worst case; n / 2 elements of extra memory.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_ALGORITHM_TIMSORT_HPP
+#define UTIL_ALGORITHM_TIMSORT_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "sort.hpp"
+
+namespace util::algorithm {
+
+namespace detail::tim {
+
+/* inputs shorter than this are sorted with one run and binary insertion sort */
+inline constexpr std::ptrdiff_t min_merge = 64;
+/* consecutive wins by one run before a merge starts galloping */
+inline constexpr std::ptrdiff_t initial_min_gallop = 7;
+
+/**
+ * @brief n itself below min_merge; otherwise the top six bits of n, plus one
+ * if any of the remaining bits is set.
+ */
+constexpr std::ptrdiff_t min_run_length(std::ptrdiff_t n) {
+    std::ptrdiff_t low_bits = 0;
+    while (n >= min_merge) {
+        low_bits |= n & 1;
+        n >>= 1;
+    }
+    return n + low_bits;
+}
+
+/**
+ * @brief Length of the run starting at `first`, reversing it if strictly
+ * descending; strictness keeps equal elements in their original order.
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr std::iter_difference_t<I> count_run_and_make_ascending(I first, I last, Less& less) {
+    I run_end = std::ranges::next(first);
+    if (run_end == last) {
+        return 1;
+    }
+    if (less(*run_end, *first)) {
+        for (++run_end; run_end != last && less(*run_end, *std::ranges::prev(run_end)); ++run_end) {}
+        std::reverse(first, run_end);
+    }
+    else {
+        for (++run_end; run_end != last && !less(*run_end, *std::ranges::prev(run_end)); ++run_end) {}
+    }
+    return run_end - first;
+}
+
+/**
+ * @brief Sort [first, last) given that [first, sorted) is already sorted,
+ * finding each insertion point with a binary search.
+ */
+template<std::random_access_iterator I, typename Less>
+constexpr void binary_insertion_sort(I first, I sorted, I last, Less& less) {
+    for (; sorted != last; ++sorted) {
+        I position = std::upper_bound(first, sorted, *sorted, less);
+        if (position != sorted) {
+            std::iter_value_t<I> value = std::ranges::iter_move(sorted);
+            std::move_backward(position, sorted, std::ranges::next(sorted));
+            *position = std::move(value);
+        }
+    }
+    return;
+}
+
+/**
+ * @brief First element of [first, last) for which `pred` is false, given it
+ * is true on a prefix: exponential search from `first`, then binary search,
+ * so O(log k) comparisons for an answer k elements in.
+ */
+template<std::random_access_iterator I, typename Pred>
+constexpr I gallop(I first, I last, Pred pred) {
+    const std::iter_difference_t<I> length = last - first;
+    if (length == 0 || !pred(*first)) {
+        return first;
+    }
+    std::iter_difference_t<I> known_true = 0;
+    std::iter_difference_t<I> offset = 1;
+    while (offset < length && pred(first[offset])) {
+        known_true = offset;
+        offset = 2 * offset + 1;
+    }
+    return std::partition_point(first + known_true + 1, first + std::min(offset, length), pred);
+}
+
+/* first element not less than `key` */
+template<std::random_access_iterator I, typename T, typename Less>
+constexpr I gallop_left(const T& key, I first, I last, Less& less) {
+    return gallop(first, last, [&](const auto& value) { return less(value, key); });
+}
+
+/* first element greater than `key` */
+template<std::random_access_iterator I, typename T, typename Less>
+constexpr I gallop_right(const T& key, I first, I last, Less& less) {
+    return gallop(first, last, [&](const auto& value) { return !less(key, value); });
+}
+
+/**
+ * @brief Merge the run moved into [buffer, buffer_end) with the run that
+ * starts at `right`, writing from `dest` onwards; `right` follows the
+ * destination of the buffered run, so the right run is merged in place.
+ * Ties take the buffered element first. Called with reverse iterators and a
+ * flipped comparator to merge from the high end.
+ */
+template<std::random_access_iterator B, std::random_access_iterator I, typename Less>
+constexpr void merge_low(B buffer, B buffer_end, I right, I right_end, I dest, Less less, std::ptrdiff_t& min_gallop) {
+    while (true) {
+        std::ptrdiff_t buffer_wins = 0;
+        std::ptrdiff_t right_wins = 0;
+        /* one comparison per element until one run wins min_gallop times in a row */
+        do {
+            if (less(*right, *buffer)) {
+                *dest++ = std::ranges::iter_move(right++);
+                ++right_wins;
+                buffer_wins = 0;
+                if (right == right_end) {
+                    std::move(buffer, buffer_end, dest);
+                    return;
+                }
+            }
+            else {
+                *dest++ = std::ranges::iter_move(buffer++);
+                ++buffer_wins;
+                right_wins = 0;
+                if (buffer == buffer_end) {
+                    return;
+                }
+            }
+        } while ((buffer_wins | right_wins) < min_gallop);
+
+        /* galloping until neither run wins a block of initial_min_gallop elements */
+        do {
+            B buffer_block = gallop_right(*right, buffer, buffer_end, less);
+            buffer_wins = buffer_block - buffer;
+            dest = std::move(buffer, buffer_block, dest);
+            buffer = buffer_block;
+            if (buffer == buffer_end) {
+                return;
+            }
+            *dest++ = std::ranges::iter_move(right++);
+            if (right == right_end) {
+                std::move(buffer, buffer_end, dest);
+                return;
+            }
+
+            I right_block = gallop_left(*buffer, right, right_end, less);
+            right_wins = right_block - right;
+            dest = std::move(right, right_block, dest);
+            right = right_block;
+            if (right == right_end) {
+                std::move(buffer, buffer_end, dest);
+                return;
+            }
+            *dest++ = std::ranges::iter_move(buffer++);
+            if (buffer == buffer_end) {
+                return;
+            }
+            min_gallop -= (min_gallop > 0);
+        } while (buffer_wins >= initial_min_gallop || right_wins >= initial_min_gallop);
+        /* galloping stopped paying off: make it harder to enter again */
+        min_gallop += 2;
+    }
+}
+
+template<std::random_access_iterator I, typename Less>
+class merge_state {
+public:
+    using difference_type = std::iter_difference_t<I>;
+
+    constexpr merge_state(I first, Less& less) : first_(first), less_(less) {}
+
+    constexpr void push_run(const difference_type base, const difference_type length) {
+        runs_.push_back(run{ base, length });
+        return;
+    }
+
+    /**
+     * @brief Merge until, for the top runs A B C D (D on top),
+     * |B| > |C| + |D| and |A| > |B| + |C| and |C| > |D|.
+     * Checking the fourth run from the top keeps the invariant true for
+     * the whole stack, not just its top three entries.
+     */
+    constexpr void merge_collapse() {
+        while (runs_.size() > 1) {
+            std::size_t n = runs_.size() - 2;
+            if ((n > 0 && runs_[n - 1].length <= runs_[n].length + runs_[n + 1].length)
+                || (n > 1 && runs_[n - 2].length <= runs_[n - 1].length + runs_[n].length)) {
+                if (runs_[n - 1].length < runs_[n + 1].length) {
+                    --n;
+                }
+            }
+            else if (runs_[n].length > runs_[n + 1].length) {
+                break;
+            }
+            merge_at(n);
+        }
+        return;
+    }
+
+    constexpr void merge_force_collapse() {
+        while (runs_.size() > 1) {
+            std::size_t n = runs_.size() - 2;
+            if (n > 0 && runs_[n - 1].length < runs_[n + 1].length) {
+                --n;
+            }
+            merge_at(n);
+        }
+        return;
+    }
+
+private:
+    struct run {
+        difference_type base;
+        difference_type length;
+    };
+
+    /* merge runs i and i + 1 of the stack */
+    constexpr void merge_at(const std::size_t i) {
+        I left = first_ + runs_[i].base;
+        I right = first_ + runs_[i + 1].base;
+        I right_end = right + runs_[i + 1].length;
+        runs_[i].length += runs_[i + 1].length;
+        runs_.erase(runs_.begin() + static_cast<difference_type>(i) + 1);
+
+        /* the left run's elements not greater than the right run's first are already in place */
+        left = gallop_right(*right, left, right, less_);
+        if (left == right) {
+            return;
+        }
+        /* as are the right run's elements not less than the left run's last */
+        right_end = gallop_left(*std::ranges::prev(right), right, right_end, less_);
+        if (right == right_end) {
+            return;
+        }
+
+        if (right - left <= right_end - right) {
+            buffer_.assign(std::make_move_iterator(left), std::make_move_iterator(right));
+            merge_low(buffer_.begin(), buffer_.end(), right, right_end, left, less_, min_gallop_);
+        }
+        else {
+            /* the same merge seen backwards: ties then take the right run's element last */
+            buffer_.assign(std::make_move_iterator(right), std::make_move_iterator(right_end));
+            const auto flipped = [this](const auto& lhs, const auto& rhs) { return less_(rhs, lhs); };
+            merge_low(buffer_.rbegin(), buffer_.rend(), std::reverse_iterator(right), std::reverse_iterator(left),
+                      std::reverse_iterator(right_end), flipped, min_gallop_);
+        }
+        return;
+    }
+
+    I first_;
+    Less& less_;
+    std::vector<run> runs_;
+    std::vector<std::iter_value_t<I>> buffer_;
+    std::ptrdiff_t min_gallop_ = initial_min_gallop;
+};
+
+} // util::algorithm::detail::tim
+
+/**
+ * @brief Stable adaptive merge sort: O(n) on presorted input, O(n log n) in
+ * the worst case, with up to n / 2 elements of extra memory.
+ */
+struct tim_sort_fn : detail::sort_fn_base<tim_sort_fn> {
+    template<std::random_access_iterator I, typename Less>
+    static constexpr void sort(I first, I last, Less less) {
+        using difference_type = std::iter_difference_t<I>;
+        const difference_type length = last - first;
+        if (length < 2) {
+            return;
+        }
+        if (length < detail::tim::min_merge) {
+            const difference_type run = detail::tim::count_run_and_make_ascending(first, last, less);
+            detail::tim::binary_insertion_sort(first, first + run, last, less);
+            return;
+        }
+
+        const difference_type min_run = detail::tim::min_run_length(length);
+        detail::tim::merge_state<I, Less> state(first, less);
+        for (difference_type base = 0; base < length;) {
+            difference_type run = detail::tim::count_run_and_make_ascending(first + base, last, less);
+            if (run < min_run) {
+                const difference_type forced = std::min(min_run, length - base);
+                detail::tim::binary_insertion_sort(first + base, first + base + run, first + base + forced, less);
+                run = forced;
+            }
+            state.push_run(base, run);
+            state.merge_collapse();
+            base += run;
+        }
+        state.merge_force_collapse();
+        return;
+    }
+};
+
+inline constexpr tim_sort_fn tim_sort{};
+
+} // util::algorithm
+
+#endif // UTIL_ALGORITHM_TIMSORT_HPP
@@ -0,0 +1,105 @@
+/**
+ * @file timsort_bench.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Presortedness sweep: sorted keys with a growing fraction of disorder,
+ * either random swaps or a random tail appended to a sorted log, sorted with
+ * tim_sort against std::sort, std::stable_sort and pdq_sort.
+ *
+ * To compile and run on Linux with Makefile:
+ * $ make timsortbench
+ * $ ./timsortbench [key_count]
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "pdqsort.hpp"
+#include "timsort.hpp"
+
+namespace {
+
+/* million keys per second of one run of `sorter` on a copy of `input` */
+template<typename Sorter>
+double rate(const std::vector<std::int64_t>& input, Sorter sorter) {
+    std::vector<std::int64_t> keys = input;
+    const auto begin = std::chrono::steady_clock::now();
+    sorter(keys);
+    const auto end = std::chrono::steady_clock::now();
+    if (!std::ranges::is_sorted(keys)) {
+        std::fprintf(stderr, "output is not sorted\n");
+        std::exit(EXIT_FAILURE);
+    }
+    return static_cast<double>(keys.size()) / std::chrono::duration<double>(end - begin).count() / 1e6;
+}
+
+/* comparisons per key made by tim_sort */
+double comparisons_per_key(const std::vector<std::int64_t>& input) {
+    std::vector<std::int64_t> keys = input;
+    std::uint64_t comparisons = 0;
+    util::algorithm::tim_sort(keys, [&comparisons](const std::int64_t lhs, const std::int64_t rhs) {
+        ++comparisons;
+        return lhs < rhs;
+    });
+    return static_cast<double>(comparisons) / static_cast<double>(keys.size());
+}
+
+/* ascending keys with `fraction` of the positions swapped with random others */
+std::vector<std::int64_t> swapped(const std::size_t count, const double fraction) {
+    std::mt19937_64 engine(2021);
+    std::vector<std::int64_t> keys(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        keys[i] = static_cast<std::int64_t>(i);
+    }
+    const std::size_t swaps = static_cast<std::size_t>(fraction * static_cast<double>(count) / 2);
+    for (std::size_t i = 0; i < swaps; ++i) {
+        std::swap(keys[engine() % count], keys[engine() % count]);
+    }
+    return keys;
+}
+
+/* a sorted log with `fraction` of random keys appended */
+std::vector<std::int64_t> appended(const std::size_t count, const double fraction) {
+    std::mt19937_64 engine(2021);
+    std::vector<std::int64_t> keys(count);
+    const std::size_t sorted = count - static_cast<std::size_t>(fraction * static_cast<double>(count));
+    for (std::size_t i = 0; i < count; ++i) {
+        keys[i] = i < sorted ? static_cast<std::int64_t>(i) : static_cast<std::int64_t>(engine() % count);
+    }
+    return keys;
+}
+
+template<typename Generator>
+void sweep(const char* const name, const std::size_t count, Generator generate) {
+    for (const double fraction : { 0.0, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 0.5, 1.0 }) {
+        const std::vector<std::int64_t> input = generate(count, fraction);
+        const double standard = rate(input, [](std::vector<std::int64_t>& v) { std::sort(v.begin(), v.end()); });
+        const double stable = rate(input, [](std::vector<std::int64_t>& v) { std::stable_sort(v.begin(), v.end()); });
+        const double pdq = rate(input, [](std::vector<std::int64_t>& v) { util::algorithm::pdq_sort(v); });
+        const double tim = rate(input, [](std::vector<std::int64_t>& v) { util::algorithm::tim_sort(v); });
+        std::printf("%-9s %9g %10.1f %10.1f %10.1f %10.1f %10.2f %8.2fx\n", name, fraction,
+            standard, stable, pdq, tim, comparisons_per_key(input), tim / stable);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::printf("%zu int64 keys, million keys per second; cmp/key counts tim_sort's comparisons\n", count);
+    std::printf("%-9s %9s %10s %10s %10s %10s %10s %9s\n",
+        "disorder", "fraction", "std::sort", "stable", "pdq_sort", "tim_sort", "cmp/key", "vs stable");
+    sweep("swaps", count, swapped);
+    sweep("appended", count, appended);
+    return 0;
+}
@@ -0,0 +1,336 @@
+/**
+ * @file bench_generic_containers.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief LinearVector against std::vector, node against std::forward_list
+ * and denode against std::list: building, walking and copying int sequences.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <cstdint>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "denode.hpp"
+#include "linear_vector.hpp"
+#include "node.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+using util::data_structure::denode;
+using util::data_structure::node;
+
+/* sum of 0 .. n - 1, what every walk below must add up to */
+std::int64_t expected_sum(const std::int64_t n) {
+    return n * (n - 1) / 2;
+}
+
+void check_sum(state& s, const std::int64_t sum) {
+    if (sum != expected_sum(s.range())) {
+        s.skip_with_error("wrong sum");
+    }
+    return;
+}
+
+/* ---------------------------------- vector ---------------------------------- */
+
+void linear_vector_push_back(state& s) {
+    for (auto _ : s) {
+        LinearVector<int> v;
+        for (std::int64_t i = 0; i < s.range(); ++i) {
+            v.push_back(static_cast<int>(i));
+        }
+        do_not_optimize(v[0]);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_vector_push_back(state& s) {
+    for (auto _ : s) {
+        std::vector<int> v;
+        for (std::int64_t i = 0; i < s.range(); ++i) {
+            v.push_back(static_cast<int>(i));
+        }
+        do_not_optimize(v.data());
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void linear_vector_index(state& s) {
+    LinearVector<int> v;
+    for (std::int64_t i = 0; i < s.range(); ++i) {
+        v.push_back(static_cast<int>(i));
+    }
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            sum += v[i];
+        }
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_vector_index(state& s) {
+    std::vector<int> v(static_cast<std::size_t>(s.range()));
+    std::iota(v.begin(), v.end(), 0);
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            sum += v[i];
+        }
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void linear_vector_copy(state& s) {
+    LinearVector<int> v;
+    for (std::int64_t i = 0; i < s.range(); ++i) {
+        v.push_back(static_cast<int>(i));
+    }
+    for (auto _ : s) {
+        LinearVector<int> copy(v);
+        do_not_optimize(copy[0]);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_vector_copy(state& s) {
+    std::vector<int> v(static_cast<std::size_t>(s.range()));
+    std::iota(v.begin(), v.end(), 0);
+    for (auto _ : s) {
+        std::vector<int> copy(v);
+        do_not_optimize(copy.data());
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* ------------------------------- forward_list ------------------------------- */
+
+/* n heap nodes holding n - 1 .. 0, built by prepending like push_front */
+node<int>* build_node_list(const std::int64_t n) {
+    node<int>* head = nullptr;
+    for (std::int64_t i = 0; i < n; ++i) {
+        head = new node<int>(static_cast<int>(i), head);
+    }
+    return head;
+}
+
+void destroy_node_list(node<int>* head) {
+    while (head != nullptr) {
+        node<int>* next = head->next();
+        delete head;
+        head = next;
+    }
+    return;
+}
+
+void node_build(state& s) {
+    for (auto _ : s) {
+        node<int>* head = build_node_list(s.range());
+        do_not_optimize(head);
+        destroy_node_list(head);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_forward_list_build(state& s) {
+    for (auto _ : s) {
+        std::forward_list<int> list;
+        for (std::int64_t i = 0; i < s.range(); ++i) {
+            list.push_front(static_cast<int>(i));
+        }
+        do_not_optimize(list.front());
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void node_traverse(state& s) {
+    node<int>* head = build_node_list(s.range());
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (const node<int>* n = head; n != nullptr; n = n->next()) {
+            sum += n->value();
+        }
+        do_not_optimize(sum);
+    }
+    destroy_node_list(head);
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_forward_list_traverse(state& s) {
+    std::forward_list<int> list;
+    for (std::int64_t i = 0; i < s.range(); ++i) {
+        list.push_front(static_cast<int>(i));
+    }
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (const int value : list) {
+            sum += value;
+        }
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* ----------------------------------- list ----------------------------------- */
+
+/* n heap denodes holding 0 .. n - 1, built by appending like push_back; returns the head */
+denode<int>* build_denode_list(const std::int64_t n, denode<int>*& tail) {
+    denode<int>* head = new denode<int>(0);
+    tail = head;
+    for (std::int64_t i = 1; i < n; ++i) {
+        tail = new denode<int>(tail, static_cast<int>(i));
+    }
+    return head;
+}
+
+void destroy_denode_list(denode<int>* head) {
+    while (head != nullptr) {
+        denode<int>* next = head->next();
+        delete head;
+        head = next;
+    }
+    return;
+}
+
+void denode_build(state& s) {
+    for (auto _ : s) {
+        denode<int>* tail = nullptr;
+        denode<int>* head = build_denode_list(s.range(), tail);
+        do_not_optimize(tail);
+        destroy_denode_list(head);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_list_build(state& s) {
+    for (auto _ : s) {
+        std::list<int> list;
+        for (std::int64_t i = 0; i < s.range(); ++i) {
+            list.push_back(static_cast<int>(i));
+        }
+        do_not_optimize(list.back());
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void denode_traverse_forward(state& s) {
+    denode<int>* tail = nullptr;
+    denode<int>* head = build_denode_list(s.range(), tail);
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (const denode<int>* n = head; n != nullptr; n = n->next()) {
+            sum += n->value();
+        }
+        do_not_optimize(sum);
+    }
+    destroy_denode_list(head);
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_list_traverse_forward(state& s) {
+    std::list<int> list(static_cast<std::size_t>(s.range()));
+    std::iota(list.begin(), list.end(), 0);
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (const int value : list) {
+            sum += value;
+        }
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void denode_traverse_backward(state& s) {
+    denode<int>* tail = nullptr;
+    denode<int>* head = build_denode_list(s.range(), tail);
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (const denode<int>* n = tail; n != nullptr; n = n->prev()) {
+            sum += n->value();
+        }
+        do_not_optimize(sum);
+    }
+    destroy_denode_list(head);
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_list_traverse_backward(state& s) {
+    std::list<int> list(static_cast<std::size_t>(s.range()));
+    std::iota(list.begin(), list.end(), 0);
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (auto it = list.rbegin(); it != list.rend(); ++it) {
+            sum += *it;
+        }
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 14, std::int64_t{ 1 } << 18 };
+    register_benchmark("vector/push_back/LinearVector", linear_vector_push_back, sizes);
+    register_benchmark("vector/push_back/std::vector", std_vector_push_back, sizes);
+    register_benchmark("vector/index/LinearVector", linear_vector_index, sizes);
+    register_benchmark("vector/index/std::vector", std_vector_index, sizes);
+    register_benchmark("vector/copy/LinearVector", linear_vector_copy, sizes);
+    register_benchmark("vector/copy/std::vector", std_vector_copy, sizes);
+    register_benchmark("forward_list/build/node", node_build, sizes);
+    register_benchmark("forward_list/build/std::forward_list", std_forward_list_build, sizes);
+    register_benchmark("forward_list/traverse/node", node_traverse, sizes);
+    register_benchmark("forward_list/traverse/std::forward_list", std_forward_list_traverse, sizes);
+    register_benchmark("list/build/denode", denode_build, sizes);
+    register_benchmark("list/build/std::list", std_list_build, sizes);
+    register_benchmark("list/traverse_forward/denode", denode_traverse_forward, sizes);
+    register_benchmark("list/traverse_forward/std::list", std_list_traverse_forward, sizes);
+    register_benchmark("list/traverse_backward/denode", denode_traverse_backward, sizes);
+    register_benchmark("list/traverse_backward/std::list", std_list_traverse_backward, sizes);
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,675 @@
+/**
+ * @file bench_harness.hpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief A small micro-benchmark harness with the shape of Google Benchmark,
+ * so the suite builds without network access or third-party packages:
+ *
+ *   void vector_push_back(util::benchmark::state& state) {
+ *       for (auto _ : state) {
+ *           std::vector<int> v;
+ *           for (std::int64_t i = 0; i < state.range(); ++i) { v.push_back(int(i)); }
+ *           util::benchmark::do_not_optimize(v.data());
+ *       }
+ *       state.set_items_processed(state.iterations() * state.range());
+ *   }
+ *   const bool registered = util::benchmark::register_benchmark("vector/push_back", vector_push_back, { 1 << 10, 1 << 20 });
+ *
+ * Each case runs with a growing iteration count until one run takes at least
+ * --min-time seconds, then reports the wall and process CPU time per
+ * iteration. The JSON written by --format=json or --out follows Google
+ * Benchmark's layout ("context", then "benchmarks" with name, run_name,
+ * run_type, iterations, real_time, cpu_time, time_unit, items_per_second),
+ * so its compare.py and other tools read it unchanged.
+ *
+ * With --perf-counters, the hardware counters of perf_counters.hpp count
+ * the same timed region and are reported per iteration in the JSON, under
+ * their names, and per item, as "<name>_per_item", when the case sets its
+ * items processed; the console shows the per item counts. Counters the
+ * machine does not have are left out and the reason printed once, so the
+ * flag is safe in containers. Enabling them costs a system call for every
+ * start, stop, pause and resume of the timers.
+ *
+ * Flags: --filter=<regex> --min-time=<seconds> --repetitions=<n>
+ *        --format=<console|json> --out=<file> --list --perf-counters
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef UTIL_BENCHMARK_BENCH_HARNESS_HPP
+#define UTIL_BENCHMARK_BENCH_HARNESS_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <optional>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "perf_counters.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace util::benchmark {
+
+/* keep `value` observable so the computation producing it is not optimised away */
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static_cast<void>(*reinterpret_cast<const volatile char*>(&value));
+    _ReadWriteBarrier();
+#endif
+    return;
+}
+
+/* force pending writes to memory to be considered visible */
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    _ReadWriteBarrier();
+#endif
+    return;
+}
+
+/**
+ * @brief Handed to a benchmark function: iterate it with a range-for, whose
+ * first step starts the timers and whose last step stops them.
+ */
+class state {
+public:
+    state(const std::int64_t range, const std::int64_t iterations, instrumentation::perf_counters* const counters = nullptr)
+        : range_(range), iterations_(iterations), counters_(counters) {}
+
+    struct sentinel {};
+
+    /* what the loop variable holds; marked so that it is never reported unused */
+    struct [[maybe_unused]] value {};
+
+    class iterator {
+    public:
+        explicit iterator(state* const parent) : parent_(parent), left_(parent->iterations_) {}
+
+        bool operator != (sentinel) {
+            if (left_ != 0) {
+                return true;
+            }
+            parent_->stop();
+            return false;
+        }
+
+        iterator& operator ++ () {
+            --left_;
+            return *this;
+        }
+
+        value operator * () const { return {}; }
+
+    private:
+        state* parent_;
+        std::int64_t left_;
+    };
+
+    iterator begin() {
+        started_ = true;
+        start();
+        return iterator(this);
+    }
+
+    sentinel end() { return {}; }
+
+    /* the argument the case was registered with, such as an element count */
+    std::int64_t range() const { return range_; }
+    std::int64_t iterations() const { return iterations_; }
+
+    /* exclude setup inside the loop, such as refilling an input, from the times */
+    void pause_timing() {
+        if (counters_ != nullptr) {
+            counters_->stop();
+        }
+        real_ += std::chrono::steady_clock::now() - real_begin_;
+        cpu_ += std::clock() - cpu_begin_;
+        return;
+    }
+
+    void resume_timing() {
+        start();
+        return;
+    }
+
+    void set_items_processed(const std::int64_t items) {
+        items_ = items;
+        return;
+    }
+
+    void set_bytes_processed(const std::int64_t bytes) {
+        bytes_ = bytes;
+        return;
+    }
+
+    void set_label(std::string label) {
+        label_ = std::move(label);
+        return;
+    }
+
+    /* report the case as failed, for example when its output is wrong */
+    void skip_with_error(std::string message) {
+        error_ = std::move(message);
+        return;
+    }
+
+    double real_seconds() const { return std::chrono::duration<double>(real_).count(); }
+    double cpu_seconds() const { return static_cast<double>(cpu_) / CLOCKS_PER_SEC; }
+    std::int64_t items_processed() const { return items_; }
+    std::int64_t bytes_processed() const { return bytes_; }
+    const std::string& label() const { return label_; }
+    const std::string& error() const { return error_; }
+    bool started() const { return started_; }
+
+private:
+    void start() {
+        cpu_begin_ = std::clock();
+        real_begin_ = std::chrono::steady_clock::now();
+        if (counters_ != nullptr) {
+            counters_->start();
+        }
+        return;
+    }
+
+    void stop() {
+        pause_timing();
+        return;
+    }
+
+    std::int64_t range_;
+    std::int64_t iterations_;
+    instrumentation::perf_counters* counters_;
+    std::chrono::steady_clock::time_point real_begin_{};
+    std::chrono::steady_clock::duration real_{};
+    std::clock_t cpu_begin_ = 0;
+    std::clock_t cpu_ = 0;
+    std::int64_t items_ = 0;
+    std::int64_t bytes_ = 0;
+    std::string label_;
+    std::string error_;
+    bool started_ = false;
+};
+
+using benchmark_function = std::function<void(state&)>;
+
+namespace detail {
+
+struct benchmark_case {
+    std::string name;
+    benchmark_function function;
+    std::int64_t range;
+    bool has_range;
+};
+
+/* one line of the report: a single repetition or an aggregate over them */
+struct run_result {
+    std::string name;
+    std::string run_name;
+    std::string aggregate_name;
+    std::size_t family_index = 0;
+    int repetitions = 1;
+    int repetition_index = 0;
+    std::int64_t iterations = 0;
+    double real_ns = 0;
+    double cpu_ns = 0;
+    double items_per_second = 0;
+    double bytes_per_second = 0;
+    /* hardware counters per iteration and items per iteration, to divide them by */
+    std::array<std::optional<double>, instrumentation::hardware_counter_count> counters{};
+    double items_per_iteration = 0;
+    std::string label;
+    std::string error;
+};
+
+struct options {
+    std::string filter = ".*";
+    double min_time = 0.5;
+    int repetitions = 1;
+    bool json = false;
+    std::string out;
+    bool list = false;
+    bool perf_counters = false;
+};
+
+inline std::vector<benchmark_case>& registry() {
+    static std::vector<benchmark_case> cases;
+    return cases;
+}
+
+inline std::string json_escape(const std::string_view text) {
+    std::string escaped;
+    for (const char c : text) {
+        switch (c) {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\t': escaped += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+                escaped += code;
+            }
+            else {
+                escaped += c;
+            }
+        }
+    }
+    return escaped;
+}
+
+inline std::string local_date() {
+    const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm local{};
+#if defined(_WIN32)
+    localtime_s(&local, &now);
+#else
+    localtime_r(&now, &local);
+#endif
+    char text[32];
+    std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%S%z", &local);
+    return text;
+}
+
+inline std::string compiler_name() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+/**
+ * @brief Run one case with a growing iteration count until a run lasts at
+ * least `min_time` seconds; each step aims 40% past the target, at most 10x.
+ */
+inline run_result run_case(const benchmark_case& bench, const double min_time,
+                           instrumentation::perf_counters* const counters = nullptr) {
+    std::int64_t iterations = 1;
+    while (true) {
+        if (counters != nullptr) {
+            counters->reset();
+        }
+        state s(bench.range, iterations, counters);
+        try {
+            bench.function(s);
+        }
+        catch (const std::exception& error) {
+            s.skip_with_error(std::string("exception: ") + error.what());
+        }
+        run_result result;
+        result.name = bench.name;
+        result.run_name = bench.name;
+        result.iterations = iterations;
+        result.label = s.label();
+        result.error = s.error();
+        if (!s.started() && result.error.empty()) {
+            result.error = "benchmark function did not iterate its state";
+        }
+        const double real = s.real_seconds();
+        if (!result.error.empty() || real >= min_time || iterations >= 1'000'000'000) {
+            const double count = static_cast<double>(iterations);
+            result.real_ns = real * 1e9 / count;
+            result.cpu_ns = s.cpu_seconds() * 1e9 / count;
+            if (real > 0) {
+                result.items_per_second = static_cast<double>(s.items_processed()) / real;
+                result.bytes_per_second = static_cast<double>(s.bytes_processed()) / real;
+            }
+            result.items_per_iteration = static_cast<double>(s.items_processed()) / count;
+            if (counters != nullptr) {
+                const instrumentation::counter_sample sample = counters->read();
+                for (std::size_t c = 0; c < instrumentation::hardware_counter_count; ++c) {
+                    result.counters[c] = sample.per(static_cast<instrumentation::hardware_counter>(c), static_cast<std::uint64_t>(iterations));
+                }
+            }
+            return result;
+        }
+        const double multiplier = real > min_time / 10 ? min_time * 1.4 / real : 10.0;
+        iterations = std::max(iterations + 1, static_cast<std::int64_t>(static_cast<double>(iterations) * multiplier));
+    }
+}
+
+/* mean, median and standard deviation of the repetitions of one case */
+inline std::vector<run_result> aggregates(const std::vector<run_result>& runs) {
+    const auto statistic = [&runs](const char* const name, auto reduce) {
+        run_result result = runs.front();
+        result.name = result.run_name + "_" + name;
+        result.aggregate_name = name;
+        result.iterations = static_cast<std::int64_t>(runs.size());
+        const auto field = [&runs, &reduce](double run_result::* member) {
+            std::vector<double> values;
+            for (const run_result& run : runs) {
+                values.push_back(run.*member);
+            }
+            return reduce(values);
+        };
+        result.real_ns = field(&run_result::real_ns);
+        result.cpu_ns = field(&run_result::cpu_ns);
+        result.items_per_second = field(&run_result::items_per_second);
+        result.bytes_per_second = field(&run_result::bytes_per_second);
+        for (std::size_t c = 0; c < instrumentation::hardware_counter_count; ++c) {
+            if (result.counters[c]) {
+                std::vector<double> values;
+                for (const run_result& run : runs) {
+                    values.push_back(run.counters[c].value_or(0));
+                }
+                result.counters[c] = reduce(values);
+            }
+        }
+        return result;
+    };
+    const auto mean = [](const std::vector<double>& values) {
+        double sum = 0;
+        for (const double value : values) {
+            sum += value;
+        }
+        return sum / static_cast<double>(values.size());
+    };
+    const auto median = [](std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        const std::size_t middle = values.size() / 2;
+        return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+    };
+    const auto stddev = [&mean](const std::vector<double>& values) {
+        const double average = mean(values);
+        double squares = 0;
+        for (const double value : values) {
+            squares += (value - average) * (value - average);
+        }
+        return std::sqrt(squares / static_cast<double>(values.size() - 1));
+    };
+    return { statistic("mean", mean), statistic("median", median), statistic("stddev", stddev) };
+}
+
+inline void write_json(std::ostream& out, const std::vector<run_result>& results, const char* const executable) {
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << local_date() << "\",\n"
+        << "    \"executable\": \"" << json_escape(executable) << "\",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+        << "    \"compiler\": \"" << json_escape(compiler_name()) << "\",\n"
+#ifdef NDEBUG
+        << "    \"library_build_type\": \"release\"\n"
+#else
+        << "    \"library_build_type\": \"debug\"\n"
+#endif
+        << "  },\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const run_result& r = results[i];
+        char numbers[256];
+        std::snprintf(numbers, sizeof(numbers),
+            "      \"iterations\": %lld,\n      \"real_time\": %.6e,\n      \"cpu_time\": %.6e,\n      \"time_unit\": \"ns\"",
+            static_cast<long long>(r.iterations), r.real_ns, r.cpu_ns);
+        out << (i ? ",\n" : "\n") << "    {\n"
+            << "      \"name\": \"" << json_escape(r.name) << "\",\n"
+            << "      \"family_index\": " << r.family_index << ",\n"
+            << "      \"run_name\": \"" << json_escape(r.run_name) << "\",\n"
+            << "      \"run_type\": \"" << (r.aggregate_name.empty() ? "iteration" : "aggregate") << "\",\n"
+            << "      \"repetitions\": " << r.repetitions << ",\n";
+        if (r.aggregate_name.empty()) {
+            out << "      \"repetition_index\": " << r.repetition_index << ",\n";
+        }
+        else {
+            out << "      \"aggregate_name\": \"" << r.aggregate_name << "\",\n";
+        }
+        if (!r.error.empty()) {
+            out << "      \"error_occurred\": true,\n"
+                << "      \"error_message\": \"" << json_escape(r.error) << "\",\n";
+        }
+        out << numbers;
+        if (r.items_per_second > 0) {
+            std::snprintf(numbers, sizeof(numbers), ",\n      \"items_per_second\": %.6e", r.items_per_second);
+            out << numbers;
+        }
+        if (r.bytes_per_second > 0) {
+            std::snprintf(numbers, sizeof(numbers), ",\n      \"bytes_per_second\": %.6e", r.bytes_per_second);
+            out << numbers;
+        }
+        for (std::size_t c = 0; c < instrumentation::hardware_counter_count; ++c) {
+            if (r.counters[c]) {
+                const std::string_view counter = instrumentation::hardware_counter_names[c];
+                std::snprintf(numbers, sizeof(numbers), ",\n      \"%.*s\": %.6e",
+                    static_cast<int>(counter.size()), counter.data(), *r.counters[c]);
+                out << numbers;
+                if (r.items_per_iteration > 0 && r.aggregate_name != "stddev") {
+                    std::snprintf(numbers, sizeof(numbers), ",\n      \"%.*s_per_item\": %.6e",
+                        static_cast<int>(counter.size()), counter.data(), *r.counters[c] / r.items_per_iteration);
+                    out << numbers;
+                }
+            }
+        }
+        if (!r.label.empty()) {
+            out << ",\n      \"label\": \"" << json_escape(r.label) << "\"";
+        }
+        out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+    return;
+}
+
+inline void print_header(std::size_t width) {
+    std::printf("%-*s %15s %15s %12s %14s\n", static_cast<int>(width), "Benchmark", "Time", "CPU", "Iterations", "items/s");
+    std::printf("%s\n", std::string(width + 60, '-').c_str());
+    std::fflush(stdout);
+    return;
+}
+
+inline void print_result(const run_result& r, std::size_t width) {
+    if (!r.error.empty()) {
+        std::printf("%-*s ERROR: %s\n", static_cast<int>(width), r.name.c_str(), r.error.c_str());
+    }
+    else {
+        std::printf("%-*s %12.0f ns %12.0f ns %12lld", static_cast<int>(width), r.name.c_str(),
+            r.real_ns, r.cpu_ns, static_cast<long long>(r.iterations));
+        if (r.items_per_second > 0) {
+            std::printf(" %12.4gM/s", r.items_per_second / 1e6);
+        }
+        if (!r.label.empty()) {
+            std::printf(" %s", r.label.c_str());
+        }
+        /* per item when the case counts items, else per iteration */
+        const double per = r.items_per_iteration > 0 && r.aggregate_name != "stddev" ? r.items_per_iteration : 1;
+        for (std::size_t c = 0; c < instrumentation::hardware_counter_count; ++c) {
+            if (r.counters[c]) {
+                const std::string_view counter = instrumentation::hardware_counter_names[c];
+                std::printf(" %.*s=%.4g", static_cast<int>(counter.size()), counter.data(), *r.counters[c] / per);
+            }
+        }
+        std::printf("\n");
+    }
+    std::fflush(stdout);
+    return;
+}
+
+/* parse the flags; returns false, after printing usage, for an unknown one */
+inline bool parse_options(const int argc, char** const argv, options& parsed) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const auto value_of = [&arg](const std::string_view flag, std::string_view& value) {
+            if (arg.substr(0, flag.size()) != flag) {
+                return false;
+            }
+            value = arg.substr(flag.size());
+            return true;
+        };
+        std::string_view value;
+        if (value_of("--filter=", value)) {
+            parsed.filter = std::string(value);
+        }
+        else if (value_of("--min-time=", value)) {
+            parsed.min_time = std::stod(std::string(value));
+        }
+        else if (value_of("--repetitions=", value)) {
+            parsed.repetitions = std::max(1, std::stoi(std::string(value)));
+        }
+        else if (value_of("--format=", value) && (value == "json" || value == "console")) {
+            parsed.json = value == "json";
+        }
+        else if (value_of("--out=", value)) {
+            parsed.out = std::string(value);
+        }
+        else if (arg == "--list") {
+            parsed.list = true;
+        }
+        else if (arg == "--perf-counters") {
+            parsed.perf_counters = true;
+        }
+        else {
+            std::fprintf(stderr, "usage: %s [--filter=<regex>] [--min-time=<seconds>] [--repetitions=<n>] "
+                "[--format=<console|json>] [--out=<file>] [--list] [--perf-counters]\n", argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // util::benchmark::detail
+
+/**
+ * @brief Register `function` once per entry of `ranges`, named "name/range";
+ * with no ranges it is registered once under `name` with range 0.
+ * @return bool -> always true, to initialise a namespace-scope constant
+ */
+inline bool register_benchmark(const std::string& name, benchmark_function function,
+                               const std::initializer_list<std::int64_t> ranges = {}) {
+    if (ranges.size() == 0) {
+        detail::registry().push_back({ name, std::move(function), 0, false });
+        return true;
+    }
+    for (const std::int64_t range : ranges) {
+        detail::registry().push_back({ name + "/" + std::to_string(range), function, range, true });
+    }
+    return true;
+}
+
+/**
+ * @brief Run every registered case matching --filter and report it.
+ * @return int -> EXIT_FAILURE on bad flags, a bad filter or a failed case
+ */
+inline int run(const int argc, char** const argv) {
+    detail::options parsed;
+    if (!detail::parse_options(argc, argv, parsed)) {
+        return EXIT_FAILURE;
+    }
+    std::regex filter;
+    try {
+        filter = std::regex(parsed.filter);
+    }
+    catch (const std::regex_error& error) {
+        std::fprintf(stderr, "invalid --filter '%s': %s\n", parsed.filter.c_str(), error.what());
+        return EXIT_FAILURE;
+    }
+
+    std::vector<const detail::benchmark_case*> selected;
+    std::size_t width = 10;
+    for (const detail::benchmark_case& bench : detail::registry()) {
+        if (std::regex_search(bench.name, filter)) {
+            selected.push_back(&bench);
+            width = std::max(width, bench.name.size() + (parsed.repetitions > 1 ? 7 : 0));
+        }
+    }
+    if (parsed.list) {
+        for (const detail::benchmark_case* bench : selected) {
+            std::printf("%s\n", bench->name.c_str());
+        }
+        return EXIT_SUCCESS;
+    }
+
+    /* opened once for every case, they count only while a case is timed */
+    std::optional<instrumentation::perf_counters> counters;
+    if (parsed.perf_counters) {
+        counters.emplace();
+        if (!counters->unavailable_reason().empty()) {
+            std::fprintf(stderr, "%s counters: %s\n", counters->available() ? "some" : "no",
+                counters->unavailable_reason().c_str());
+        }
+    }
+
+    const bool console = !parsed.json;
+    if (console) {
+        detail::print_header(width);
+    }
+    std::vector<detail::run_result> results;
+    bool failed = false;
+    std::string family;
+    std::size_t family_index = 0;
+    for (const detail::benchmark_case* bench : selected) {
+        /* cases registered together share a family: the name without its range */
+        const std::string name_family = bench->has_range ? bench->name.substr(0, bench->name.rfind('/')) : bench->name;
+        if (!results.empty() && name_family != family) {
+            ++family_index;
+        }
+        family = name_family;
+
+        std::vector<detail::run_result> repetitions;
+        for (int repetition = 0; repetition < parsed.repetitions; ++repetition) {
+            detail::run_result result = detail::run_case(*bench, parsed.min_time, counters ? &*counters : nullptr);
+            result.family_index = family_index;
+            result.repetitions = parsed.repetitions;
+            result.repetition_index = repetition;
+            failed = failed || !result.error.empty();
+            if (console) {
+                detail::print_result(result, width);
+            }
+            repetitions.push_back(std::move(result));
+            if (!repetitions.back().error.empty()) {
+                break;
+            }
+        }
+        results.insert(results.end(), repetitions.begin(), repetitions.end());
+        if (parsed.repetitions > 1 && repetitions.back().error.empty()) {
+            for (detail::run_result& aggregate : detail::aggregates(repetitions)) {
+                if (console) {
+                    detail::print_result(aggregate, width);
+                }
+                results.push_back(std::move(aggregate));
+            }
+        }
+    }
+
+    if (parsed.json) {
+        detail::write_json(std::cout, results, argv[0]);
+    }
+    if (!parsed.out.empty()) {
+        std::ofstream file(parsed.out);
+        detail::write_json(file, results, argv[0]);
+        if (!file) {
+            std::fprintf(stderr, "cannot write %s\n", parsed.out.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+} // util::benchmark
+
+#endif // UTIL_BENCHMARK_BENCH_HARNESS_HPP
@@ -0,0 +1,153 @@
+/**
+ * @file bench_hash_tables.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The C hash tables keyed by CPerson name, swiss_table, robin_hood
+ * and concurrent_table used from one thread, against std::unordered_map:
+ * inserting into a table that grows from 16 slots, then looking up names
+ * that are present and names that are not.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "bench_harness.hpp"
+#include "concurrent_table.h"
+#include "person.h"
+#include "robin_hood_table.h"
+#include "swiss_table.h"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+
+constexpr std::size_t initial_capacity = 16;
+
+/* n records named "person-<i>", or "missing-<i>" for names never inserted */
+std::unique_ptr<CPerson[]> make_people(const std::size_t n, const char* const prefix) {
+    auto people = std::make_unique<CPerson[]>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::snprintf(people[i].name, MAX_NAME, "%s-%zu", prefix, i);
+        people[i].age = static_cast<int>(i % 100);
+    }
+    return people;
+}
+
+struct swiss {
+    SwissTable table{};
+    explicit swiss(const std::size_t capacity) { swiss_table_init(&table, capacity); }
+    ~swiss() { swiss_table_free(&table); }
+    bool insert(CPerson* const person) { return swiss_table_insert(&table, person); }
+    CPerson* lookup(const char* const name) { return swiss_table_lookup(&table, name); }
+};
+
+struct robin_hood {
+    RobinHoodTable table{};
+    explicit robin_hood(const std::size_t capacity) { robin_hood_init(&table, capacity); }
+    ~robin_hood() { robin_hood_free(&table); }
+    bool insert(CPerson* const person) { return robin_hood_insert(&table, person); }
+    CPerson* lookup(const char* const name) { return robin_hood_lookup(&table, name); }
+};
+
+struct concurrent {
+    ConcurrentTable* table;
+    explicit concurrent(const std::size_t capacity) : table(concurrent_table_create(16, capacity)) {}
+    ~concurrent() { concurrent_table_destroy(table); }
+    bool insert(CPerson* const person) { return concurrent_table_insert(table, person); }
+    CPerson* lookup(const char* const name) { return concurrent_table_lookup(table, name); }
+};
+
+struct std_unordered_map {
+    std::unordered_map<std::string_view, CPerson*> table;
+    explicit std_unordered_map(const std::size_t capacity) { table.reserve(capacity); }
+    bool insert(CPerson* const person) { return table.emplace(person->name, person).second; }
+    CPerson* lookup(const char* const name) {
+        const auto found = table.find(name);
+        return found == table.end() ? nullptr : found->second;
+    }
+};
+
+template<typename Table>
+void insert(state& s) {
+    const std::size_t n = static_cast<std::size_t>(s.range());
+    const std::unique_ptr<CPerson[]> people = make_people(n, "person");
+    for (auto _ : s) {
+        Table table(initial_capacity);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (!table.insert(&people[i])) {
+                s.skip_with_error("insert failed");
+            }
+        }
+        do_not_optimize(table);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* `prefix` "person" looks up every inserted name, "missing" as many absent ones */
+template<typename Table>
+void lookup(state& s, const char* const prefix) {
+    const std::size_t n = static_cast<std::size_t>(s.range());
+    const std::unique_ptr<CPerson[]> people = make_people(n, "person");
+    const std::unique_ptr<CPerson[]> queries = make_people(n, prefix);
+    Table table(initial_capacity);
+    for (std::size_t i = 0; i < n; ++i) {
+        table.insert(&people[i]);
+    }
+    std::size_t found = 0;
+    for (auto _ : s) {
+        found = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            found += table.lookup(queries[i].name) != nullptr;
+        }
+        do_not_optimize(found);
+    }
+    const bool hits = std::string_view(prefix) == "person";
+    if (found != (hits ? n : 0)) {
+        s.skip_with_error("wrong number of names found");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+template<typename Table>
+void lookup_hit(state& s) {
+    lookup<Table>(s, "person");
+    return;
+}
+
+template<typename Table>
+void lookup_miss(state& s) {
+    lookup<Table>(s, "missing");
+    return;
+}
+
+template<typename Table>
+void register_table(const char* const name) {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 14, std::int64_t{ 1 } << 18 };
+    register_benchmark(std::string("hash_table/insert/") + name, insert<Table>, sizes);
+    register_benchmark(std::string("hash_table/lookup_hit/") + name, lookup_hit<Table>, sizes);
+    register_benchmark(std::string("hash_table/lookup_miss/") + name, lookup_miss<Table>, sizes);
+    return;
+}
+
+const bool registered = [] {
+    register_table<swiss>("swiss_table");
+    register_table<robin_hood>("robin_hood");
+    register_table<concurrent>("concurrent_table");
+    register_table<std_unordered_map>("std::unordered_map");
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,252 @@
+/**
+ * @file bench_heaps.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The d-ary heaps of arity 2, 4 and 8 and the pairing heap against
+ * std::priority_queue: pushing random keys and popping them all, building
+ * a heap from a range, and Dijkstra's algorithm on a random graph with
+ * eight edges per vertex, either with lazy deletion of stale entries or
+ * with decrease_key.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "d_ary_heap.hpp"
+#include "pairing_heap.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+namespace data_structure = util::data_structure;
+
+using keys_type = std::vector<std::int64_t>;
+
+keys_type random_keys(const std::size_t n) {
+    std::mt19937_64 engine(2021);
+    keys_type keys(n);
+    for (std::int64_t& key : keys) {
+        key = static_cast<std::int64_t>(engine() >> 1);
+    }
+    return keys;
+}
+
+/* ------------------------------- push and pop ------------------------------- */
+
+template<typename Heap>
+void push_pop(state& s) {
+    const keys_type keys = random_keys(static_cast<std::size_t>(s.range()));
+    bool ordered = true;
+    for (auto _ : s) {
+        Heap heap;
+        for (const std::int64_t key : keys) {
+            heap.push(key);
+        }
+        std::int64_t previous = std::numeric_limits<std::int64_t>::max();
+        while (!heap.empty()) {
+            ordered = ordered && heap.top() <= previous;
+            previous = heap.top();
+            heap.pop();
+        }
+        do_not_optimize(previous);
+    }
+    if (!ordered) {
+        s.skip_with_error("keys popped out of order");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* --------------------------------- heapify ---------------------------------- */
+
+void std_make_heap(state& s) {
+    const keys_type keys = random_keys(static_cast<std::size_t>(s.range()));
+    keys_type heap;
+    for (auto _ : s) {
+        s.pause_timing();
+        heap = keys;
+        s.resume_timing();
+        std::make_heap(heap.begin(), heap.end());
+        do_not_optimize(heap.front());
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+template<std::size_t Arity>
+void d_ary_heapify(state& s) {
+    const keys_type keys = random_keys(static_cast<std::size_t>(s.range()));
+    const std::int64_t largest = *std::max_element(keys.begin(), keys.end());
+    std::int64_t top = 0;
+    for (auto _ : s) {
+        data_structure::d_ary_heap<std::int64_t, Arity> heap(keys.begin(), keys.end());
+        top = heap.top();
+        do_not_optimize(top);
+    }
+    if (top != largest) {
+        s.skip_with_error("wrong top");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* --------------------------------- dijkstra --------------------------------- */
+
+constexpr std::size_t degree = 8;
+constexpr std::int64_t unreachable = std::numeric_limits<std::int64_t>::max();
+
+/* random directed graph in compressed rows: the edges of v are [v * degree, (v + 1) * degree) */
+struct graph {
+    std::vector<std::uint32_t> to;
+    std::vector<std::int64_t> weight;
+
+    explicit graph(const std::size_t n) : to(n * degree), weight(n * degree) {
+        std::mt19937_64 engine(2021);
+        for (std::size_t e = 0; e < to.size(); ++e) {
+            /* the first edge of every vertex leads to the next one, so all are reachable */
+            to[e] = static_cast<std::uint32_t>(e % degree == 0 ? (e / degree + 1) % n : engine() % n);
+            weight[e] = static_cast<std::int64_t>(engine() % 1000 + 1);
+        }
+    }
+
+    std::size_t vertices() const { return to.size() / degree; }
+};
+
+/* stale (distance, vertex) entries stay queued and are skipped when popped */
+template<typename Heap>
+std::vector<std::int64_t> lazy_dijkstra(const graph& g) {
+    std::vector<std::int64_t> distance(g.vertices(), unreachable);
+    Heap frontier;
+    distance[0] = 0;
+    frontier.push({ 0, 0 });
+    while (!frontier.empty()) {
+        const auto [d, vertex] = frontier.top();
+        frontier.pop();
+        if (d != distance[vertex]) {
+            continue;
+        }
+        for (std::size_t e = vertex * degree; e < (vertex + 1) * degree; ++e) {
+            const std::int64_t through = d + g.weight[e];
+            if (through < distance[g.to[e]]) {
+                distance[g.to[e]] = through;
+                frontier.push({ through, g.to[e] });
+            }
+        }
+    }
+    return distance;
+}
+
+template<std::size_t Arity>
+std::vector<std::int64_t> indexed_dijkstra(const graph& g) {
+    std::vector<std::int64_t> distance(g.vertices(), unreachable);
+    data_structure::indexed_d_ary_heap<std::int64_t, Arity> frontier(g.vertices());
+    distance[0] = 0;
+    frontier.push(0, 0);
+    while (!frontier.empty()) {
+        const std::size_t vertex = frontier.top();
+        frontier.pop();
+        for (std::size_t e = vertex * degree; e < (vertex + 1) * degree; ++e) {
+            const std::int64_t through = distance[vertex] + g.weight[e];
+            if (through < distance[g.to[e]]) {
+                distance[g.to[e]] = through;
+                frontier.push_or_decrease(g.to[e], through);
+            }
+        }
+    }
+    return distance;
+}
+
+std::vector<std::int64_t> pairing_dijkstra(const graph& g) {
+    using entry = std::pair<std::int64_t, std::size_t>;
+    using heap_type = data_structure::pairing_heap<entry, std::greater<entry>>;
+    std::vector<std::int64_t> distance(g.vertices(), unreachable);
+    std::vector<heap_type::handle> handles(g.vertices());
+    std::vector<bool> queued(g.vertices(), false);
+    heap_type frontier;
+    distance[0] = 0;
+    handles[0] = frontier.push({ 0, 0 });
+    queued[0] = true;
+    while (!frontier.empty()) {
+        const std::size_t vertex = frontier.top().second;
+        frontier.pop();
+        queued[vertex] = false;
+        for (std::size_t e = vertex * degree; e < (vertex + 1) * degree; ++e) {
+            const std::size_t next = g.to[e];
+            const std::int64_t through = distance[vertex] + g.weight[e];
+            if (through < distance[next]) {
+                distance[next] = through;
+                if (queued[next]) {
+                    frontier.decrease_key(handles[next], { through, next });
+                }
+                else {
+                    handles[next] = frontier.push({ through, next });
+                    queued[next] = true;
+                }
+            }
+        }
+    }
+    return distance;
+}
+
+template<std::vector<std::int64_t> (*Dijkstra)(const graph&)>
+void dijkstra(state& s) {
+    const graph g(static_cast<std::size_t>(s.range()));
+    const std::vector<std::int64_t> expected =
+        lazy_dijkstra<std::priority_queue<std::pair<std::int64_t, std::size_t>,
+                                          std::vector<std::pair<std::int64_t, std::size_t>>, std::greater<>>>(g);
+    std::vector<std::int64_t> distance;
+    for (auto _ : s) {
+        distance = Dijkstra(g);
+        do_not_optimize(distance.data());
+    }
+    if (distance != expected) {
+        s.skip_with_error("wrong distances");
+    }
+    s.set_items_processed(s.iterations() * s.range() * static_cast<std::int64_t>(degree));
+    s.set_label("edges");
+    return;
+}
+
+using lazy_entry = std::pair<std::int64_t, std::size_t>;
+using std_lazy = std::priority_queue<lazy_entry, std::vector<lazy_entry>, std::greater<lazy_entry>>;
+using d_ary_lazy = data_structure::d_ary_heap<lazy_entry, 4, std::greater<lazy_entry>>;
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 16, std::int64_t{ 1 } << 20 };
+    register_benchmark("heap/push_pop/std::priority_queue", push_pop<std::priority_queue<std::int64_t>>, sizes);
+    register_benchmark("heap/push_pop/d_ary_heap<2>", push_pop<data_structure::d_ary_heap<std::int64_t, 2>>, sizes);
+    register_benchmark("heap/push_pop/d_ary_heap<4>", push_pop<data_structure::d_ary_heap<std::int64_t, 4>>, sizes);
+    register_benchmark("heap/push_pop/d_ary_heap<8>", push_pop<data_structure::d_ary_heap<std::int64_t, 8>>, sizes);
+    /* pointer chasing makes the pairing heap an order of magnitude slower at 2^20 */
+    const auto node_sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 16 };
+    register_benchmark("heap/push_pop/pairing_heap", push_pop<data_structure::pairing_heap<std::int64_t>>, node_sizes);
+
+    register_benchmark("heap/heapify/std::make_heap", std_make_heap, sizes);
+    register_benchmark("heap/heapify/d_ary_heap<4>", d_ary_heapify<4>, sizes);
+    register_benchmark("heap/heapify/d_ary_heap<8>", d_ary_heapify<8>, sizes);
+
+    const auto graph_sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 16, std::int64_t{ 1 } << 18 };
+    register_benchmark("heap/dijkstra/std::priority_queue", dijkstra<lazy_dijkstra<std_lazy>>, graph_sizes);
+    register_benchmark("heap/dijkstra/d_ary_heap<4>", dijkstra<lazy_dijkstra<d_ary_lazy>>, graph_sizes);
+    register_benchmark("heap/dijkstra/indexed_d_ary_heap<4>", dijkstra<indexed_dijkstra<4>>, graph_sizes);
+    register_benchmark("heap/dijkstra/indexed_d_ary_heap<8>", dijkstra<indexed_dijkstra<8>>, graph_sizes);
+    register_benchmark("heap/dijkstra/pairing_heap", dijkstra<pairing_dijkstra>, graph_sizes);
+    return true;
+}();
+
+} // namespace
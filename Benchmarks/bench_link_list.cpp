@@ -0,0 +1,167 @@
+/**
+ * @file bench_link_list.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The C-style LinkList against std::forward_list: building a list by
+ * inserting at the front, and 64 lookups by value and by position.
+ *
+ * LinkList.h defines its functions in the header, so it is included by this
+ * translation unit only.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+
+#include "LinkList.h"
+#include "bench_harness.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+
+constexpr int lookups = 64;
+
+/* the j-th of `lookups` values probed in a list holding 0 .. n - 1 */
+int probe(const int j, const int n) {
+    return static_cast<int>((static_cast<std::uint64_t>(j) * 2654435761u) % static_cast<std::uint64_t>(n));
+}
+
+/* a list holding n - 1 .. 0, built the way the benchmarks build it */
+LinkList build_link_list(const int n) {
+    LinkList head;
+    InitLinkList(&head);
+    for (int i = 0; i < n; ++i) {
+        InsertList(head, 1, i);
+    }
+    return head;
+}
+
+void link_list_build(state& s) {
+    const int n = static_cast<int>(s.range());
+    for (auto _ : s) {
+        LinkList head = build_link_list(n);
+        do_not_optimize(head);
+        DestroyLinkList(head);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_forward_list_build(state& s) {
+    const int n = static_cast<int>(s.range());
+    for (auto _ : s) {
+        std::forward_list<int> list;
+        for (int i = 0; i < n; ++i) {
+            list.push_front(i);
+        }
+        do_not_optimize(list.front());
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* value v sits at 1-based position n - v */
+void link_list_locate(state& s) {
+    const int n = static_cast<int>(s.range());
+    LinkList head = build_link_list(n);
+    std::int64_t positions = 0;
+    for (auto _ : s) {
+        positions = 0;
+        for (int j = 0; j < lookups; ++j) {
+            positions += GetElementPos(head, probe(j, n));
+        }
+        do_not_optimize(positions);
+    }
+    DestroyLinkList(head);
+    std::int64_t expected = 0;
+    for (int j = 0; j < lookups; ++j) {
+        expected += n - probe(j, n);
+    }
+    if (positions != expected) {
+        s.skip_with_error("wrong positions");
+    }
+    s.set_items_processed(s.iterations() * lookups);
+    return;
+}
+
+void std_forward_list_locate(state& s) {
+    const int n = static_cast<int>(s.range());
+    std::forward_list<int> list;
+    for (int i = 0; i < n; ++i) {
+        list.push_front(i);
+    }
+    std::int64_t positions = 0;
+    for (auto _ : s) {
+        positions = 0;
+        for (int j = 0; j < lookups; ++j) {
+            positions += std::distance(list.begin(), std::find(list.begin(), list.end(), probe(j, n))) + 1;
+        }
+        do_not_optimize(positions);
+    }
+    s.set_items_processed(s.iterations() * lookups);
+    return;
+}
+
+/* position p holds n - p */
+void link_list_get(state& s) {
+    const int n = static_cast<int>(s.range());
+    LinkList head = build_link_list(n);
+    std::int64_t values = 0;
+    for (auto _ : s) {
+        values = 0;
+        for (int j = 0; j < lookups; ++j) {
+            values += GetElement(head, probe(j, n) + 1)->data;
+        }
+        do_not_optimize(values);
+    }
+    DestroyLinkList(head);
+    std::int64_t expected = 0;
+    for (int j = 0; j < lookups; ++j) {
+        expected += n - 1 - probe(j, n);
+    }
+    if (values != expected) {
+        s.skip_with_error("wrong values");
+    }
+    s.set_items_processed(s.iterations() * lookups);
+    return;
+}
+
+void std_forward_list_get(state& s) {
+    const int n = static_cast<int>(s.range());
+    std::forward_list<int> list;
+    for (int i = 0; i < n; ++i) {
+        list.push_front(i);
+    }
+    std::int64_t values = 0;
+    for (auto _ : s) {
+        values = 0;
+        for (int j = 0; j < lookups; ++j) {
+            values += *std::next(list.begin(), probe(j, n));
+        }
+        do_not_optimize(values);
+    }
+    s.set_items_processed(s.iterations() * lookups);
+    return;
+}
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 8, std::int64_t{ 1 } << 12, std::int64_t{ 1 } << 16 };
+    register_benchmark("link_list/build/LinkList", link_list_build, sizes);
+    register_benchmark("link_list/build/std::forward_list", std_forward_list_build, sizes);
+    register_benchmark("link_list/locate/LinkList", link_list_locate, sizes);
+    register_benchmark("link_list/locate/std::forward_list", std_forward_list_locate, sizes);
+    register_benchmark("link_list/get/LinkList", link_list_get, sizes);
+    register_benchmark("link_list/get/std::forward_list", std_forward_list_get, sizes);
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,71 @@
+/**
+ * @file bench_main.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Entry point of the benchmark suite; the cases register themselves
+ * from the other translation units.
+ *
+ * To build and run with CMake:
+ * $ cmake -S Benchmarks -B build -DCMAKE_BUILD_TYPE=Release
+ * $ cmake --build build
+ * $ ./build/benchmarks --filter=^sort/random --out=sort.json
+ *
+ * Built with -DBENCH_INSTRUMENTATION=ON, --stats=<file> also writes the
+ * counters of the containers and the hash tables as JSON, summed over
+ * every iteration of every case that ran, so filter down to one case:
+ * $ ./build/benchmarks --filter=^hash_table/insert/swiss_table/1024$ --stats=swiss.json
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "instrumentation.hpp"
+#include "table_stats.h"
+
+namespace {
+
+/* {"containers": {...}, "hash_tables": {...}}, false if the file cannot be written */
+bool write_stats(const std::string& path) {
+    std::FILE* const out = std::fopen(path.c_str(), "w");
+    if (out == nullptr) {
+        std::fprintf(stderr, "cannot write %s\n", path.c_str());
+        return false;
+    }
+    std::ostringstream containers;
+    util::instrumentation::write_json(containers);
+    std::fprintf(out, "{\n\"containers\": %s,\n\"hash_tables\": ", containers.str().c_str());
+    hash_table_stats_write_json(out);
+    std::fprintf(out, "}\n");
+    return std::fclose(out) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    /* --stats is ours, every other flag goes to the harness */
+    std::string stats;
+    std::vector<char*> args;
+    for (int i = 0; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (i > 0 && arg.starts_with("--stats=")) {
+            stats = arg.substr(8);
+        }
+        else {
+            args.push_back(argv[i]);
+        }
+    }
+    const int status = util::benchmark::run(static_cast<int>(args.size()), args.data());
+    if (!stats.empty() && !write_stats(stats)) {
+        return EXIT_FAILURE;
+    }
+    return status;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file bench_ordered_maps.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The B+-tree map, with nodes of eight cache lines and of a page,
+ * and the flat sorted map against std::map on 8-byte keys and values:
+ * lookups of random present keys, inserting random keys one at a time and
+ * in one batch, building from sorted input, a full scan in key order and
+ * erasing every key in random order.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "bplus_tree.hpp"
+#include "flat_map.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+namespace data_structure = util::data_structure;
+
+using element = std::pair<std::uint64_t, std::uint64_t>;
+using std_map = std::map<std::uint64_t, std::uint64_t>;
+using bplus_tree = data_structure::bplus_tree_map<std::uint64_t, std::uint64_t>;
+using bplus_tree_page = data_structure::bplus_tree_map<std::uint64_t, std::uint64_t, std::less<std::uint64_t>, 4096>;
+using flat_map = data_structure::flat_map<std::uint64_t, std::uint64_t>;
+
+/* n distinct random keys in random order */
+std::vector<std::uint64_t> random_keys(const std::size_t n) {
+    std::mt19937_64 engine(2021);
+    std::vector<std::uint64_t> keys(n);
+    for (std::uint64_t& key : keys) {
+        key = engine() >> 1;
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    std::shuffle(keys.begin(), keys.end(), engine);
+    return keys;
+}
+
+std::vector<element> sorted_elements(std::vector<std::uint64_t> keys) {
+    std::sort(keys.begin(), keys.end());
+    std::vector<element> elements;
+    elements.reserve(keys.size());
+    for (const std::uint64_t key : keys) {
+        elements.emplace_back(key, key / 2);
+    }
+    return elements;
+}
+
+/* std::map fills from sorted input with end() as hint, the B+-tree with bulk_load, flat_map by appending */
+template<typename Map>
+void load(Map& map, const std::vector<element>& sorted) {
+    if constexpr (std::is_same_v<Map, std_map>) {
+        map.clear();
+        for (const element& e : sorted) {
+            map.emplace_hint(map.end(), e);
+        }
+    }
+    else if constexpr (std::is_same_v<Map, flat_map>) {
+        map.clear();
+        map.insert(data_structure::sorted_unique, sorted.begin(), sorted.end());
+    }
+    else {
+        map.bulk_load(sorted);
+    }
+    return;
+}
+
+/* ---------------------------------- find ------------------------------------ */
+
+template<typename Map>
+void find(state& s) {
+    const std::vector<std::uint64_t> keys = random_keys(static_cast<std::size_t>(s.range()));
+    Map map;
+    load(map, sorted_elements(keys));
+    std::uint64_t sum = 0;
+    for (auto _ : s) {
+        for (const std::uint64_t key : keys) {
+            sum += map.find(key)->second;
+        }
+        do_not_optimize(sum);
+    }
+    s.set_items_processed(s.iterations() * static_cast<std::int64_t>(keys.size()));
+    return;
+}
+
+/* --------------------------------- insert ----------------------------------- */
+
+template<typename Map>
+void insert(state& s) {
+    const std::vector<std::uint64_t> keys = random_keys(static_cast<std::size_t>(s.range()));
+    bool complete = true;
+    for (auto _ : s) {
+        Map map;
+        for (const std::uint64_t key : keys) {
+            map.try_emplace(key, key / 2);
+        }
+        complete = complete && map.size() == keys.size();
+        do_not_optimize(map);
+    }
+    if (!complete) {
+        s.skip_with_error("keys lost");
+    }
+    s.set_items_processed(s.iterations() * static_cast<std::int64_t>(keys.size()));
+    return;
+}
+
+/* ------------------------------ batch insert -------------------------------- */
+
+/* every element in random order at once: one insert(first, last) for flat_map, one by one for std::map */
+template<typename Map>
+void batch_insert(state& s) {
+    const std::vector<std::uint64_t> keys = random_keys(static_cast<std::size_t>(s.range()));
+    std::vector<element> batch;
+    batch.reserve(keys.size());
+    for (const std::uint64_t key : keys) {
+        batch.emplace_back(key, key / 2);
+    }
+    bool complete = true;
+    for (auto _ : s) {
+        Map map;
+        map.insert(batch.begin(), batch.end());
+        complete = complete && map.size() == batch.size();
+        do_not_optimize(map);
+    }
+    if (!complete) {
+        s.skip_with_error("keys lost");
+    }
+    s.set_items_processed(s.iterations() * static_cast<std::int64_t>(batch.size()));
+    return;
+}
+
+/* -------------------------------- bulk load --------------------------------- */
+
+template<typename Map>
+void bulk_load(state& s) {
+    const std::vector<element> sorted = sorted_elements(random_keys(static_cast<std::size_t>(s.range())));
+    for (auto _ : s) {
+        Map map;
+        load(map, sorted);
+        do_not_optimize(map);
+    }
+    s.set_items_processed(s.iterations() * static_cast<std::int64_t>(sorted.size()));
+    return;
+}
+
+/* ---------------------------------- scan ------------------------------------ */
+
+template<typename Map>
+void scan(state& s) {
+    const std::vector<element> sorted = sorted_elements(random_keys(static_cast<std::size_t>(s.range())));
+    Map map;
+    load(map, sorted);
+    std::uint64_t sum = 0;
+    for (auto _ : s) {
+        for (const auto& [key, value] : map) {
+            sum += value;
+        }
+        do_not_optimize(sum);
+    }
+    s.set_items_processed(s.iterations() * static_cast<std::int64_t>(sorted.size()));
+    return;
+}
+
+/* ---------------------------------- erase ----------------------------------- */
+
+template<typename Map>
+void erase(state& s) {
+    const std::vector<std::uint64_t> keys = random_keys(static_cast<std::size_t>(s.range()));
+    const std::vector<element> sorted = sorted_elements(keys);
+    bool emptied = true;
+    for (auto _ : s) {
+        s.pause_timing();
+        Map map;
+        load(map, sorted);
+        s.resume_timing();
+        for (const std::uint64_t key : keys) {
+            map.erase(key);
+        }
+        emptied = emptied && map.empty();
+        do_not_optimize(map);
+    }
+    if (!emptied) {
+        s.skip_with_error("keys left after erasing all");
+    }
+    s.set_items_processed(s.iterations() * static_cast<std::int64_t>(keys.size()));
+    return;
+}
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 16, std::int64_t{ 1 } << 20 };
+    register_benchmark("ordered/find/std::map", find<std_map>, sizes);
+    register_benchmark("ordered/find/bplus_tree_map", find<bplus_tree>, sizes);
+    register_benchmark("ordered/find/bplus_tree_map<4096>", find<bplus_tree_page>, sizes);
+    register_benchmark("ordered/find/flat_map", find<flat_map>, sizes);
+
+    register_benchmark("ordered/insert/std::map", insert<std_map>, sizes);
+    register_benchmark("ordered/insert/bplus_tree_map", insert<bplus_tree>, sizes);
+    register_benchmark("ordered/insert/bplus_tree_map<4096>", insert<bplus_tree_page>, sizes);
+    /* each insert shifts half the array on average, quadratic in total */
+    register_benchmark("ordered/insert/flat_map", insert<flat_map>, { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 16 });
+
+    register_benchmark("ordered/batch_insert/std::map", batch_insert<std_map>, sizes);
+    register_benchmark("ordered/batch_insert/flat_map", batch_insert<flat_map>, sizes);
+
+    register_benchmark("ordered/bulk_load/std::map", bulk_load<std_map>, sizes);
+    register_benchmark("ordered/bulk_load/bplus_tree_map", bulk_load<bplus_tree>, sizes);
+    register_benchmark("ordered/bulk_load/flat_map", bulk_load<flat_map>, sizes);
+
+    register_benchmark("ordered/scan/std::map", scan<std_map>, sizes);
+    register_benchmark("ordered/scan/bplus_tree_map", scan<bplus_tree>, sizes);
+    register_benchmark("ordered/scan/flat_map", scan<flat_map>, sizes);
+
+    register_benchmark("ordered/erase/std::map", erase<std_map>, sizes);
+    register_benchmark("ordered/erase/bplus_tree_map", erase<bplus_tree>, sizes);
+    return true;
+}();
+
+} // namespace
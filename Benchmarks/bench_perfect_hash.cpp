@@ -0,0 +1,168 @@
+/**
+ * @file bench_perfect_hash.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief A fixed set of CPerson names in perfect_hash_map against
+ * std::unordered_map: building the table once, then looking up names that
+ * are present and names that are not. The key count is a template
+ * argument of perfect_hash_map, so each size is a case of its own.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "bench_harness.hpp"
+#include "perfect_hash.hpp"
+#include "person.h"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+namespace data_structure = util::data_structure;
+
+/* n records named "person-<i>", or "missing-<i>" for names never inserted */
+std::unique_ptr<CPerson[]> make_people(const std::size_t n, const char* const prefix) {
+    auto people = std::make_unique<CPerson[]>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::snprintf(people[i].name, MAX_NAME, "%s-%zu", prefix, i);
+        people[i].age = static_cast<int>(i % 100);
+    }
+    return people;
+}
+
+template<std::size_t _Size>
+using perfect_people = data_structure::perfect_hash_map<std::string_view, CPerson*, _Size>;
+
+/* the entries are large for the stack at 2^14 names, so they live on the heap */
+template<std::size_t _Size>
+std::unique_ptr<std::array<std::pair<std::string_view, CPerson*>, _Size>> make_entries(CPerson* const people) {
+    auto entries = std::make_unique<std::array<std::pair<std::string_view, CPerson*>, _Size>>();
+    for (std::size_t i = 0; i < _Size; ++i) {
+        (*entries)[i] = { people[i].name, &people[i] };
+    }
+    return entries;
+}
+
+struct std_unordered_map {
+    std::unordered_map<std::string_view, CPerson*> table;
+    CPerson* lookup(const char* const name) const {
+        const auto found = table.find(name);
+        return found == table.end() ? nullptr : found->second;
+    }
+};
+
+/* ---------------------------------- build ----------------------------------- */
+
+template<std::size_t _Size>
+void build_perfect(state& s) {
+    const std::unique_ptr<CPerson[]> people = make_people(_Size, "person");
+    const auto entries = make_entries<_Size>(people.get());
+    for (auto _ : s) {
+        const auto table = std::make_unique<perfect_people<_Size>>(*entries);
+        do_not_optimize(table);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+template<std::size_t _Size>
+void build_unordered(state& s) {
+    const std::unique_ptr<CPerson[]> people = make_people(_Size, "person");
+    for (auto _ : s) {
+        std_unordered_map table;
+        table.table.reserve(_Size);
+        for (std::size_t i = 0; i < _Size; ++i) {
+            table.table.emplace(people[i].name, &people[i]);
+        }
+        do_not_optimize(table);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* --------------------------------- lookup ----------------------------------- */
+
+/* `prefix` "person" looks up every name of the table, "missing" as many absent ones */
+template<typename _Table>
+void lookup(state& s, const _Table& table, const char* const prefix) {
+    const std::size_t n = static_cast<std::size_t>(s.range());
+    const std::unique_ptr<CPerson[]> queries = make_people(n, prefix);
+    std::size_t found = 0;
+    for (auto _ : s) {
+        found = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            found += table.lookup(queries[i].name) != nullptr;
+        }
+        do_not_optimize(found);
+    }
+    if (found != (std::string_view(prefix) == "person" ? n : 0)) {
+        s.skip_with_error("wrong number of names found");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+template<std::size_t _Size>
+struct perfect {
+    std::unique_ptr<perfect_people<_Size>> table;
+    CPerson* lookup(const char* const name) const {
+        const auto found = table->find(name);
+        return found == table->end() ? nullptr : found->second;
+    }
+};
+
+template<std::size_t _Size>
+void lookup_perfect(state& s, const char* const prefix) {
+    const std::unique_ptr<CPerson[]> people = make_people(_Size, "person");
+    const perfect<_Size> table{ std::make_unique<perfect_people<_Size>>(*make_entries<_Size>(people.get())) };
+    lookup(s, table, prefix);
+    return;
+}
+
+template<std::size_t _Size>
+void lookup_unordered(state& s, const char* const prefix) {
+    const std::unique_ptr<CPerson[]> people = make_people(_Size, "person");
+    std_unordered_map table;
+    for (std::size_t i = 0; i < _Size; ++i) {
+        table.table.emplace(people[i].name, &people[i]);
+    }
+    lookup(s, table, prefix);
+    return;
+}
+
+template<std::size_t _Size>
+void register_size() {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { static_cast<std::int64_t>(_Size) };
+    register_benchmark("perfect_hash/build/perfect_hash_map", build_perfect<_Size>, sizes);
+    register_benchmark("perfect_hash/build/std::unordered_map", build_unordered<_Size>, sizes);
+
+    register_benchmark("perfect_hash/lookup_hit/perfect_hash_map",
+                       [](state& s) { lookup_perfect<_Size>(s, "person"); }, sizes);
+    register_benchmark("perfect_hash/lookup_hit/std::unordered_map",
+                       [](state& s) { lookup_unordered<_Size>(s, "person"); }, sizes);
+    register_benchmark("perfect_hash/lookup_miss/perfect_hash_map",
+                       [](state& s) { lookup_perfect<_Size>(s, "missing"); }, sizes);
+    register_benchmark("perfect_hash/lookup_miss/std::unordered_map",
+                       [](state& s) { lookup_unordered<_Size>(s, "missing"); }, sizes);
+    return;
+}
+
+const bool registered = [] {
+    register_size<std::size_t{ 1 } << 10>();
+    register_size<std::size_t{ 1 } << 14>();
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,221 @@
+/**
+ * @file bench_queues.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The lock-free bounded queues against a mutex-guarded std::deque,
+ * the way work is handed between threads without them: the cost of a push
+ * and pop on one thread, throughput from a producer thread to a consumer
+ * thread, and the round-trip latency of a ping-pong between two threads.
+ *
+ * The threaded cases wait with std::this_thread::yield(), so they finish on
+ * a single core too, where every handoff costs a context switch instead of
+ * a cache line transfer. Compare them on a machine with at least two cores.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "bench_harness.hpp"
+#include "bounded_queue.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+
+constexpr std::size_t capacity = 1024;
+constexpr std::size_t batch = 32;
+
+using spsc = util::data_structure::spsc_ring_buffer<std::int64_t>;
+using mpmc = util::data_structure::mpmc_queue<std::int64_t>;
+
+/* what the queues replace: unbounded, every operation takes the lock */
+struct mutex_deque {
+    std::mutex mutex;
+    std::deque<std::int64_t> queue;
+
+    explicit mutex_deque(std::size_t) {}
+
+    bool try_push(const std::int64_t value) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(value);
+        return true;
+    }
+
+    bool try_pop(std::int64_t& value) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+        value = queue.front();
+        queue.pop_front();
+        return true;
+    }
+};
+
+template<typename Queue>
+void push(Queue& queue, const std::int64_t value) {
+    while (!queue.try_push(value)) {
+        std::this_thread::yield();
+    }
+    return;
+}
+
+template<typename Queue>
+std::int64_t pop(Queue& queue) {
+    std::int64_t value = 0;
+    while (!queue.try_pop(value)) {
+        std::this_thread::yield();
+    }
+    return value;
+}
+
+void check_sum(state& s, const std::int64_t sum) {
+    if (sum != s.range() * (s.range() - 1) / 2) {
+        s.skip_with_error("wrong sum");
+    }
+    return;
+}
+
+/* n pushes and pops on one thread, 16 at a time: the cost of the operations alone */
+template<typename Queue>
+void push_pop(state& s) {
+    Queue queue(capacity);
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (std::int64_t i = 0; i < s.range(); i += 16) {
+            for (std::int64_t j = 0; j < 16; ++j) {
+                queue.try_push(i + j);
+            }
+            for (std::int64_t j = 0; j < 16; ++j) {
+                std::int64_t value = 0;
+                queue.try_pop(value);
+                sum += value;
+            }
+        }
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* a producer thread pushes 0 .. n - 1, this thread pops them */
+template<typename Queue>
+void throughput(state& s) {
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        Queue queue(capacity);
+        std::thread producer([&queue, n = s.range()] {
+            for (std::int64_t i = 0; i < n; ++i) {
+                push(queue, i);
+            }
+        });
+        sum = 0;
+        for (std::int64_t i = 0; i < s.range(); ++i) {
+            sum += pop(queue);
+        }
+        producer.join();
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* the same with batch operations, up to 32 elements per release store */
+void spsc_batch_throughput(state& s) {
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        spsc queue(capacity);
+        std::thread producer([&queue, n = s.range()] {
+            std::array<std::int64_t, batch> staged{};
+            for (std::int64_t next = 0; next < n;) {
+                const std::size_t count = std::min<std::size_t>(batch, static_cast<std::size_t>(n - next));
+                for (std::size_t i = 0; i < count; ++i) {
+                    staged[i] = next + static_cast<std::int64_t>(i);
+                }
+                for (std::size_t pushed = 0; pushed < count;) {
+                    pushed += queue.try_push_n(staged.begin() + pushed, count - pushed);
+                    if (pushed < count) {
+                        std::this_thread::yield();
+                    }
+                }
+                next += static_cast<std::int64_t>(count);
+            }
+        });
+        sum = 0;
+        std::array<std::int64_t, batch> received{};
+        for (std::int64_t popped = 0; popped < s.range();) {
+            const std::size_t count = queue.try_pop_n(received.begin(), batch);
+            for (std::size_t i = 0; i < count; ++i) {
+                sum += received[i];
+            }
+            popped += static_cast<std::int64_t>(count);
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* n round trips: this thread sends i, an echo thread sends it back; time per round trip */
+template<typename Queue>
+void latency(state& s) {
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        Queue ping(capacity);
+        Queue pong(capacity);
+        std::thread echo([&ping, &pong, n = s.range()] {
+            for (std::int64_t i = 0; i < n; ++i) {
+                push(pong, pop(ping));
+            }
+        });
+        sum = 0;
+        for (std::int64_t i = 0; i < s.range(); ++i) {
+            push(ping, i);
+            sum += pop(pong);
+        }
+        echo.join();
+        do_not_optimize(sum);
+    }
+    check_sum(s, sum);
+    s.set_items_processed(s.iterations() * s.range());
+    s.set_label("round trips");
+    return;
+}
+
+template<typename Queue>
+void register_queue(const char* const name) {
+    using util::benchmark::register_benchmark;
+    register_benchmark(std::string("queue/push_pop/") + name, push_pop<Queue>, { 1024, 65536 });
+    register_benchmark(std::string("queue/throughput/") + name, throughput<Queue>, { 1024, 65536 });
+    register_benchmark(std::string("queue/latency/") + name, latency<Queue>, { 1024 });
+    return;
+}
+
+const bool registered = [] {
+    register_queue<spsc>("spsc_ring_buffer");
+    util::benchmark::register_benchmark("queue/throughput/spsc_ring_buffer_batch", spsc_batch_throughput, { 1024, 65536 });
+    register_queue<mpmc>("mpmc_queue");
+    register_queue<mutex_deque>("mutex_deque");
+    return true;
+}();
+
+} // namespace
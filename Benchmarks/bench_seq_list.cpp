@@ -0,0 +1,113 @@
+/**
+ * @file bench_seq_list.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The fixed-capacity SeqList against std::vector: inserting at the
+ * front, which shifts every element, and locating elements by value.
+ * SeqList holds at most LISTSIZE elements, hence the small sizes.
+ *
+ * SeqList.h defines its functions in the header, so it is included by this
+ * translation unit only.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "SeqList.h"
+#include "bench_harness.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+
+void seq_list_insert_front(state& s) {
+    const int n = static_cast<int>(s.range());
+    SeqList list;
+    for (auto _ : s) {
+        InitList(&list);
+        for (int i = 0; i < n; ++i) {
+            InsertElement(&list, 1, i);
+        }
+        do_not_optimize(list);
+    }
+    if (ListLength(list) != n || list.list[0] != n - 1) {
+        s.skip_with_error("wrong contents");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_vector_insert_front(state& s) {
+    const int n = static_cast<int>(s.range());
+    std::vector<int> list;
+    for (auto _ : s) {
+        list.clear();
+        list.reserve(LISTSIZE);
+        for (int i = 0; i < n; ++i) {
+            list.insert(list.begin(), i);
+        }
+        do_not_optimize(list.data());
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* every value once: n lookups over a list holding 0 .. n - 1 */
+void seq_list_locate(state& s) {
+    const int n = static_cast<int>(s.range());
+    SeqList list;
+    InitList(&list);
+    for (int i = 0; i < n; ++i) {
+        InsertElement(&list, i + 1, i);
+    }
+    std::int64_t positions = 0;
+    for (auto _ : s) {
+        positions = 0;
+        for (int i = 0; i < n; ++i) {
+            positions += LocElement(list, i);
+        }
+        do_not_optimize(positions);
+    }
+    if (positions != std::int64_t{ n } * (n + 1) / 2) {
+        s.skip_with_error("wrong positions");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void std_vector_locate(state& s) {
+    const int n = static_cast<int>(s.range());
+    std::vector<int> list(static_cast<std::size_t>(n));
+    for (int i = 0; i < n; ++i) {
+        list[static_cast<std::size_t>(i)] = i;
+    }
+    std::int64_t positions = 0;
+    for (auto _ : s) {
+        positions = 0;
+        for (int i = 0; i < n; ++i) {
+            positions += std::find(list.begin(), list.end(), i) - list.begin() + 1;
+        }
+        do_not_optimize(positions);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 16 }, std::int64_t{ 64 }, std::int64_t{ LISTSIZE } };
+    register_benchmark("seq_list/insert_front/SeqList", seq_list_insert_front, sizes);
+    register_benchmark("seq_list/insert_front/std::vector", std_vector_insert_front, sizes);
+    register_benchmark("seq_list/locate/SeqList", seq_list_locate, sizes);
+    register_benchmark("seq_list/locate/std::vector", std_vector_locate, sizes);
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,151 @@
+/**
+ * @file bench_soa.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief CPerson records stored whole in a std::vector against their name
+ * and age columns in a soa_vector: summing all ages, counting the ages in
+ * a range, which the column turns into a vectorized loop, and appending
+ * records. Sizes stop at 2^18 records, 68 MB per layout.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "person.h"
+#include "soa_vector.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+namespace data_structure = util::data_structure;
+
+using people_columns = data_structure::soa_vector<CPerson, &CPerson::name, &CPerson::age>;
+
+std::vector<CPerson> make_records(const std::size_t n) {
+    std::vector<CPerson> records(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::snprintf(records[i].name, MAX_NAME, "person %zu", i);
+        records[i].age = static_cast<int>(i * 7919 % 100);
+    }
+    return records;
+}
+
+people_columns make_columns(const std::vector<CPerson>& records) {
+    people_columns people;
+    people.reserve(records.size());
+    for (const CPerson& record : records) {
+        people.push_back(record);
+    }
+    return people;
+}
+
+/* -------------------------------- sum ages ---------------------------------- */
+
+void sum_ages_records(state& s) {
+    const std::vector<CPerson> records = make_records(static_cast<std::size_t>(s.range()));
+    for (auto _ : s) {
+        std::int64_t sum = 0;
+        for (const CPerson& record : records) {
+            sum += record.age;
+        }
+        do_not_optimize(sum);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void sum_ages_columns(state& s) {
+    const people_columns people = make_columns(make_records(static_cast<std::size_t>(s.range())));
+    const std::span<const int> ages = people.column<&CPerson::age>();
+    for (auto _ : s) {
+        std::int64_t sum = 0;
+        for (const int age : ages) {
+            sum += age;
+        }
+        do_not_optimize(sum);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* ------------------------------- count range -------------------------------- */
+
+void count_range_records(state& s) {
+    const std::vector<CPerson> records = make_records(static_cast<std::size_t>(s.range()));
+    for (auto _ : s) {
+        std::int64_t count = 0;
+        for (const CPerson& record : records) {
+            count += record.age >= 18 && record.age < 65;
+        }
+        do_not_optimize(count);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void count_range_columns(state& s) {
+    const people_columns people = make_columns(make_records(static_cast<std::size_t>(s.range())));
+    const std::span<const int> ages = people.column<&CPerson::age>();
+    for (auto _ : s) {
+        std::int64_t count = 0;
+        for (const int age : ages) {
+            count += age >= 18 && age < 65;
+        }
+        do_not_optimize(count);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* -------------------------------- push_back --------------------------------- */
+
+void push_back_records(state& s) {
+    const std::vector<CPerson> records = make_records(static_cast<std::size_t>(s.range()));
+    for (auto _ : s) {
+        std::vector<CPerson> copy;
+        for (const CPerson& record : records) {
+            copy.push_back(record);
+        }
+        do_not_optimize(copy);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+void push_back_columns(state& s) {
+    const std::vector<CPerson> records = make_records(static_cast<std::size_t>(s.range()));
+    for (auto _ : s) {
+        people_columns people;
+        for (const CPerson& record : records) {
+            people.push_back(record);
+        }
+        do_not_optimize(people);
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 14, std::int64_t{ 1 } << 18 };
+    register_benchmark("soa/sum_ages/std::vector<CPerson>", sum_ages_records, sizes);
+    register_benchmark("soa/sum_ages/soa_vector", sum_ages_columns, sizes);
+
+    register_benchmark("soa/count_range/std::vector<CPerson>", count_range_records, sizes);
+    register_benchmark("soa/count_range/soa_vector", count_range_columns, sizes);
+
+    register_benchmark("soa/push_back/std::vector<CPerson>", push_back_records, sizes);
+    register_benchmark("soa/push_back/soa_vector", push_back_columns, sizes);
+    return true;
+}();
+
+} // namespace
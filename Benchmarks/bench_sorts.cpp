@@ -0,0 +1,175 @@
+/**
+ * @file bench_sorts.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief Every sort of Algorithms/Sort against std::sort and std::stable_sort
+ * on int64 keys: random, sorted, reversed, few unique and nearly sorted
+ * inputs of 2^10, 2^16 and 2^20 keys. The quadratic sorts only run on the
+ * smallest size; external_sort sorts a file with a budget of a quarter of it,
+ * so it always forms and merges several runs.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <initializer_list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "external_sort.hpp"
+#include "parallel_sort.hpp"
+#include "pdqsort.hpp"
+#include "radix_sort.hpp"
+#include "simd_sort.hpp"
+#include "sort.hpp"
+#include "timsort.hpp"
+
+namespace {
+
+using util::benchmark::state;
+namespace algorithm = util::algorithm;
+
+using keys_type = std::vector<std::int64_t>;
+
+enum class distribution { random, sorted, reversed, few_unique, nearly_sorted };
+
+constexpr std::pair<distribution, const char*> distributions[] = {
+    { distribution::random, "random" },
+    { distribution::sorted, "sorted" },
+    { distribution::reversed, "reversed" },
+    { distribution::few_unique, "few_unique" },
+    { distribution::nearly_sorted, "nearly_sorted" },
+};
+
+keys_type generate(const distribution shape, const std::size_t n) {
+    std::mt19937_64 engine(2021);
+    keys_type keys(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = static_cast<std::int64_t>(engine());
+    }
+    switch (shape) {
+    case distribution::random:
+        break;
+    case distribution::sorted:
+        std::sort(keys.begin(), keys.end());
+        break;
+    case distribution::reversed:
+        std::sort(keys.begin(), keys.end(), std::greater<>{});
+        break;
+    case distribution::few_unique:
+        for (std::int64_t& key : keys) {
+            key &= 15;
+        }
+        break;
+    case distribution::nearly_sorted:
+        /* 1% of the keys swapped with random others */
+        std::sort(keys.begin(), keys.end());
+        for (std::size_t i = 0; i < n / 200; ++i) {
+            std::swap(keys[engine() % n], keys[engine() % n]);
+        }
+        break;
+    }
+    return keys;
+}
+
+/* sort a fresh copy of the input every iteration; only the sort is timed */
+template<typename Sorter>
+util::benchmark::benchmark_function in_memory(const distribution shape, Sorter sorter) {
+    return [shape, sorter](state& s) {
+        const keys_type input = generate(shape, static_cast<std::size_t>(s.range()));
+        keys_type keys;
+        for (auto _ : s) {
+            s.pause_timing();
+            keys = input;
+            s.resume_timing();
+            sorter(keys);
+        }
+        if (!std::is_sorted(keys.begin(), keys.end())) {
+            s.skip_with_error("output is not sorted");
+        }
+        s.set_items_processed(s.iterations() * s.range());
+        s.set_bytes_processed(s.iterations() * s.range() * static_cast<std::int64_t>(sizeof(std::int64_t)));
+        return;
+    };
+}
+
+/* file to file; the input file is written once and never modified */
+util::benchmark::benchmark_function external(const distribution shape, const char* const shape_name) {
+    return [shape, shape_name](state& s) {
+        const keys_type input = generate(shape, static_cast<std::size_t>(s.range()));
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        const std::string stem = "bench_external_" + std::string(shape_name) + "_" + std::to_string(s.range());
+        const std::filesystem::path in = directory / (stem + ".in");
+        const std::filesystem::path out = directory / (stem + ".out");
+        std::FILE* const file = std::fopen(in.string().c_str(), "wb");
+        if (file == nullptr) {
+            s.skip_with_error("cannot create " + in.string());
+            return;
+        }
+        std::fwrite(input.data(), sizeof(std::int64_t), input.size(), file);
+        std::fclose(file);
+
+        algorithm::external_sort_options options;
+        options.memory_budget = input.size() * sizeof(std::int64_t) / 4;
+        options.temp_directory = directory;
+        for (auto _ : s) {
+            algorithm::external_sort<std::int64_t>(in, out, options);
+        }
+
+        keys_type sorted(input.size());
+        std::FILE* const result = std::fopen(out.string().c_str(), "rb");
+        const std::size_t read = result == nullptr ? 0 : std::fread(sorted.data(), sizeof(std::int64_t), sorted.size(), result);
+        if (result != nullptr) {
+            std::fclose(result);
+        }
+        if (read != sorted.size() || !std::is_sorted(sorted.begin(), sorted.end())) {
+            s.skip_with_error("output is not sorted");
+        }
+        std::filesystem::remove(in);
+        std::filesystem::remove(out);
+        s.set_items_processed(s.iterations() * s.range());
+        s.set_bytes_processed(s.iterations() * s.range() * static_cast<std::int64_t>(sizeof(std::int64_t)));
+        return;
+    };
+}
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    constexpr std::int64_t small = std::int64_t{ 1 } << 10;
+    constexpr std::int64_t medium = std::int64_t{ 1 } << 16;
+    constexpr std::int64_t large = std::int64_t{ 1 } << 20;
+    const std::initializer_list<std::int64_t> sizes = { small, medium, large };
+
+    for (const auto& [shape, shape_name] : distributions) {
+        const std::string family = std::string("sort/") + shape_name + "/";
+        register_benchmark(family + "std::sort", in_memory(shape, [](keys_type& k) { std::sort(k.begin(), k.end()); }), sizes);
+        register_benchmark(family + "std::stable_sort",
+            in_memory(shape, [](keys_type& k) { std::stable_sort(k.begin(), k.end()); }), sizes);
+        register_benchmark(family + "pdq_sort", in_memory(shape, [](keys_type& k) { algorithm::pdq_sort(k); }), sizes);
+        register_benchmark(family + "tim_sort", in_memory(shape, [](keys_type& k) { algorithm::tim_sort(k); }), sizes);
+        register_benchmark(family + "heap_sort", in_memory(shape, [](keys_type& k) { algorithm::heap_sort(k); }), sizes);
+        register_benchmark(family + "parallel_sort",
+            in_memory(shape, [](keys_type& k) { algorithm::parallel_sort(k); }), sizes);
+        register_benchmark(family + "simd_sort", in_memory(shape, [](keys_type& k) { algorithm::simd_sort(k); }), sizes);
+        register_benchmark(family + "radix_sort", in_memory(shape, [](keys_type& k) { algorithm::radix_sort(k); }), sizes);
+        register_benchmark(family + "insertion_sort",
+            in_memory(shape, [](keys_type& k) { algorithm::insertion_sort(k); }), { small });
+        register_benchmark(family + "selection_sort",
+            in_memory(shape, [](keys_type& k) { algorithm::selection_sort(k); }), { small });
+        register_benchmark(family + "bubble_sort", in_memory(shape, [](keys_type& k) { algorithm::bubble_sort(k); }), { small });
+        register_benchmark(family + "external_sort", external(shape, shape_name), { medium, large });
+    }
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,105 @@
+/**
+ * @file bench_stack.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The contiguous stack adaptor, on LinearVector and on inline fixed
+ * capacity storage, against std::stack on its default std::deque and on
+ * std::vector: filling a fresh stack and draining it as a depth-first
+ * search does, and a stack that stays shallow while it is pushed and popped
+ * in a tight loop, as in expression evaluation.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <cstdint>
+#include <deque>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "stack.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+
+constexpr std::int64_t max_depth = std::int64_t{ 1 } << 14;
+
+using linear_stack = util::data_structure::stack<int>;
+using fixed_stack = util::data_structure::fixed_stack<int, max_depth>;
+using std_deque_stack = std::stack<int>;
+using std_vector_stack = std::stack<int, std::vector<int>>;
+
+/* push 0 .. n - 1 onto an empty stack, then pop them all */
+template<typename Stack>
+void fill_drain(state& s) {
+    const int n = static_cast<int>(s.range());
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        Stack stack;
+        for (int i = 0; i < n; ++i) {
+            stack.push(i);
+        }
+        sum = 0;
+        while (!stack.empty()) {
+            sum += stack.top();
+            stack.pop();
+        }
+        do_not_optimize(sum);
+    }
+    if (sum != s.range() * (s.range() - 1) / 2) {
+        s.skip_with_error("wrong sum");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* n pushes and pops on a stack that never holds more than 16 elements */
+template<typename Stack>
+void sawtooth(state& s) {
+    const int n = static_cast<int>(s.range());
+    Stack stack;
+    std::int64_t sum = 0;
+    for (auto _ : s) {
+        sum = 0;
+        for (int i = 0; i < n; i += 16) {
+            for (int j = 0; j < 16; ++j) {
+                stack.push(i + j);
+            }
+            for (int j = 0; j < 16; ++j) {
+                sum += stack.top();
+                stack.pop();
+            }
+        }
+        do_not_optimize(sum);
+    }
+    if (sum != s.range() * (s.range() - 1) / 2) {
+        s.skip_with_error("wrong sum");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+template<typename Stack>
+void register_stack(const char* const name) {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 6, std::int64_t{ 1 } << 10, max_depth };
+    register_benchmark(std::string("stack/fill_drain/") + name, fill_drain<Stack>, sizes);
+    register_benchmark(std::string("stack/sawtooth/") + name, sawtooth<Stack>, sizes);
+    return;
+}
+
+const bool registered = [] {
+    register_stack<linear_stack>("stack");
+    register_stack<fixed_stack>("fixed_stack");
+    register_stack<std_deque_stack>("std::stack<deque>");
+    register_stack<std_vector_stack>("std::stack<vector>");
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,252 @@
+/**
+ * @file bench_timers.cpp
+ * @author Xuhua Huang (xuhuahuang0412@gmail.com)
+ * @brief The hierarchical timer wheel against timer queues on a binary
+ * std::priority_queue and on a 4-ary d_ary_heap, which cancel lazily by
+ * bumping a generation counter and skip stale entries when they reach the
+ * top: scheduling timers and cancelling all of them, scheduling timers and
+ * ticking until all have expired, and churn at a steady number of active
+ * timers, where random timers are re-armed and expired ones re-arm
+ * themselves. Delays are up to 2^16 ticks, a minute of millisecond ticks.
+ *
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "d_ary_heap.hpp"
+#include "timer_wheel.hpp"
+
+namespace {
+
+using util::benchmark::do_not_optimize;
+using util::benchmark::state;
+namespace data_structure = util::data_structure;
+
+constexpr std::uint64_t max_delay = std::uint64_t{ 1 } << 16;
+
+/* random delays in [1, max_delay], drawn in the same order by every timer queue */
+class delay_source {
+public:
+    delay_source() : delays(4096) {
+        std::mt19937_64 engine(2021);
+        for (std::uint64_t& delay : delays) {
+            delay = engine() % max_delay + 1;
+        }
+    }
+
+    std::uint64_t next() { return delays[position++ & (delays.size() - 1)]; }
+
+private:
+    std::vector<std::uint64_t> delays;
+    std::size_t position = 0;
+};
+
+/* ------------------------------ timer queues -------------------------------- */
+
+/* n timers with dense ids over timer_wheel<>; expired timers re-arm themselves while rearm is set */
+class wheel_timers {
+public:
+    explicit wheel_timers(const std::size_t n) : timers(n) {
+        for (std::size_t id = 0; id < n; ++id) {
+            timers[id].value().callback = expire{ this, id };
+        }
+    }
+
+    void schedule(const std::size_t id, const std::uint64_t delay) { wheel.schedule(timers[id], delay); }
+    void cancel(const std::size_t id) { wheel.cancel(timers[id]); }
+    void advance(const std::uint64_t ticks) { wheel.advance(ticks); }
+    std::size_t active() const { return wheel.size(); }
+
+    std::uint64_t expired = 0;
+    bool rearm = false;
+    delay_source delays;
+
+private:
+    struct expire {
+        wheel_timers* owner = nullptr;
+        std::size_t id = 0;
+        void operator () () const {
+            ++owner->expired;
+            if (owner->rearm) {
+                owner->schedule(id, owner->delays.next());
+            }
+        }
+    };
+    using wheel_type = data_structure::timer_wheel<expire>;
+
+    /* the timers outlive the wheel they are scheduled on */
+    std::vector<wheel_type::timer> timers;
+    wheel_type wheel;
+};
+
+/* (expiry, id and generation) entries; an entry whose generation is no longer the id's is stale */
+using heap_entry = std::pair<std::uint64_t, std::uint64_t>;
+
+template<typename Heap>
+class heap_timers {
+public:
+    explicit heap_timers(const std::size_t n) : generation(n, 0), armed(n, false) {}
+
+    void schedule(const std::size_t id, const std::uint64_t delay) {
+        if (!armed[id]) {
+            armed[id] = true;
+            ++count;
+        }
+        queue.push({ now + (delay == 0 ? 1 : delay), (std::uint64_t{ ++generation[id] } << 32) | id });
+        return;
+    }
+
+    void cancel(const std::size_t id) {
+        if (armed[id]) {
+            armed[id] = false;
+            ++generation[id];
+            --count;
+        }
+        return;
+    }
+
+    void advance(std::uint64_t ticks) {
+        for (; ticks > 0; --ticks) {
+            ++now;
+            while (!queue.empty() && queue.top().first <= now) {
+                const std::uint64_t key = queue.top().second;
+                queue.pop();
+                const std::size_t id = static_cast<std::uint32_t>(key);
+                if (generation[id] != static_cast<std::uint32_t>(key >> 32)) {
+                    continue;
+                }
+                armed[id] = false;
+                --count;
+                ++expired;
+                if (rearm) {
+                    schedule(id, delays.next());
+                }
+            }
+        }
+        return;
+    }
+
+    std::size_t active() const { return count; }
+
+    std::uint64_t expired = 0;
+    bool rearm = false;
+    delay_source delays;
+
+private:
+    Heap queue;
+    std::vector<std::uint32_t> generation;
+    std::vector<bool> armed;
+    std::uint64_t now = 0;
+    std::size_t count = 0;
+};
+
+using std_heap_timers = heap_timers<std::priority_queue<heap_entry, std::vector<heap_entry>, std::greater<heap_entry>>>;
+using d_ary_heap_timers = heap_timers<data_structure::d_ary_heap<heap_entry, 4, std::greater<heap_entry>>>;
+
+/* ----------------------------- schedule, cancel ----------------------------- */
+
+template<typename Timers>
+void schedule_cancel(state& s) {
+    const std::size_t n = static_cast<std::size_t>(s.range());
+    bool cancelled = true;
+    for (auto _ : s) {
+        Timers timers(n);
+        for (std::size_t id = 0; id < n; ++id) {
+            timers.schedule(id, timers.delays.next());
+        }
+        for (std::size_t id = 0; id < n; ++id) {
+            timers.cancel(id);
+        }
+        cancelled = cancelled && timers.active() == 0;
+        do_not_optimize(timers);
+    }
+    if (!cancelled) {
+        s.skip_with_error("timers left after cancelling all");
+    }
+    s.set_items_processed(s.iterations() * s.range() * 2);
+    return;
+}
+
+/* ---------------------------- schedule, expire ------------------------------ */
+
+template<typename Timers>
+void expire_all(state& s) {
+    const std::size_t n = static_cast<std::size_t>(s.range());
+    bool expired = true;
+    for (auto _ : s) {
+        Timers timers(n);
+        for (std::size_t id = 0; id < n; ++id) {
+            timers.schedule(id, timers.delays.next());
+        }
+        timers.advance(max_delay);
+        expired = expired && timers.expired == n && timers.active() == 0;
+        do_not_optimize(timers);
+    }
+    if (!expired) {
+        s.skip_with_error("not every timer expired");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+/* ---------------------------------- churn ----------------------------------- */
+
+/* per item one random timer is re-armed, and every 16 items one tick passes */
+template<typename Timers>
+void churn(state& s) {
+    const std::size_t n = static_cast<std::size_t>(s.range());
+    std::vector<std::uint32_t> ids(n);
+    std::mt19937_64 engine(2021);
+    for (std::uint32_t& id : ids) {
+        id = static_cast<std::uint32_t>(engine() % n);
+    }
+    Timers timers(n);
+    timers.rearm = true;
+    for (std::size_t id = 0; id < n; ++id) {
+        timers.schedule(id, timers.delays.next());
+    }
+    for (auto _ : s) {
+        for (std::size_t i = 0; i < n; ++i) {
+            timers.schedule(ids[i], timers.delays.next());
+            if (i % 16 == 15) {
+                timers.advance(1);
+            }
+        }
+        do_not_optimize(timers.expired);
+    }
+    if (timers.active() != n) {
+        s.skip_with_error("active timers lost");
+    }
+    s.set_items_processed(s.iterations() * s.range());
+    return;
+}
+
+const bool registered = [] {
+    using util::benchmark::register_benchmark;
+    const auto sizes = { std::int64_t{ 1 } << 10, std::int64_t{ 1 } << 16, std::int64_t{ 1 } << 20 };
+    register_benchmark("timer/schedule_cancel/timer_wheel", schedule_cancel<wheel_timers>, sizes);
+    register_benchmark("timer/schedule_cancel/std::priority_queue", schedule_cancel<std_heap_timers>, sizes);
+    register_benchmark("timer/schedule_cancel/d_ary_heap<4>", schedule_cancel<d_ary_heap_timers>, sizes);
+
+    register_benchmark("timer/expire_all/timer_wheel", expire_all<wheel_timers>, sizes);
+    register_benchmark("timer/expire_all/std::priority_queue", expire_all<std_heap_timers>, sizes);
+    register_benchmark("timer/expire_all/d_ary_heap<4>", expire_all<d_ary_heap_timers>, sizes);
+
+    register_benchmark("timer/churn/timer_wheel", churn<wheel_timers>, sizes);
+    register_benchmark("timer/churn/std::priority_queue", churn<std_heap_timers>, sizes);
+    register_benchmark("timer/churn/d_ary_heap<4>", churn<d_ary_heap_timers>, sizes);
+    return true;
+}();
+
+} // namespace
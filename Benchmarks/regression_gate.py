@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+# Topic: Performance regression gate against a checked-in baseline
+#
+# Builds the Benchmarks and GenericDataStructures CMake projects and the
+# Algorithms/Sort Makefile benchmarks, runs every benchmark binary several
+# times in separate processes, and compares the median of each benchmark
+# with Benchmarks/baseline.json. A benchmark regresses when its median is
+# slower than the baseline median by more than the threshold AND its
+# confidence interval lies entirely above the baseline's, so run-to-run
+# noise alone does not fail the gate. A baseline benchmark selected by the
+# filter that the run no longer produces fails the gate too, unless
+# --allow-missing is given, so a renamed or lost case is not silently
+# unchecked. Only the standard library is used.
+#
+# The GenericDataStructures containers are timed through the vector/,
+# forward_list/ and list/ cases of the benchmark suite; their own CMake
+# targets are demos, so the gate only checks that they still build.
+#
+# Exit codes: 1 on a regression or a missing benchmark, 2 when a build or
+# a benchmark run fails, 3 when the baseline cannot serve the run asked for
+# (none recorded, or recorded with another --metric).
+#
+# To run the gate from the repository root:
+# $ python3 Benchmarks/regression_gate.py
+# $ python3 Benchmarks/regression_gate.py --filter ^sort/ --repetitions 9
+#
+# To record a new baseline after an intended change, on the machine that
+# runs the gate:
+# $ python3 Benchmarks/regression_gate.py --update-baseline
+#
+# Author: Xuhua Huang
+# Last updated: Oct 19, 2026
+# Created on: Oct 19, 2026
+
+
+import argparse
+import json
+import math
+import os
+import platform
+import re
+import subprocess
+import sys
+import time
+from datetime import datetime, timezone
+from pathlib import Path
+from statistics import median
+
+
+REPOSITORY = Path(__file__).resolve().parent.parent
+BASELINE = REPOSITORY / "Benchmarks" / "baseline.json"
+SORT_DIRECTORY = REPOSITORY / "Algorithms" / "Sort"
+
+# Makefile benchmarks with arguments sized to run for about half a second;
+# each is timed as a whole process, so a slowdown anywhere in it counts.
+MAKE_BENCHMARKS: list[tuple[str, list[str]]] = [
+    ("sortbench", ["100000", "2"]),
+    ("parallelsortbench", ["4000000"]),
+    ("simdsortbench", ["262144"]),
+    ("radixsortbench", ["300000"]),
+    ("externalsortbench", ["16", "4"]),
+    ("timsortbench", ["200000"]),
+    ("selectionbench", ["1000000"]),
+]
+
+USAGE_ERROR = 3
+BUILD_FAILED = 2
+REGRESSED = 1
+
+
+def run(command: list[str], **kwargs) -> subprocess.CompletedProcess:
+    try:
+        return subprocess.run(command, check=True, **kwargs)
+    except (subprocess.CalledProcessError, FileNotFoundError) as error:
+        print(f"regression_gate: {' '.join(command)} failed: {error}", file=sys.stderr)
+        sys.exit(BUILD_FAILED)
+
+
+def build(build_directory: Path) -> Path:
+    """Build every project the gate covers; returns the suite binary."""
+    for project in ("Benchmarks", "GenericDataStructures"):
+        binary_directory = build_directory / project
+        run(["cmake", "-S", str(REPOSITORY / project), "-B", str(binary_directory),
+             "-DCMAKE_BUILD_TYPE=Release"], stdout=subprocess.DEVNULL)
+        run(["cmake", "--build", str(binary_directory), "-j", str(os.cpu_count() or 1)],
+            stdout=subprocess.DEVNULL)
+    run(["make", "-s", "-C", str(SORT_DIRECTORY)] + [target for target, _ in MAKE_BENCHMARKS],
+        stdout=subprocess.DEVNULL)
+    return build_directory / "Benchmarks" / "benchmarks"
+
+
+def run_suite(binary: Path, pattern: str, min_time: float, metric: str) -> dict[str, float]:
+    """One run of the benchmark suite: nanoseconds per iteration by case."""
+    output = run([str(binary), f"--filter={pattern}", f"--min-time={min_time}", "--format=json"],
+                 stdout=subprocess.PIPE, text=True).stdout
+    times: dict[str, float] = {}
+    for case in json.loads(output)["benchmarks"]:
+        if case.get("error_occurred"):
+            print(f"regression_gate: {case['name']} failed: {case.get('error_message')}", file=sys.stderr)
+            sys.exit(REGRESSED)
+        if case.get("run_type", "iteration") == "iteration":
+            times[case["name"]] = case[metric]
+    return times
+
+
+def run_make_benchmarks(pattern: str) -> dict[str, float]:
+    """One wall-clock run, in nanoseconds, of each selected Makefile benchmark."""
+    times: dict[str, float] = {}
+    for target, arguments in MAKE_BENCHMARKS:
+        name = f"make/{target}/{'/'.join(arguments)}"
+        if not re.search(pattern, name):
+            continue
+        begin = time.perf_counter()
+        run([str(SORT_DIRECTORY / target)] + arguments, stdout=subprocess.DEVNULL, cwd=SORT_DIRECTORY)
+        times[name] = (time.perf_counter() - begin) * 1e9
+    return times
+
+
+def median_interval(samples: list[float], confidence: float) -> tuple[float, float]:
+    """
+    Distribution-free confidence interval of the median from order statistics:
+    [x(k), x(n-k+1)] with the largest k whose binomial tail stays below
+    (1 - confidence) / 2. With fewer than 6 samples that is [min, max].
+    """
+    ordered = sorted(samples)
+    n = len(ordered)
+    alpha = (1.0 - confidence) / 2
+    k, tail = 0, 0.0
+    while k < n // 2:
+        next_tail = tail + math.comb(n, k) / 2 ** n
+        if next_tail > alpha:
+            break
+        tail, k = next_tail, k + 1
+    k = max(k, 1)
+    return ordered[k - 1], ordered[n - k]
+
+
+def summarise(samples: dict[str, list[float]], confidence: float) -> dict[str, dict]:
+    summary = {}
+    for name, values in samples.items():
+        low, high = median_interval(values, confidence)
+        summary[name] = {"median": median(values), "ci_low": low, "ci_high": high, "samples": len(values)}
+    return summary
+
+
+def threshold_for(name: str, baseline: dict, default: float) -> float:
+    """The first matching override in the baseline's "thresholds", else the default."""
+    for override in baseline.get("thresholds", []):
+        if re.search(override["pattern"], name):
+            return override["threshold"]
+    return default
+
+
+def compare(baseline: dict, current: dict[str, dict], default_threshold: float) -> list[dict]:
+    rows = []
+    recorded = baseline.get("benchmarks", {})
+    for name, now in current.items():
+        row = {"name": name, "median": now["median"], "ci_low": now["ci_low"], "ci_high": now["ci_high"]}
+        before = recorded.get(name)
+        if before is None:
+            rows.append(row | {"status": "new"})
+            continue
+        threshold = threshold_for(name, baseline, default_threshold)
+        change = now["median"] / before["median"] - 1.0
+        if change > threshold and now["ci_low"] > before["ci_high"]:
+            status = "regression"
+        elif -change / (1.0 + change) > threshold and now["ci_high"] < before["ci_low"]:
+            status = "improvement"
+        else:
+            status = "ok"
+        rows.append(row | {"status": status, "baseline": before["median"], "change": change, "threshold": threshold})
+    for name in recorded.keys() - current.keys():
+        rows.append({"name": name, "status": "missing"})
+    return rows
+
+
+def machine() -> dict[str, str]:
+    processor = platform.processor()
+    try:
+        with open("/proc/cpuinfo") as cpuinfo:
+            for line in cpuinfo:
+                if line.startswith("model name"):
+                    processor = line.split(":", 1)[1].strip()
+                    break
+    except OSError:
+        pass
+    return {"system": platform.system(), "processor": processor, "cpus": str(os.cpu_count())}
+
+
+def format_time(nanoseconds: float) -> str:
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return f"{nanoseconds / scale:.3g} {unit}"
+    return f"{nanoseconds:.3g} ns"
+
+
+def report(rows: list[dict], verbose: bool) -> None:
+    width = max([len(row["name"]) for row in rows] + [9])
+    for row in sorted(rows, key=lambda row: row["name"]):
+        if row["status"] == "ok" and not verbose:
+            continue
+        if row["status"] == "missing":
+            print(f"{row['name']:<{width}}  missing from this run")
+        elif row["status"] == "new":
+            print(f"{row['name']:<{width}}  new: {format_time(row['median'])}, not in the baseline")
+        else:
+            print(f"{row['name']:<{width}}  {row['status']:<11} {format_time(row['baseline']):>9} -> "
+                  f"{format_time(row['median']):>9} ({row['change']:+.1%}, threshold {row['threshold']:.0%}, "
+                  f"ci {format_time(row['ci_low'])} .. {format_time(row['ci_high'])})")
+    counts = {status: sum(row["status"] == status for row in rows)
+              for status in ("regression", "improvement", "ok", "new", "missing")}
+    print(", ".join(f"{count} {status}" for status, count in counts.items()))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Fail when benchmarks are slower than the checked-in baseline.")
+    parser.add_argument("--baseline", type=Path, default=BASELINE)
+    parser.add_argument("--build-dir", type=Path, default=REPOSITORY / "build" / "regression_gate")
+    parser.add_argument("--skip-build", action="store_true", help="reuse the binaries of a previous build")
+    parser.add_argument("--repetitions", type=int, help="process runs per benchmark (baseline setting, else 5)")
+    parser.add_argument("--min-time", type=float, help="seconds per benchmark case and run (baseline setting, else 0.05)")
+    parser.add_argument("--filter", default=".*", help="regex over benchmark names, make/<target>/... included")
+    parser.add_argument("--threshold", type=float, help="allowed slowdown of the median (baseline setting, else 0.10)")
+    parser.add_argument("--confidence", type=float, default=0.95, help="level of the median confidence intervals")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"),
+                        help="time compared (baseline setting, else real_time)")
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="do not fail on baseline benchmarks missing from this run")
+    parser.add_argument("--update-baseline", action="store_true", help="write the results as the new baseline")
+    parser.add_argument("--report", type=Path, help="also write the comparison as JSON")
+    parser.add_argument("--verbose", action="store_true", help="list unchanged benchmarks too")
+    arguments = parser.parse_args()
+
+    baseline = {}
+    if arguments.baseline.exists():
+        baseline = json.loads(arguments.baseline.read_text())
+    elif not arguments.update_baseline:
+        print(f"regression_gate: no baseline at {arguments.baseline}; record one with --update-baseline",
+              file=sys.stderr)
+        return USAGE_ERROR
+    settings = baseline.get("settings", {})
+    repetitions = arguments.repetitions or settings.get("repetitions", 5)
+    min_time = arguments.min_time if arguments.min_time is not None else settings.get("min_time", 0.05)
+    metric = arguments.metric or settings.get("metric", "real_time")
+    if not arguments.update_baseline and metric != settings.get("metric", metric):
+        print(f"regression_gate: the baseline was recorded with {settings['metric']}, not {metric}",
+              file=sys.stderr)
+        return USAGE_ERROR
+    recorded = baseline.get("benchmarks", {}) if arguments.update_baseline and arguments.filter != ".*" else {}
+    if recorded and metric != settings.get("metric", metric):
+        print(f"regression_gate: cannot merge {metric} into a baseline of {settings['metric']}; "
+              "update it without --filter", file=sys.stderr)
+        return USAGE_ERROR
+    threshold = arguments.threshold if arguments.threshold is not None else baseline.get("threshold", 0.10)
+    if baseline and baseline.get("machine") != machine():
+        print("regression_gate: warning: the baseline was recorded on another machine "
+              f"({baseline.get('machine')}); timings are not comparable", file=sys.stderr)
+
+    if arguments.skip_build:
+        binary = arguments.build_dir / "Benchmarks" / "benchmarks"
+    else:
+        binary = build(arguments.build_dir)
+
+    # interleave the binaries so slow drift of the machine affects all of them alike
+    samples: dict[str, list[float]] = {}
+    for repetition in range(repetitions):
+        print(f"run {repetition + 1}/{repetitions}", file=sys.stderr, flush=True)
+        times = run_suite(binary, arguments.filter, min_time, metric) | run_make_benchmarks(arguments.filter)
+        for name, nanoseconds in times.items():
+            samples.setdefault(name, []).append(nanoseconds)
+    current = summarise(samples, arguments.confidence)
+
+    if arguments.update_baseline:
+        baseline = {
+            "created": datetime.now(timezone.utc).isoformat(timespec="seconds"),
+            "machine": machine(),
+            "settings": {"repetitions": repetitions, "min_time": min_time, "metric": metric},
+            "threshold": threshold,
+            "thresholds": baseline.get("thresholds", []),
+            "benchmarks": dict(sorted((recorded | current).items())),
+        }
+        arguments.baseline.write_text(json.dumps(baseline, indent=2) + "\n")
+        print(f"recorded {len(current)} benchmarks in {arguments.baseline}")
+        return 0
+
+    rows = compare(baseline, current, threshold)
+    if arguments.filter != ".*":
+        rows = [row for row in rows if row["status"] != "missing" or re.search(arguments.filter, row["name"])]
+    report(rows, arguments.verbose)
+    if arguments.report:
+        arguments.report.write_text(json.dumps(rows, indent=2) + "\n")
+    if any(row["status"] == "regression" for row in rows):
+        return REGRESSED
+    if not arguments.allow_missing and any(row["status"] == "missing" for row in rows):
+        print("regression_gate: benchmarks of the baseline are missing from this run; "
+              "pass --allow-missing if they were removed on purpose", file=sys.stderr)
+        return REGRESSED
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,80 @@
+/**
+ * @file bloom_filter.c
+ * @author Xuhua Huang
+ * @brief Blocked Bloom filter implementation.
+ *
+ * The upper 32 bits of the hash pick the block, the lower 32 bits are
+ * multiplied by one odd salt per word and the top 6 bits of each product
+ * pick the bit to set in that word. The loop has no data-dependent branch
+ * and vectorizes well.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bloom_filter.h"
+
+#define BLOOM_BLOCK_BYTES (BLOOM_BLOCK_WORDS * sizeof(uint64_t))
+
+static const uint32_t salts[BLOOM_BLOCK_WORDS] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U,
+};
+
+static inline const uint64_t* block_of(const BloomFilter* const filter, const uint64_t hash) {
+    return filter->blocks + ((size_t)(hash >> 32) & (filter->block_count - 1)) * BLOOM_BLOCK_WORDS;
+}
+
+static inline uint64_t bit_of(const uint64_t hash, const int word) {
+    return (uint64_t)1 << (((uint32_t)hash * salts[word]) >> 26);
+}
+
+bool bloom_filter_init(BloomFilter* filter, size_t expected_keys, unsigned bits_per_key) {
+    const size_t bits = (expected_keys == 0 ? 1 : expected_keys) * (bits_per_key == 0 ? 1 : bits_per_key);
+    size_t block_count = 1;
+    while (block_count * BLOOM_BLOCK_BYTES * 8 < bits) {
+        block_count <<= 1;
+    }
+    filter->blocks = (uint64_t*)aligned_alloc(BLOOM_BLOCK_BYTES, block_count * BLOOM_BLOCK_BYTES);
+    if (filter->blocks == NULL) {
+        filter->block_count = 0;
+        return false;
+    }
+    memset(filter->blocks, 0, block_count * BLOOM_BLOCK_BYTES);
+    filter->block_count = block_count;
+    return true;
+}
+
+void bloom_filter_free(BloomFilter* filter) {
+    free(filter->blocks);
+    filter->blocks = NULL;
+    filter->block_count = 0;
+    return;
+}
+
+void bloom_filter_add(BloomFilter* filter, uint64_t hash) {
+    uint64_t* const block = (uint64_t*)block_of(filter, hash);
+    for (int word = 0; word < BLOOM_BLOCK_WORDS; ++word) {
+        block[word] |= bit_of(hash, word);
+    }
+    return;
+}
+
+bool bloom_filter_may_contain(const BloomFilter* filter, uint64_t hash) {
+    const uint64_t* const block = block_of(filter, hash);
+    uint64_t missing = 0;
+    for (int word = 0; word < BLOOM_BLOCK_WORDS; ++word) {
+        missing |= bit_of(hash, word) & ~block[word];
+    }
+    return missing == 0;
+}
+
+size_t bloom_filter_bytes(const BloomFilter* filter) {
+    return filter->block_count * BLOOM_BLOCK_BYTES;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file bloom_filter.h
+ * @author Xuhua Huang
+ * @brief Blocked (split block) Bloom filter for read-mostly key sets.
+ *
+ * The filter is an array of 64-byte blocks, one cache line each. A key
+ * selects one block from its hash and sets one bit in each of the eight
+ * 64-bit words of that block, so every query touches exactly one cache line.
+ * Bloom filters cannot forget keys; use the cuckoo filter for sets that
+ * shrink, such as the table in `main.c`.
+ *
+ * Reference: Putze, Sanders and Singler, "Cache-, Hash- and Space-Efficient
+ * Bloom Filters", 2007.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLOOM_BLOCK_WORDS 8     /* 8 x 64 bits = one 64-byte cache line */
+
+typedef struct BloomFilter {
+    uint64_t* blocks;           /* block_count * BLOOM_BLOCK_WORDS words, cache-line aligned */
+    size_t block_count;         /* power of two */
+} BloomFilter;
+
+/**
+ * @brief Size the filter for `expected_keys` at `bits_per_key` bits each
+ * (10 bits gives roughly a 1% false-positive rate, 16 bits about 0.1%).
+ * @return bool -> false if the allocation failed
+ */
+bool bloom_filter_init(BloomFilter* filter, size_t expected_keys, unsigned bits_per_key);
+
+/**
+ * @brief Release the filter memory.
+ * @return void
+ */
+void bloom_filter_free(BloomFilter* filter);
+
+/**
+ * @brief Add a key by its 64-bit hash.
+ * @return void
+ */
+void bloom_filter_add(BloomFilter* filter, uint64_t hash);
+
+/**
+ * @brief Query a key by its 64-bit hash.
+ * @return bool -> false means the key was never added
+ */
+bool bloom_filter_may_contain(const BloomFilter* filter, uint64_t hash);
+
+/**
+ * @brief Memory used by the filter.
+ * @return size_t
+ */
+size_t bloom_filter_bytes(const BloomFilter* filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BLOOM_FILTER_H */
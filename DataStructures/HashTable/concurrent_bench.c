@@ -0,0 +1,156 @@
+/**
+ * @file concurrent_bench.c
+ * @author Xuhua Huang
+ * @brief Scaling benchmark of the sharded concurrent hash table.
+ *
+ * Runs a read-mostly mix (95% lookups, 5% inserts/erases) and a write-heavy
+ * mix (50% lookups) with 1, 2, 4, ... up to N threads and prints the
+ * throughput and the speedup over one thread.
+ *
+ * To build and run on Linux:
+ * $ make concurrent_bench
+ * $ ./concurrent_bench [max_threads] [ops_per_thread]
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "concurrent_table.h"
+
+#define KEY_COUNT (1 << 16)             /* half of them are in the table at any time */
+#define SHARD_COUNT 64
+
+typedef struct Workload {
+    const char* label;
+    unsigned read_percent;
+} Workload;
+
+typedef struct WorkerArgs {
+    ConcurrentTable* table;
+    CPerson* people;
+    unsigned read_percent;
+    size_t ops;
+    uint64_t seed;
+    atomic_bool* start;
+    size_t hits;                        /* keeps the lookups from being optimized away */
+} WorkerArgs;
+
+static inline uint64_t xorshift64(uint64_t* const state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void* worker(void* const raw) {
+    WorkerArgs* const args = (WorkerArgs*)raw;
+    uint64_t state = args->seed;
+    while (!atomic_load_explicit(args->start, memory_order_acquire)) {
+        /* spin until every thread is ready */
+    }
+    size_t hits = 0;
+    for (size_t i = 0; i < args->ops; ++i) {
+        const uint64_t r = xorshift64(&state);
+        CPerson* const person = &args->people[r % KEY_COUNT];
+        const unsigned dice = (unsigned)((r >> 32) % 100);
+        if (dice < args->read_percent) {
+            hits += concurrent_table_lookup(args->table, person->name) != NULL;
+        } else if (dice & 1) {
+            concurrent_table_insert(args->table, person);
+        } else {
+            concurrent_table_erase(args->table, person->name);
+        }
+    }
+    args->hits = hits;
+    return NULL;
+}
+
+/**
+ * @brief Run one workload with a given number of threads.
+ * @return double -> million operations per second
+ */
+static double run(CPerson* const people, const Workload* const workload,
+                  const unsigned threads, const size_t ops) {
+    ConcurrentTable* table = concurrent_table_create(SHARD_COUNT, KEY_COUNT);
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        concurrent_table_insert(table, &people[i]);
+    }
+
+    pthread_t* handles = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    WorkerArgs* args = (WorkerArgs*)malloc(threads * sizeof(WorkerArgs));
+    atomic_bool start = false;
+    for (unsigned t = 0; t < threads; ++t) {
+        args[t] = (WorkerArgs){ table, people, workload->read_percent, ops, 0x9E3779B97F4A7C15ULL * (t + 1), &start, 0 };
+        pthread_create(&handles[t], NULL, worker, &args[t]);
+    }
+    const double begin = now_seconds();
+    atomic_store_explicit(&start, true, memory_order_release);
+    for (unsigned t = 0; t < threads; ++t) {
+        pthread_join(handles[t], NULL);
+    }
+    const double elapsed = now_seconds() - begin;
+
+    free(handles);
+    free(args);
+    concurrent_table_destroy(table);
+    return (double)threads * (double)ops / elapsed / 1e6;
+}
+
+int main(int argc, char** argv) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned max_threads = (argc > 1) ? (unsigned)atoi(argv[1]) : (unsigned)(cores > 0 ? cores : 1);
+    if (max_threads == 0) {
+        max_threads = 1;
+    }
+    const size_t ops = (argc > 2) ? (size_t)atol(argv[2]) : 2000000;
+
+    CPerson* people = (CPerson*)calloc(KEY_COUNT, sizeof(CPerson));
+    for (int i = 0; i < KEY_COUNT; ++i) {
+        snprintf(people[i].name, MAX_NAME, "person-%d", i);
+        people[i].age = i % 100;
+    }
+
+    const Workload workloads[] = {
+        { "read-mostly (95% lookup)", 95 },
+        { "write-heavy (50% lookup)", 50 },
+    };
+    for (size_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); ++w) {
+        printf("%s, %zu ops per thread, %d shards\n", workloads[w].label, ops, SHARD_COUNT);
+        printf("\tthreads\tMops/s\tspeedup\n");
+        double baseline = 0.0;
+        for (unsigned threads = 1;; threads *= 2) {
+            if (threads > max_threads) {
+                threads = max_threads;      /* always finish on the requested count */
+            }
+            const double mops = run(people, &workloads[w], threads, ops);
+            if (threads == 1) {
+                baseline = mops;
+            }
+            printf("\t%u\t%.2f\t%.2fx\n", threads, mops, mops / baseline);
+            if (threads == max_threads) {
+                break;
+            }
+        }
+    }
+
+    free(people);
+    return 0;
+}
@@ -0,0 +1,332 @@
+/**
+ * @file concurrent_table.c
+ * @author Xuhua Huang
+ * @brief Lock-striped hash table with sequence-locked optimistic reads.
+ *
+ * Each shard is a linear probing table of (hash, record) pairs where a hash
+ * of 0 marks an empty slot. Erasure uses backward shifting, so there are no
+ * tombstones. All slot fields are atomics accessed with relaxed ordering;
+ * the shard's sequence number provides the ordering (Boehm, "Can Seqlocks
+ * Get Along With Programming Language Memory Models?"):
+ *
+ *   writer                                  reader
+ *   seq = seq + 1        (relaxed)          s1 = seq             (acquire)
+ *   fence                (release)          ... relaxed loads ...
+ *   ... relaxed stores ...                  fence                (acquire)
+ *   seq = seq + 1        (release)          s2 = seq             (relaxed)
+ *                                           retry if s1 is odd or s1 != s2
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "concurrent_table.h"
+
+#define CACHE_LINE_SIZE 64
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define cpu_relax() _mm_pause()
+#else
+#define cpu_relax() ((void)0)
+#endif
+
+typedef struct ConcurrentSlot {
+    _Atomic uint64_t hash;          /* 0 for an empty slot */
+    _Atomic(CPerson*) person;
+} ConcurrentSlot;
+
+typedef struct SlotArray {
+    size_t mask;                    /* capacity - 1, capacity is a power of two */
+    struct SlotArray* retired_next; /* intrusive list of arrays replaced by a resize */
+    ConcurrentSlot slots[];
+} SlotArray;
+
+/* aligned to a cache line so that writers of neighbouring shards do not false-share */
+typedef struct ConcurrentShard {
+    _Alignas(CACHE_LINE_SIZE) _Atomic uint64_t sequence;   /* odd while a writer is inside */
+    _Atomic(SlotArray*) array;
+    _Atomic size_t size;
+    pthread_mutex_t writer_lock;
+    SlotArray* retired;
+} ConcurrentShard;
+
+struct ConcurrentTable {
+    ConcurrentShard* shards;
+    size_t shard_mask;
+};
+
+/* a hash of 0 is reserved for empty slots */
+static inline uint64_t key_hash(const char* const name, const size_t length) {
+    const uint64_t hash = hash_name64(name, length);
+    return hash == 0 ? 1 : hash;
+}
+
+static inline ConcurrentShard* shard_of(ConcurrentTable* const table, const uint64_t hash) {
+    /* top bits pick the shard, low bits pick the slot inside it */
+    return &table->shards[(size_t)(hash >> 48) & table->shard_mask];
+}
+
+static SlotArray* allocate_array(const size_t capacity) {
+    SlotArray* array = (SlotArray*)malloc(sizeof(SlotArray) + capacity * sizeof(ConcurrentSlot));
+    if (array == NULL) {
+        return NULL;
+    }
+    array->mask = capacity - 1;
+    array->retired_next = NULL;
+    for (size_t i = 0; i < capacity; ++i) {
+        atomic_init(&array->slots[i].hash, 0);
+        atomic_init(&array->slots[i].person, NULL);
+    }
+    return array;
+}
+
+/* maximum load factor of 3/4 for plain linear probing */
+static inline size_t max_load(const SlotArray* const array) {
+    return (array->mask + 1) - (array->mask + 1) / 4;
+}
+
+/**
+ * @brief Probe a slot array with relaxed loads. Safe to call without the
+ * writer lock; the caller validates the result with the shard sequence.
+ * @return size_t -> index of the match, or (size_t)-1
+ */
+static size_t probe(const SlotArray* const array, const uint64_t hash,
+                    const char* const name, const size_t length) {
+    size_t index = (size_t)hash & array->mask;
+    for (size_t probed = 0; probed <= array->mask; ++probed) {
+        const uint64_t stored = atomic_load_explicit(&array->slots[index].hash, memory_order_relaxed);
+        if (stored == 0) {
+            break;
+        }
+        if (stored == hash) {
+            const CPerson* const person = atomic_load_explicit(&array->slots[index].person, memory_order_relaxed);
+            if (person != NULL && strnlen(person->name, MAX_NAME) == length
+                && memcmp(person->name, name, length) == 0) {
+                return index;
+            }
+        }
+        index = (index + 1) & array->mask;
+    }
+    return (size_t)-1;
+}
+
+/* store into a slot that only the lock holder writes */
+static inline void store_slot(ConcurrentSlot* const slot, const uint64_t hash, CPerson* const person) {
+    atomic_store_explicit(&slot->person, person, memory_order_relaxed);
+    atomic_store_explicit(&slot->hash, hash, memory_order_relaxed);
+}
+
+static void place(SlotArray* const array, const uint64_t hash, CPerson* const person) {
+    size_t index = (size_t)hash & array->mask;
+    while (atomic_load_explicit(&array->slots[index].hash, memory_order_relaxed) != 0) {
+        index = (index + 1) & array->mask;
+    }
+    store_slot(&array->slots[index], hash, person);
+}
+
+static inline uint64_t write_begin(ConcurrentShard* const shard) {
+    const uint64_t sequence = atomic_load_explicit(&shard->sequence, memory_order_relaxed);
+    atomic_store_explicit(&shard->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    return sequence;
+}
+
+static inline void write_end(ConcurrentShard* const shard, const uint64_t sequence) {
+    atomic_store_explicit(&shard->sequence, sequence + 2, memory_order_release);
+}
+
+ConcurrentTable* concurrent_table_create(size_t shard_count, size_t capacity) {
+    shard_count = round_up_pow2(shard_count == 0 ? 1 : shard_count);
+    if (shard_count > ((size_t)1 << 16)) {
+        shard_count = (size_t)1 << 16;      /* only 16 hash bits select the shard */
+    }
+    const size_t per_shard = round_up_pow2((capacity / shard_count) * 4 / 3 + 8);
+
+    ConcurrentTable* table = (ConcurrentTable*)malloc(sizeof(ConcurrentTable));
+    ConcurrentShard* shards = (ConcurrentShard*)aligned_alloc(CACHE_LINE_SIZE, shard_count * sizeof(ConcurrentShard));
+    if (table == NULL || shards == NULL) {
+        free(table);
+        free(shards);
+        return NULL;
+    }
+    table->shards = shards;
+    table->shard_mask = shard_count - 1;
+
+    for (size_t i = 0; i < shard_count; ++i) {
+        SlotArray* array = allocate_array(per_shard);
+        if (array == NULL) {
+            table->shard_mask = i - 1;      /* destroy exactly the shards built so far */
+            if (i == 0) {
+                free(shards);
+                free(table);
+                return NULL;
+            }
+            concurrent_table_destroy(table);
+            return NULL;
+        }
+        atomic_init(&shards[i].sequence, 0);
+        atomic_init(&shards[i].array, array);
+        atomic_init(&shards[i].size, 0);
+        pthread_mutex_init(&shards[i].writer_lock, NULL);
+        shards[i].retired = NULL;
+    }
+    return table;
+}
+
+void concurrent_table_destroy(ConcurrentTable* table) {
+    if (table == NULL) {
+        return;
+    }
+    for (size_t i = 0; i <= table->shard_mask; ++i) {
+        ConcurrentShard* const shard = &table->shards[i];
+        free(atomic_load_explicit(&shard->array, memory_order_relaxed));
+        while (shard->retired != NULL) {
+            SlotArray* const next = shard->retired->retired_next;
+            free(shard->retired);
+            shard->retired = next;
+        }
+        pthread_mutex_destroy(&shard->writer_lock);
+    }
+    free(table->shards);
+    free(table);
+    return;
+}
+
+bool concurrent_table_insert(ConcurrentTable* table, CPerson* person) {
+    if (table == NULL || person == NULL) {
+        return false;
+    }
+    const size_t length = strnlen(person->name, MAX_NAME);
+    const uint64_t hash = key_hash(person->name, length);
+    ConcurrentShard* const shard = shard_of(table, hash);
+
+    pthread_mutex_lock(&shard->writer_lock);
+    SlotArray* array = atomic_load_explicit(&shard->array, memory_order_relaxed);
+    if (probe(array, hash, person->name, length) != (size_t)-1) {
+        pthread_mutex_unlock(&shard->writer_lock);
+        return false;
+    }
+
+    /* build the larger array outside the write section, readers keep using the old one */
+    SlotArray* grown = NULL;
+    const size_t size = atomic_load_explicit(&shard->size, memory_order_relaxed);
+    if (size + 1 > max_load(array)) {
+        grown = allocate_array((array->mask + 1) * 2);
+        if (grown == NULL) {
+            pthread_mutex_unlock(&shard->writer_lock);
+            return false;
+        }
+        for (size_t i = 0; i <= array->mask; ++i) {
+            const uint64_t stored = atomic_load_explicit(&array->slots[i].hash, memory_order_relaxed);
+            if (stored != 0) {
+                place(grown, stored, atomic_load_explicit(&array->slots[i].person, memory_order_relaxed));
+            }
+        }
+    }
+
+    const uint64_t sequence = write_begin(shard);
+    if (grown != NULL) {
+        array->retired_next = shard->retired;
+        shard->retired = array;
+        atomic_store_explicit(&shard->array, grown, memory_order_relaxed);
+        array = grown;
+    }
+    place(array, hash, person);
+    write_end(shard, sequence);
+
+    atomic_store_explicit(&shard->size, size + 1, memory_order_relaxed);
+    pthread_mutex_unlock(&shard->writer_lock);
+    return true;
+}
+
+CPerson* concurrent_table_lookup(ConcurrentTable* table, const char* name) {
+    if (table == NULL || name == NULL) {
+        return NULL;
+    }
+    const size_t length = strnlen(name, MAX_NAME);
+    const uint64_t hash = key_hash(name, length);
+    ConcurrentShard* const shard = shard_of(table, hash);
+
+    for (;;) {
+        const uint64_t begin = atomic_load_explicit(&shard->sequence, memory_order_acquire);
+        if (begin & 1) {                    /* a writer is inside, try again shortly */
+            cpu_relax();
+            continue;
+        }
+        const SlotArray* const array = atomic_load_explicit(&shard->array, memory_order_relaxed);
+        const size_t index = probe(array, hash, name, length);
+        CPerson* const found = (index == (size_t)-1)
+            ? NULL
+            : atomic_load_explicit(&array->slots[index].person, memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&shard->sequence, memory_order_relaxed) == begin) {
+            return found;
+        }
+    }
+}
+
+CPerson* concurrent_table_erase(ConcurrentTable* table, const char* name) {
+    if (table == NULL || name == NULL) {
+        return NULL;
+    }
+    const size_t length = strnlen(name, MAX_NAME);
+    const uint64_t hash = key_hash(name, length);
+    ConcurrentShard* const shard = shard_of(table, hash);
+
+    pthread_mutex_lock(&shard->writer_lock);
+    SlotArray* const array = atomic_load_explicit(&shard->array, memory_order_relaxed);
+    size_t hole = probe(array, hash, name, length);
+    if (hole == (size_t)-1) {
+        pthread_mutex_unlock(&shard->writer_lock);
+        return NULL;
+    }
+    CPerson* const removed = atomic_load_explicit(&array->slots[hole].person, memory_order_relaxed);
+
+    /*
+     * Backward-shift deletion for linear probing (Knuth, algorithm R):
+     * an element after the hole moves into it unless its home bucket lies
+     * cyclically in (hole, current], where it is still reachable.
+     */
+    const uint64_t sequence = write_begin(shard);
+    for (size_t current = (hole + 1) & array->mask;; current = (current + 1) & array->mask) {
+        const uint64_t stored = atomic_load_explicit(&array->slots[current].hash, memory_order_relaxed);
+        if (stored == 0) {
+            break;
+        }
+        const size_t home = (size_t)stored & array->mask;
+        const bool reachable = (hole <= current) ? (hole < home && home <= current)
+                                                 : (hole < home || home <= current);
+        if (!reachable) {
+            store_slot(&array->slots[hole], stored,
+                       atomic_load_explicit(&array->slots[current].person, memory_order_relaxed));
+            hole = current;
+        }
+    }
+    store_slot(&array->slots[hole], 0, NULL);
+    write_end(shard, sequence);
+
+    atomic_fetch_sub_explicit(&shard->size, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&shard->writer_lock);
+    return removed;
+}
+
+size_t concurrent_table_size(ConcurrentTable* table) {
+    if (table == NULL) {
+        return 0;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i <= table->shard_mask; ++i) {
+        size += atomic_load_explicit(&table->shards[i].size, memory_order_relaxed);
+    }
+    return size;
+}
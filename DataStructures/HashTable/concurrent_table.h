@@ -0,0 +1,82 @@
+/**
+ * @file concurrent_table.h
+ * @author Xuhua Huang
+ * @brief Sharded hash table for many readers and some writers.
+ *
+ * The key space is split into independent shards by the top bits of the
+ * hash. Each shard has its own writer mutex and a sequence lock:
+ *   - writers serialize on the shard mutex and bump the sequence number to
+ *     an odd value while they modify the shard, and back to even afterwards,
+ *   - readers never take a lock; they probe optimistically and retry only if
+ *     the sequence number changed underneath them.
+ * Slot arrays replaced by a resize are retired rather than freed, because a
+ * reader may still be probing them; they are released by
+ * `concurrent_table_destroy`.
+ *
+ * Records are not owned. A record removed from the table may still be read
+ * by a concurrent lookup, so it must stay alive as long as readers run.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef CONCURRENT_TABLE_H
+#define CONCURRENT_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "person.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* opaque, the shards hold C11 atomics that are not usable from C++ headers */
+typedef struct ConcurrentTable ConcurrentTable;
+
+/**
+ * @brief Create a table with `shard_count` shards (rounded up to a power of two)
+ * able to hold `capacity` elements before any shard grows.
+ * @return ConcurrentTable* -> NULL if the allocation failed
+ */
+ConcurrentTable* concurrent_table_create(size_t shard_count, size_t capacity);
+
+/**
+ * @brief Destroy the table. No other thread may use it anymore.
+ * @return void
+ */
+void concurrent_table_destroy(ConcurrentTable* table);
+
+/**
+ * @brief Insert a person keyed by name; blocks other writers of the same shard only.
+ * @return bool -> false for NULL input, duplicate names or allocation failure
+ */
+bool concurrent_table_insert(ConcurrentTable* table, CPerson* person);
+
+/**
+ * @brief Look up a person by name without taking any lock.
+ * @return CPerson* -> NULL if the name is not in the table
+ */
+CPerson* concurrent_table_lookup(ConcurrentTable* table, const char* name);
+
+/**
+ * @brief Remove a person by name; blocks other writers of the same shard only.
+ * @return CPerson* -> the removed record, NULL if the name was not found
+ */
+CPerson* concurrent_table_erase(ConcurrentTable* table, const char* name);
+
+/**
+ * @brief Number of elements; a snapshot that may be stale under concurrent writes.
+ * @return size_t
+ */
+size_t concurrent_table_size(ConcurrentTable* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONCURRENT_TABLE_H */
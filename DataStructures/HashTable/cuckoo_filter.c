@@ -0,0 +1,176 @@
+/**
+ * @file cuckoo_filter.c
+ * @author Xuhua Huang
+ * @brief Cuckoo filter implementation.
+ *
+ * A bucket is a single 64-bit word of four 16-bit lanes. Looking for a
+ * fingerprint uses the classic "has zero byte" bit trick on 16-bit lanes:
+ * xor the bucket with the fingerprint broadcast to every lane, then test
+ * whether any lane became zero, without a loop or a branch per lane.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <stdlib.h>
+
+#include "cuckoo_filter.h"
+
+#define LANES_LOW 0x0001000100010001ULL
+#define LANES_HIGH 0x8000800080008000ULL
+
+static inline uint16_t fingerprint_of(const uint64_t hash) {
+    const uint16_t fingerprint = (uint16_t)(hash >> 48);
+    return fingerprint == 0 ? 1 : fingerprint;      /* 0 marks a free entry */
+}
+
+static inline size_t index_of(const CuckooFilter* const filter, const uint64_t hash) {
+    return (size_t)hash & (filter->bucket_count - 1);
+}
+
+/* involution: alt_index(alt_index(i, f), f) == i */
+static inline size_t alt_index(const CuckooFilter* const filter, const size_t index, const uint16_t fingerprint) {
+    return (index ^ (size_t)(fingerprint * 0x5bd1e995U)) & (filter->bucket_count - 1);
+}
+
+/* non-zero iff some lane of the bucket equals the fingerprint */
+static inline uint64_t has_lane(const uint64_t bucket, const uint16_t fingerprint) {
+    const uint64_t x = bucket ^ (LANES_LOW * fingerprint);
+    return (x - LANES_LOW) & ~x & LANES_HIGH;
+}
+
+static inline uint16_t lane_of(const uint64_t bucket, const int lane) {
+    return (uint16_t)(bucket >> (16 * lane));
+}
+
+static inline uint64_t with_lane(const uint64_t bucket, const int lane, const uint16_t fingerprint) {
+    return (bucket & ~(0xFFFFULL << (16 * lane))) | ((uint64_t)fingerprint << (16 * lane));
+}
+
+static inline uint64_t next_random(CuckooFilter* const filter) {
+    uint64_t x = filter->random_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return filter->random_state = x;
+}
+
+/**
+ * @brief Replace the first lane equal to `from` with `to`.
+ * @return bool -> false if no lane matched
+ */
+static bool replace_in_bucket(CuckooFilter* const filter, const size_t index, const uint16_t from, const uint16_t to) {
+    const uint64_t bucket = filter->buckets[index];
+    if (has_lane(bucket, from) == 0) {
+        return false;
+    }
+    for (int lane = 0; lane < CUCKOO_BUCKET_SIZE; ++lane) {
+        if (lane_of(bucket, lane) == from) {
+            filter->buckets[index] = with_lane(bucket, lane, to);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool cuckoo_filter_init(CuckooFilter* filter, size_t expected_keys) {
+    /* keep the load factor under 95%, where insertions start failing */
+    const size_t needed = (expected_keys * 100 / 95 + CUCKOO_BUCKET_SIZE - 1) / CUCKOO_BUCKET_SIZE;
+    size_t bucket_count = 1;
+    while (bucket_count < needed) {
+        bucket_count <<= 1;
+    }
+    filter->buckets = (uint64_t*)calloc(bucket_count, sizeof(uint64_t));
+    filter->bucket_count = filter->buckets == NULL ? 0 : bucket_count;
+    filter->count = 0;
+    filter->random_state = 0x2545F4914F6CDD1DULL;
+    filter->has_victim = false;
+    filter->victim_index = 0;
+    filter->victim_fingerprint = 0;
+    return filter->buckets != NULL;
+}
+
+void cuckoo_filter_free(CuckooFilter* filter) {
+    free(filter->buckets);
+    filter->buckets = NULL;
+    filter->bucket_count = 0;
+    filter->count = 0;
+    filter->has_victim = false;
+    return;
+}
+
+bool cuckoo_filter_add(CuckooFilter* filter, uint64_t hash) {
+    if (filter->has_victim) {       /* the previous insertion already overflowed */
+        return false;
+    }
+    uint16_t fingerprint = fingerprint_of(hash);
+    const size_t first = index_of(filter, hash);
+    const size_t second = alt_index(filter, first, fingerprint);
+    if (replace_in_bucket(filter, first, 0, fingerprint) || replace_in_bucket(filter, second, 0, fingerprint)) {
+        ++filter->count;
+        return true;
+    }
+
+    /* both buckets are full: evict a random resident and move it to its other bucket */
+    size_t index = (next_random(filter) & 1) ? first : second;
+    for (int kick = 0; kick < CUCKOO_MAX_KICKS; ++kick) {
+        const int lane = (int)(next_random(filter) % CUCKOO_BUCKET_SIZE);
+        const uint16_t evicted = lane_of(filter->buckets[index], lane);
+        filter->buckets[index] = with_lane(filter->buckets[index], lane, fingerprint);
+        fingerprint = evicted;
+        index = alt_index(filter, index, fingerprint);
+        if (replace_in_bucket(filter, index, 0, fingerprint)) {
+            ++filter->count;
+            return true;
+        }
+    }
+
+    /* keep the homeless fingerprint aside so no key is ever lost */
+    filter->has_victim = true;
+    filter->victim_index = index;
+    filter->victim_fingerprint = fingerprint;
+    ++filter->count;
+    return true;
+}
+
+bool cuckoo_filter_may_contain(const CuckooFilter* filter, uint64_t hash) {
+    const uint16_t fingerprint = fingerprint_of(hash);
+    const size_t first = index_of(filter, hash);
+    const size_t second = alt_index(filter, first, fingerprint);
+    if ((has_lane(filter->buckets[first], fingerprint) | has_lane(filter->buckets[second], fingerprint)) != 0) {
+        return true;
+    }
+    return filter->has_victim && filter->victim_fingerprint == fingerprint
+        && (filter->victim_index == first || filter->victim_index == second);
+}
+
+bool cuckoo_filter_remove(CuckooFilter* filter, uint64_t hash) {
+    const uint16_t fingerprint = fingerprint_of(hash);
+    const size_t first = index_of(filter, hash);
+    const size_t second = alt_index(filter, first, fingerprint);
+    if (replace_in_bucket(filter, first, fingerprint, 0) || replace_in_bucket(filter, second, fingerprint, 0)) {
+        --filter->count;
+        if (filter->has_victim) {   /* the freed entry may give the victim a home */
+            const size_t victim_alt = alt_index(filter, filter->victim_index, filter->victim_fingerprint);
+            if (replace_in_bucket(filter, filter->victim_index, 0, filter->victim_fingerprint)
+                || replace_in_bucket(filter, victim_alt, 0, filter->victim_fingerprint)) {
+                filter->has_victim = false;
+            }
+        }
+        return true;
+    }
+    if (filter->has_victim && filter->victim_fingerprint == fingerprint
+        && (filter->victim_index == first || filter->victim_index == second)) {
+        filter->has_victim = false;
+        --filter->count;
+        return true;
+    }
+    return false;
+}
+
+size_t cuckoo_filter_bytes(const CuckooFilter* filter) {
+    return filter->bucket_count * sizeof(uint64_t);
+}
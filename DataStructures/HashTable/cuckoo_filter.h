@@ -0,0 +1,90 @@
+/**
+ * @file cuckoo_filter.h
+ * @author Xuhua Huang
+ * @brief Cuckoo filter: approximate set membership with deletion.
+ *
+ * Keys are reduced to 16-bit fingerprints stored in buckets of four
+ * (8 bytes per bucket, eight buckets per cache line). Each fingerprint may
+ * live in one of two buckets, the second derived from the first and the
+ * fingerprint alone (partial-key cuckoo hashing), so entries can be moved
+ * and removed without knowing the original key. A query reads at most two
+ * buckets and compares all four fingerprints of a bucket at once.
+ *
+ * Deleting a key that was never inserted may remove a colliding key's
+ * fingerprint; only delete keys known to be in the set.
+ *
+ * Reference: Fan, Andersen, Kaminsky and Mitzenmacher, "Cuckoo Filter:
+ * Practically Better Than Bloom", CoNEXT 2014.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef CUCKOO_FILTER_H
+#define CUCKOO_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CUCKOO_BUCKET_SIZE 4
+#define CUCKOO_MAX_KICKS 500
+
+typedef struct CuckooFilter {
+    uint64_t* buckets;          /* four 16-bit fingerprints per word, 0 marks a free entry */
+    size_t bucket_count;        /* power of two */
+    size_t count;               /* fingerprints stored, the victim included */
+    uint64_t random_state;      /* picks entries to evict */
+    bool has_victim;            /* a fingerprint evicted by the last failed insertion */
+    size_t victim_index;
+    uint16_t victim_fingerprint;
+} CuckooFilter;
+
+/**
+ * @brief Size the filter for `expected_keys` at a load factor below 95%.
+ * @return bool -> false if the allocation failed
+ */
+bool cuckoo_filter_init(CuckooFilter* filter, size_t expected_keys);
+
+/**
+ * @brief Release the filter memory.
+ * @return void
+ */
+void cuckoo_filter_free(CuckooFilter* filter);
+
+/**
+ * @brief Add a key by its 64-bit hash. Adding a key twice stores it twice.
+ * @return bool -> false when the filter is full and nothing was added
+ */
+bool cuckoo_filter_add(CuckooFilter* filter, uint64_t hash);
+
+/**
+ * @brief Query a key by its 64-bit hash.
+ * @return bool -> false means the key is not in the set
+ */
+bool cuckoo_filter_may_contain(const CuckooFilter* filter, uint64_t hash);
+
+/**
+ * @brief Remove one copy of a key by its 64-bit hash.
+ * @return bool -> false if no matching fingerprint was found
+ */
+bool cuckoo_filter_remove(CuckooFilter* filter, uint64_t hash);
+
+/**
+ * @brief Memory used by the filter.
+ * @return size_t
+ */
+size_t cuckoo_filter_bytes(const CuckooFilter* filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CUCKOO_FILTER_H */
@@ -0,0 +1,184 @@
+/**
+ * @file filter_bench.c
+ * @author Xuhua Huang
+ * @brief Measure false-positive rates and throughput of the membership filters,
+ * and the cost of miss-heavy lookups with and without a filter in front.
+ *
+ * To build and run on Linux:
+ * $ make filter_bench
+ * $ ./filter_bench [key_count]
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bloom_filter.h"
+#include "cuckoo_filter.h"
+#include "person.h"
+#include "robin_hood_table.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void report(const char* const label, const size_t bytes, const size_t keys,
+                   const double add_seconds, const double query_seconds,
+                   const size_t false_positives, const size_t false_negatives, const size_t queries) {
+    printf("%-20s %8.2f KiB %6.2f bits/key  add %7.1f Mops/s  query %7.1f Mops/s  FPR %.4f%%  FN %zu\n",
+        label, (double)bytes / 1024.0, (double)bytes * 8.0 / (double)keys,
+        (double)keys / add_seconds / 1e6, (double)queries / query_seconds / 1e6,
+        100.0 * (double)false_positives / (double)queries, false_negatives);
+}
+
+static void bench_bloom(const uint64_t* const present, const uint64_t* const absent,
+                        const size_t count, const unsigned bits_per_key) {
+    BloomFilter filter;
+    bloom_filter_init(&filter, count, bits_per_key);
+    double begin = now_seconds();
+    for (size_t i = 0; i < count; ++i) {
+        bloom_filter_add(&filter, present[i]);
+    }
+    const double add_seconds = now_seconds() - begin;
+
+    size_t false_negatives = 0, false_positives = 0;
+    for (size_t i = 0; i < count; ++i) {
+        false_negatives += !bloom_filter_may_contain(&filter, present[i]);
+    }
+    begin = now_seconds();
+    for (size_t i = 0; i < count; ++i) {
+        false_positives += bloom_filter_may_contain(&filter, absent[i]);
+    }
+    const double query_seconds = now_seconds() - begin;
+
+    char label[32];
+    snprintf(label, sizeof(label), "bloom (%u bits/key)", bits_per_key);
+    report(label, bloom_filter_bytes(&filter), count, add_seconds, query_seconds,
+           false_positives, false_negatives, count);
+    bloom_filter_free(&filter);
+}
+
+static void bench_cuckoo(const uint64_t* const present, const uint64_t* const absent, const size_t count) {
+    CuckooFilter filter;
+    cuckoo_filter_init(&filter, count);
+    size_t rejected = 0;
+    double begin = now_seconds();
+    for (size_t i = 0; i < count; ++i) {
+        rejected += !cuckoo_filter_add(&filter, present[i]);
+    }
+    const double add_seconds = now_seconds() - begin;
+
+    size_t false_negatives = 0, false_positives = 0;
+    for (size_t i = 0; i < count; ++i) {
+        false_negatives += !cuckoo_filter_may_contain(&filter, present[i]);
+    }
+    begin = now_seconds();
+    for (size_t i = 0; i < count; ++i) {
+        false_positives += cuckoo_filter_may_contain(&filter, absent[i]);
+    }
+    const double query_seconds = now_seconds() - begin;
+    report("cuckoo (16-bit fp)", cuckoo_filter_bytes(&filter), count, add_seconds, query_seconds,
+           false_positives, false_negatives, count);     /* rejected keys count as false negatives */
+
+    /* removing every key must leave an empty filter behind */
+    size_t not_removed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        not_removed += !cuckoo_filter_remove(&filter, present[i]);
+    }
+    printf("%-20s load %.1f%%, %zu rejected inserts, %zu failed removals, %zu left\n", "",
+        100.0 * (double)(count - rejected) / (double)(filter.bucket_count * CUCKOO_BUCKET_SIZE),
+        rejected, not_removed, filter.count);
+    cuckoo_filter_free(&filter);
+}
+
+/**
+ * @brief Miss-only lookups against a Robin Hood table, alone and behind each filter.
+ * @return void
+ */
+static void bench_front(CPerson* const people, CPerson* const strangers, const size_t count) {
+    RobinHoodTable table;
+    BloomFilter bloom;
+    CuckooFilter cuckoo;
+    robin_hood_init(&table, count);
+    bloom_filter_init(&bloom, count, 10);
+    cuckoo_filter_init(&cuckoo, count);
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t hash = hash_name64(people[i].name, strnlen(people[i].name, MAX_NAME));
+        robin_hood_insert(&table, &people[i]);
+        bloom_filter_add(&bloom, hash);
+        cuckoo_filter_add(&cuckoo, hash);
+    }
+
+    size_t found[3] = { 0, 0, 0 };
+    double seconds[3];
+    for (int variant = 0; variant < 3; ++variant) {
+        const double begin = now_seconds();
+        for (size_t i = 0; i < count; ++i) {
+            const char* const name = strangers[i].name;
+            const uint64_t hash = hash_name64(name, strnlen(name, MAX_NAME));
+            const bool maybe = variant == 0 ? true
+                             : variant == 1 ? bloom_filter_may_contain(&bloom, hash)
+                                            : cuckoo_filter_may_contain(&cuckoo, hash);
+            found[variant] += maybe && robin_hood_lookup(&table, name) != NULL;
+        }
+        seconds[variant] = now_seconds() - begin;
+    }
+    printf("\nmiss lookups on a Robin Hood table of %zu people\n", count);
+    printf("\ttable only     %7.1f Mops/s\n", (double)count / seconds[0] / 1e6);
+    printf("\tbloom front    %7.1f Mops/s\n", (double)count / seconds[1] / 1e6);
+    printf("\tcuckoo front   %7.1f Mops/s\n", (double)count / seconds[2] / 1e6);
+    if (found[0] + found[1] + found[2] != 0) {
+        printf("\tunexpected hits: %zu %zu %zu\n", found[0], found[1], found[2]);
+    }
+
+    robin_hood_free(&table);
+    bloom_filter_free(&bloom);
+    cuckoo_filter_free(&cuckoo);
+}
+
+int main(int argc, char** argv) {
+    const size_t count = (argc > 1) ? (size_t)atol(argv[1]) : 200000;
+    if (count == 0) {
+        fprintf(stderr, "usage: %s [number of keys > 0]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    CPerson* people = (CPerson*)calloc(count, sizeof(CPerson));
+    CPerson* strangers = (CPerson*)calloc(count, sizeof(CPerson));
+    uint64_t* present = (uint64_t*)malloc(count * sizeof(uint64_t));
+    uint64_t* absent = (uint64_t*)malloc(count * sizeof(uint64_t));
+    if (people == NULL || strangers == NULL || present == NULL || absent == NULL) {
+        fprintf(stderr, "cannot allocate the keys of %zu people\n", count);
+        free(people);
+        free(strangers);
+        free(present);
+        free(absent);
+        return EXIT_FAILURE;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        snprintf(people[i].name, MAX_NAME, "person-%zu", i);
+        snprintf(strangers[i].name, MAX_NAME, "stranger-%zu", i);
+        present[i] = hash_name64(people[i].name, strlen(people[i].name));
+        absent[i] = hash_name64(strangers[i].name, strlen(strangers[i].name));
+    }
+
+    printf("%zu keys, %zu absent queries\n", count, count);
+    bench_bloom(present, absent, count, 10);
+    bench_bloom(present, absent, count, 16);
+    bench_cuckoo(present, absent, count);
+    bench_front(people, strangers, count);
+
+    free(people);
+    free(strangers);
+    free(present);
+    free(absent);
+    return 0;
+}
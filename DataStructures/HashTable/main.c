@@ -21,12 +21,13 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "cuckoo_filter.h"
+#include "person.h"
+#include "robin_hood_table.h"
+#include "swiss_table.h"
+#include "table_stats.h"
 
 
-#ifndef MAX_NAME
-#define MAX_NAME 256
-#endif
-
 #ifndef TABLE_SIZE
 #define TABLE_SIZE 10
 #endif
@@ -36,15 +37,6 @@
 #endif
 /* UL at the end of the hex address for DELETED_NODE means 'unsigned long'. */
 
-/**
- * @brief Define a C-style struct
- * and name it `CPerson`
- */
-typedef struct CPerson {
-    char name[MAX_NAME];
-    int age;
-} CPerson;
-
 /**
  * @brief Create hash function.
  * @return unsigned int
@@ -66,6 +58,20 @@ unsigned int hash(const char* const name) {                 /* constant pointer
  */
 CPerson* hash_table[TABLE_SIZE];
 
+/**
+ * @brief Approximate membership filter in front of the table.
+ * Most queries are misses; the filter answers them without probing.
+ */
+CuckooFilter person_filter;
+
+/**
+ * @brief Full 64-bit hash of a name for the filter.
+ * @return uint64_t
+ */
+uint64_t filter_hash(const char* const name) {
+    return hash_name64(name, strnlen(name, MAX_NAME));
+}
+
 /**
  * @brief Define a function to initialize the hash table.
  * @return void
@@ -76,6 +82,8 @@ void init_hash_table() {
         hash_table[i] = NULL;
     }
     /* array is initialized to null pointers. */
+    cuckoo_filter_free(&person_filter);
+    cuckoo_filter_init(&person_filter, TABLE_SIZE);
     return;
 }
 
@@ -117,6 +125,9 @@ bool insert_to_table(const CPerson* const ptr) {
     for (int i = 0; i < TABLE_SIZE; ++i) {
         int try_to_locate = (i + index) % TABLE_SIZE;   /* best case: person is allocated when i=0*/
         if (hash_table[try_to_locate] == NULL) {
+            if (!cuckoo_filter_add(&person_filter, filter_hash(ptr->name))) {
+                return false;                           /* filter is full, keep both in sync */
+            }
             hash_table[try_to_locate] = ptr;
             return true;
         }
@@ -131,6 +142,9 @@ bool insert_to_table(const CPerson* const ptr) {
  * @return CPerson*
  */
 CPerson* hash_table_lookup(const char* const name) {
+    if (!cuckoo_filter_may_contain(&person_filter, filter_hash(name))) {
+        return NULL;                                    /* definitely absent, no probing needed */
+    }
     int index = hash(name);
     for (int i = 0; i < TABLE_SIZE; ++i) {
         int try_to_locate = (i + index) % TABLE_SIZE;   /* best case: result is found when i=0. */
@@ -140,7 +154,7 @@ CPerson* hash_table_lookup(const char* const name) {
         if (hash_table[try_to_locate] == DELETED_NODE) {
             continue;
         }
-        if (strncmp(hash_table[try_to_locate]->name, name, TABLE_SIZE) == 0) {
+        if (strncmp(hash_table[try_to_locate]->name, name, MAX_NAME) == 0) {      /* compare the full key */
             return hash_table[try_to_locate];
         }
     }
@@ -163,9 +177,10 @@ CPerson* del_from_table(const char* const name) {
         if (hash_table[try_to_locate] == DELETED_NODE) {    /* indexed slot has been deleted. */
             continue;
         }
-        if(strncmp(hash_table[try_to_locate]->name, name, TABLE_SIZE) == 0) {
+        if(strncmp(hash_table[try_to_locate]->name, name, MAX_NAME) == 0) {
             CPerson* temp = hash_table[try_to_locate];      /* obtain a temporary copy to return */
             hash_table[try_to_locate] = DELETED_NODE;       /* mark the returned hash table element as deleted */
+            cuckoo_filter_remove(&person_filter, filter_hash(name));
             return temp;                                    /* compiler optimization */
         }
     }
@@ -200,6 +215,35 @@ int main(void) {
     /* delete jacob from the table and verify the result. */
     del_from_table("Jacob");
     print_table();
+    printf("Jacob is %s by the filter\n", hash_table_lookup("Jacob") == NULL ? "rejected" : "accepted");
+
+    /* the same people in a SwissTable, probed 16 control bytes at a time. */
+    SwissTable swiss;
+    swiss_table_init(&swiss, TABLE_SIZE);
+    swiss_table_insert(&swiss, &jacob);
+    swiss_table_insert(&swiss, &andy);
+    swiss_table_insert(&swiss, &liam);
+    swiss_table_erase(&swiss, "Jacob");
+    printf("\nSwissTable holds %zu people, Andy is %s, Jacob is %s\n", swiss.size,
+        swiss_table_lookup(&swiss, "Andy") ? "found" : "missing",
+        swiss_table_lookup(&swiss, "Jacob") ? "found" : "missing");
+    swiss_table_free(&swiss);
+
+    /* and in a Robin Hood table, where deletion leaves no tombstone behind. */
+    RobinHoodTable robin_hood;
+    robin_hood_init(&robin_hood, TABLE_SIZE);
+    robin_hood_insert(&robin_hood, &jacob);
+    robin_hood_insert(&robin_hood, &andy);
+    robin_hood_insert(&robin_hood, &liam);
+    robin_hood_erase(&robin_hood, "Jacob");
+    printf("Robin Hood table holds %zu people, Liam is %s, Jacob is %s\n", robin_hood.size,
+        robin_hood_lookup(&robin_hood, "Liam") ? "found" : "missing",
+        robin_hood_lookup(&robin_hood, "Jacob") ? "found" : "missing");
+    robin_hood_free(&robin_hood);
+    cuckoo_filter_free(&person_filter);
+
+    /* what both tables spent, all zeros unless built with -DHASH_TABLE_STATS. */
+    hash_table_stats_write_json(stdout);
 
     system("pause");
     return 0;
@@ -0,0 +1,77 @@
+/**
+ * @file person.h
+ * @author Xuhua Huang
+ * @brief Record type and key hashing shared by every hash table variant.
+ *
+ * `main.c` keeps its original modulo hash for the demonstration table;
+ * the variants (SwissTable, Robin Hood) need a full-width hash so that the
+ * low bits select a slot and the remaining bits can be kept as metadata.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef PERSON_H
+#define PERSON_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MAX_NAME
+#define MAX_NAME 256
+#endif
+
+/**
+ * @brief Define a C-style struct
+ * and name it `CPerson`
+ */
+typedef struct CPerson {
+    char name[MAX_NAME];
+    int age;
+} CPerson;
+
+/**
+ * @brief 64-bit FNV-1a over the name followed by a murmur3 finalizer.
+ * The finalizer spreads entropy to both ends of the word, which matters
+ * because the tables take the slot index and the metadata from different bits.
+ * @return uint64_t
+ */
+static inline uint64_t hash_name64(const char* const name, const size_t length) {
+    uint64_t hash_value = 0xcbf29ce484222325ULL;            /* FNV offset basis */
+    for (size_t i = 0; i < length; ++i) {
+        hash_value ^= (unsigned char)name[i];
+        hash_value *= 0x100000001b3ULL;                     /* FNV prime */
+    }
+    hash_value ^= hash_value >> 33;
+    hash_value *= 0xff51afd7ed558ccdULL;
+    hash_value ^= hash_value >> 33;
+    hash_value *= 0xc4ceb9fe1a85ec53ULL;
+    hash_value ^= hash_value >> 33;
+    return hash_value;
+}
+
+/**
+ * @brief Round a requested capacity up to the next power of two.
+ * @return size_t
+ */
+static inline size_t round_up_pow2(size_t capacity) {
+    size_t result = 1;
+    while (result < capacity) {
+        result <<= 1;
+    }
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERSON_H */
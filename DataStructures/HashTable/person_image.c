@@ -0,0 +1,316 @@
+/**
+ * @file person_image.c
+ * @author Xuhua Huang
+ * @brief Builder and memory-mapped reader of the person table image.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#if !defined(_WIN32) && !defined(_FILE_OFFSET_BITS)
+#define _FILE_OFFSET_BITS 64    /* images larger than 2 GiB on 32-bit systems */
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "person_image.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define seek_file _fseeki64
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define seek_file fseeko
+#endif
+
+static inline uint64_t align_up(const uint64_t offset) {
+    return (offset + PERSON_IMAGE_ALIGNMENT - 1) & ~(uint64_t)(PERSON_IMAGE_ALIGNMENT - 1);
+}
+
+/* a hash of 0 marks an empty slot */
+static inline uint64_t image_hash(const char* const name, const size_t length) {
+    const uint64_t hash = hash_name64(name, length);
+    return hash == 0 ? 1 : hash;
+}
+
+static inline uint64_t records_offset(void) {
+    return align_up(sizeof(PersonImageHeader));
+}
+
+static bool write_zeros(FILE* const file, uint64_t count) {
+    static const unsigned char zeros[PERSON_IMAGE_ALIGNMENT] = { 0 };
+    while (count > 0) {
+        const size_t chunk = count < sizeof(zeros) ? (size_t)count : sizeof(zeros);
+        if (fwrite(zeros, 1, chunk, file) != chunk) {
+            return false;
+        }
+        count -= chunk;
+    }
+    return true;
+}
+
+static bool read_record(FILE* const file, const uint64_t index, CPerson* const person) {
+    return seek_file(file, (long long)(records_offset() + index * sizeof(CPerson)), SEEK_SET) == 0
+        && fread(person, sizeof(CPerson), 1, file) == 1;
+}
+
+const char* person_image_status_string(PersonImageStatus status) {
+    switch (status) {
+    case PERSON_IMAGE_OK:           return "ok";
+    case PERSON_IMAGE_IO_ERROR:     return "I/O error";
+    case PERSON_IMAGE_BAD_MAGIC:    return "not a person image";
+    case PERSON_IMAGE_BAD_VERSION:  return "unsupported image version";
+    case PERSON_IMAGE_INCOMPATIBLE: return "image built for a different byte order or record layout";
+    case PERSON_IMAGE_CORRUPT:      return "image is truncated or corrupt";
+    case PERSON_IMAGE_NO_MEMORY:    return "out of memory";
+    }
+    return "unknown status";
+}
+
+PersonImageStatus person_image_builder_begin(PersonImageBuilder* builder, const char* path) {
+    memset(builder, 0, sizeof(*builder));
+    builder->file = fopen(path, "w+b");
+    if (builder->file == NULL) {
+        return PERSON_IMAGE_IO_ERROR;
+    }
+    /* the header is written last, once every offset is known */
+    if (!write_zeros(builder->file, records_offset())) {
+        fclose(builder->file);
+        builder->file = NULL;
+        return PERSON_IMAGE_IO_ERROR;
+    }
+    return PERSON_IMAGE_OK;
+}
+
+PersonImageStatus person_image_builder_add(PersonImageBuilder* builder, const CPerson* person) {
+    if (builder->count == builder->capacity) {
+        const size_t capacity = builder->capacity == 0 ? 1024 : builder->capacity * 2;
+        PersonImageSlot* entries = (PersonImageSlot*)realloc(builder->entries, capacity * sizeof(PersonImageSlot));
+        if (entries == NULL) {
+            return PERSON_IMAGE_NO_MEMORY;
+        }
+        builder->entries = entries;
+        builder->capacity = capacity;
+    }
+
+    /* copy through a zeroed record so bytes after the name are deterministic */
+    CPerson record;
+    memset(&record, 0, sizeof(record));
+    const size_t length = strnlen(person->name, MAX_NAME);
+    memcpy(record.name, person->name, length);
+    record.age = person->age;
+    if (fwrite(&record, sizeof(record), 1, builder->file) != 1) {
+        return PERSON_IMAGE_IO_ERROR;
+    }
+
+    builder->entries[builder->count].hash = image_hash(record.name, length);
+    builder->entries[builder->count].record = builder->count;
+    ++builder->count;
+    return PERSON_IMAGE_OK;
+}
+
+PersonImageStatus person_image_builder_finish(PersonImageBuilder* builder) {
+    PersonImageStatus status = PERSON_IMAGE_OK;
+    const uint64_t slots_offset = align_up(records_offset() + (uint64_t)builder->count * sizeof(CPerson));
+    const size_t slot_count = round_up_pow2(builder->count < 1 ? 2 : builder->count * 2);  /* load factor <= 1/2 */
+    const size_t mask = slot_count - 1;
+
+    PersonImageSlot* slots = (PersonImageSlot*)calloc(slot_count, sizeof(PersonImageSlot));
+    if (slots == NULL) {
+        status = PERSON_IMAGE_NO_MEMORY;
+        goto cleanup;
+    }
+    if (fflush(builder->file) != 0) {
+        status = PERSON_IMAGE_IO_ERROR;
+        goto cleanup;
+    }
+
+    for (size_t i = 0; i < builder->count; ++i) {
+        const PersonImageSlot entry = builder->entries[i];
+        size_t index = (size_t)entry.hash & mask;
+        bool duplicate = false;
+        while (slots[index].hash != 0 && !duplicate) {
+            if (slots[index].hash == entry.hash) {
+                /* equal hashes are rare, read both names back to tell them apart */
+                CPerson stored, incoming;
+                if (!read_record(builder->file, slots[index].record, &stored)
+                    || !read_record(builder->file, entry.record, &incoming)) {
+                    status = PERSON_IMAGE_IO_ERROR;
+                    goto cleanup;
+                }
+                duplicate = strncmp(stored.name, incoming.name, MAX_NAME) == 0;    /* first one wins */
+            }
+            index = (index + 1) & mask;
+        }
+        if (!duplicate) {
+            slots[index] = entry;
+        }
+    }
+
+    const uint64_t records_end = records_offset() + (uint64_t)builder->count * sizeof(CPerson);
+    if (seek_file(builder->file, (long long)records_end, SEEK_SET) != 0
+        || !write_zeros(builder->file, slots_offset - records_end)
+        || fwrite(slots, sizeof(PersonImageSlot), slot_count, builder->file) != slot_count) {
+        status = PERSON_IMAGE_IO_ERROR;
+        goto cleanup;
+    }
+
+    PersonImageHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PERSON_IMAGE_MAGIC, sizeof(header.magic));
+    header.version = PERSON_IMAGE_VERSION;
+    header.byte_order = PERSON_IMAGE_BYTE_ORDER;
+    header.header_size = sizeof(PersonImageHeader);
+    header.record_size = sizeof(CPerson);
+    header.max_name = MAX_NAME;
+    header.record_count = builder->count;
+    header.records_offset = records_offset();
+    header.slot_count = slot_count;
+    header.slots_offset = slots_offset;
+    header.file_size = slots_offset + (uint64_t)slot_count * sizeof(PersonImageSlot);
+    if (seek_file(builder->file, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, builder->file) != 1) {
+        status = PERSON_IMAGE_IO_ERROR;
+    }
+
+cleanup:
+    if (fclose(builder->file) != 0 && status == PERSON_IMAGE_OK) {
+        status = PERSON_IMAGE_IO_ERROR;
+    }
+    free(slots);
+    free(builder->entries);
+    memset(builder, 0, sizeof(*builder));
+    return status;
+}
+
+/**
+ * @brief Check that the header describes sections which fit in the mapping.
+ * @return PersonImageStatus
+ */
+static PersonImageStatus validate(const PersonImage* const image) {
+    const PersonImageHeader* const header = image->header;
+    if (image->length < sizeof(PersonImageHeader)) {
+        return PERSON_IMAGE_CORRUPT;
+    }
+    if (memcmp(header->magic, PERSON_IMAGE_MAGIC, sizeof(header->magic)) != 0) {
+        return PERSON_IMAGE_BAD_MAGIC;
+    }
+    if (header->version != PERSON_IMAGE_VERSION) {
+        return PERSON_IMAGE_BAD_VERSION;
+    }
+    if (header->byte_order != PERSON_IMAGE_BYTE_ORDER || header->header_size != sizeof(PersonImageHeader)
+        || header->record_size != sizeof(CPerson) || header->max_name != MAX_NAME) {
+        return PERSON_IMAGE_INCOMPATIBLE;
+    }
+    const uint64_t length = image->length;
+    if (header->file_size != length
+        || header->records_offset > length
+        || header->record_count > (length - header->records_offset) / sizeof(CPerson)
+        || header->slots_offset > length || header->slots_offset % sizeof(uint64_t) != 0
+        || header->slot_count == 0 || (header->slot_count & (header->slot_count - 1)) != 0
+        || header->slot_count > (length - header->slots_offset) / sizeof(PersonImageSlot)) {
+        return PERSON_IMAGE_CORRUPT;
+    }
+    return PERSON_IMAGE_OK;
+}
+
+PersonImageStatus person_image_open(PersonImage* image, const char* path) {
+    memset(image, 0, sizeof(*image));
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return PERSON_IMAGE_IO_ERROR;
+    }
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0
+        || (mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL)) == NULL) {
+        CloseHandle(file);
+        return size.QuadPart == 0 ? PERSON_IMAGE_CORRUPT : PERSON_IMAGE_IO_ERROR;
+    }
+    image->base = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (image->base == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return PERSON_IMAGE_IO_ERROR;
+    }
+    image->length = (size_t)size.QuadPart;
+    image->file_handle = file;
+    image->mapping_handle = mapping;
+#else
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return PERSON_IMAGE_IO_ERROR;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return PERSON_IMAGE_IO_ERROR;
+    }
+    if (info.st_size == 0) {
+        close(fd);
+        return PERSON_IMAGE_CORRUPT;
+    }
+    void* base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);      /* the mapping keeps the file alive */
+    if (base == MAP_FAILED) {
+        return PERSON_IMAGE_IO_ERROR;
+    }
+    image->base = (const unsigned char*)base;
+    image->length = (size_t)info.st_size;
+#endif
+
+    image->header = (const PersonImageHeader*)image->base;
+    const PersonImageStatus status = validate(image);
+    if (status != PERSON_IMAGE_OK) {
+        person_image_close(image);
+        return status;
+    }
+    image->records = (const CPerson*)(image->base + image->header->records_offset);
+    image->slots = (const PersonImageSlot*)(image->base + image->header->slots_offset);
+    return PERSON_IMAGE_OK;
+}
+
+void person_image_close(PersonImage* image) {
+    if (image->base != NULL) {
+#ifdef _WIN32
+        UnmapViewOfFile(image->base);
+        CloseHandle(image->mapping_handle);
+        CloseHandle(image->file_handle);
+#else
+        munmap((void*)image->base, image->length);
+#endif
+    }
+    memset(image, 0, sizeof(*image));
+    return;
+}
+
+const CPerson* person_image_lookup(const PersonImage* image, const char* name) {
+    if (image == NULL || image->slots == NULL || name == NULL) {
+        return NULL;
+    }
+    const size_t length = strnlen(name, MAX_NAME);
+    const uint64_t hash = image_hash(name, length);
+    const uint64_t mask = image->header->slot_count - 1;
+    uint64_t index = hash & mask;
+    for (uint64_t probed = 0; probed <= mask; ++probed) {
+        const PersonImageSlot slot = image->slots[index];
+        if (slot.hash == 0) {
+            return NULL;
+        }
+        if (slot.hash == hash && slot.record < image->header->record_count) {
+            const CPerson* const person = &image->records[slot.record];
+            if (strnlen(person->name, MAX_NAME) == length && memcmp(person->name, name, length) == 0) {
+                return person;
+            }
+        }
+        index = (index + 1) & mask;
+    }
+    return NULL;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file person_image.h
+ * @author Xuhua Huang
+ * @brief Read-only, memory-mappable on-disk format of the person table.
+ *
+ * Rebuilding the table with `insert_to_table` at every start costs time
+ * proportional to the data. An image is built once and then mapped read-only:
+ * lookups run directly against the page cache and every process mapping the
+ * same file shares one copy.
+ *
+ * Layout, all offsets are relative to the start of the file:
+ *
+ *   +--------------------+  0
+ *   | PersonImageHeader  |  magic, version, sizes and section offsets
+ *   +--------------------+  records_offset (64-byte aligned)
+ *   | CPerson[count]     |  records in input order
+ *   +--------------------+  slots_offset (64-byte aligned)
+ *   | PersonImageSlot[]  |  open addressing table, power-of-two length,
+ *   +--------------------+  each slot holds a hash and a record index
+ *
+ * The file uses the byte order and `CPerson` layout of the machine that
+ * built it; both are recorded in the header and verified on open.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef PERSON_IMAGE_H
+#define PERSON_IMAGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "person.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PERSON_IMAGE_MAGIC "CPERSON\x1A"
+#define PERSON_IMAGE_VERSION 1u
+#define PERSON_IMAGE_BYTE_ORDER 0x01020304u
+#define PERSON_IMAGE_ALIGNMENT 64u
+
+typedef struct PersonImageHeader {
+    char magic[8];              /* PERSON_IMAGE_MAGIC */
+    uint32_t version;           /* PERSON_IMAGE_VERSION */
+    uint32_t byte_order;        /* PERSON_IMAGE_BYTE_ORDER as written by the builder */
+    uint32_t header_size;       /* sizeof(PersonImageHeader) */
+    uint32_t record_size;       /* sizeof(CPerson) */
+    uint32_t max_name;          /* MAX_NAME */
+    uint32_t reserved;
+    uint64_t record_count;
+    uint64_t records_offset;
+    uint64_t slot_count;        /* power of two, at least twice record_count */
+    uint64_t slots_offset;
+    uint64_t file_size;
+} PersonImageHeader;
+
+typedef struct PersonImageSlot {
+    uint64_t hash;              /* 0 for an empty slot */
+    uint64_t record;            /* index into the record section */
+} PersonImageSlot;
+
+typedef enum PersonImageStatus {
+    PERSON_IMAGE_OK = 0,
+    PERSON_IMAGE_IO_ERROR,
+    PERSON_IMAGE_BAD_MAGIC,
+    PERSON_IMAGE_BAD_VERSION,
+    PERSON_IMAGE_INCOMPATIBLE,  /* different byte order or record layout */
+    PERSON_IMAGE_CORRUPT,       /* offsets or sizes do not fit in the file */
+    PERSON_IMAGE_NO_MEMORY,
+} PersonImageStatus;
+
+/**
+ * @brief A mapped image. All pointers point into the read-only mapping.
+ */
+typedef struct PersonImage {
+    const unsigned char* base;
+    size_t length;
+    const PersonImageHeader* header;
+    const CPerson* records;
+    const PersonImageSlot* slots;
+#ifdef _WIN32
+    void* file_handle;
+    void* mapping_handle;
+#endif
+} PersonImage;
+
+/**
+ * @brief Streaming builder: records are appended to the file as they arrive,
+ * only 16 bytes of (hash, index) per record are kept in memory.
+ */
+typedef struct PersonImageBuilder {
+    FILE* file;
+    PersonImageSlot* entries;
+    size_t count;
+    size_t capacity;
+} PersonImageBuilder;
+
+/**
+ * @brief Describe a status code.
+ * @return const char*
+ */
+const char* person_image_status_string(PersonImageStatus status);
+
+/**
+ * @brief Create the output file and reserve room for the header.
+ * @return PersonImageStatus
+ */
+PersonImageStatus person_image_builder_begin(PersonImageBuilder* builder, const char* path);
+
+/**
+ * @brief Append one record. Later records with an existing name are dropped at finish.
+ * @return PersonImageStatus
+ */
+PersonImageStatus person_image_builder_add(PersonImageBuilder* builder, const CPerson* person);
+
+/**
+ * @brief Write the slot table and the header, then close the file.
+ * @return PersonImageStatus
+ */
+PersonImageStatus person_image_builder_finish(PersonImageBuilder* builder);
+
+/**
+ * @brief Map an image read-only and validate its header.
+ * @return PersonImageStatus
+ */
+PersonImageStatus person_image_open(PersonImage* image, const char* path);
+
+/**
+ * @brief Unmap an image.
+ * @return void
+ */
+void person_image_close(PersonImage* image);
+
+/**
+ * @brief Look up a person by name directly in the mapping.
+ * @return const CPerson* -> NULL if the name is not in the image
+ */
+const CPerson* person_image_lookup(const PersonImage* image, const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERSON_IMAGE_H */
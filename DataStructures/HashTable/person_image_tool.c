@@ -0,0 +1,124 @@
+/**
+ * @file person_image_tool.c
+ * @author Xuhua Huang
+ * @brief Build a person image in one streaming pass, or query one in place.
+ *
+ * Input is one record per line, `name,age`; the last comma separates the
+ * fields so names may contain commas. Use `-` to read from stdin.
+ *
+ * To build and run on Linux:
+ * $ make person_image_tool
+ * $ ./person_image_tool build people.csv people.img
+ * $ ./person_image_tool lookup people.img Jacob Andy
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "person_image.h"
+
+static int usage(const char* const program) {
+    fprintf(stderr, "usage: %s build <input.csv|-> <output.img>\n", program);
+    fprintf(stderr, "       %s lookup <image.img> <name>...\n", program);
+    return EXIT_FAILURE;
+}
+
+static int build(const char* const input_path, const char* const output_path) {
+    FILE* input = strcmp(input_path, "-") == 0 ? stdin : fopen(input_path, "r");
+    if (input == NULL) {
+        perror(input_path);
+        return EXIT_FAILURE;
+    }
+
+    PersonImageBuilder builder;
+    PersonImageStatus status = person_image_builder_begin(&builder, output_path);
+    if (status != PERSON_IMAGE_OK) {
+        fprintf(stderr, "%s: %s\n", output_path, person_image_status_string(status));
+        if (input != stdin) {
+            fclose(input);
+        }
+        return EXIT_FAILURE;
+    }
+
+    char line[MAX_NAME + 32];
+    size_t line_number = 0, skipped = 0;
+    while (status == PERSON_IMAGE_OK && fgets(line, sizeof(line), input) != NULL) {
+        ++line_number;
+        if (strchr(line, '\n') == NULL && !feof(input)) {
+            /* longer than any record: drop the rest, so it is not read as a line of its own */
+            int c;
+            while ((c = fgetc(input)) != '\n' && c != EOF) {
+            }
+            fprintf(stderr, "line %zu: longer than %zu characters, skipped\n", line_number, sizeof(line) - 2);
+            ++skipped;
+            continue;
+        }
+        line[strcspn(line, "\r\n")] = '\0';
+        char* const comma = strrchr(line, ',');
+        if (comma == NULL || comma == line || (size_t)(comma - line) >= MAX_NAME) {
+            fprintf(stderr, "line %zu: expected `name,age`, skipped\n", line_number);
+            ++skipped;
+            continue;
+        }
+        *comma = '\0';
+        CPerson person;
+        memset(&person, 0, sizeof(person));
+        strncpy(person.name, line, MAX_NAME - 1);
+        person.age = atoi(comma + 1);
+        status = person_image_builder_add(&builder, &person);
+    }
+    if (input != stdin) {
+        fclose(input);
+    }
+
+    const size_t count = builder.count;
+    if (status == PERSON_IMAGE_OK) {
+        status = person_image_builder_finish(&builder);
+    } else {
+        person_image_builder_finish(&builder);
+    }
+    if (status != PERSON_IMAGE_OK) {
+        fprintf(stderr, "%s: %s\n", output_path, person_image_status_string(status));
+        return EXIT_FAILURE;
+    }
+    printf("Wrote %zu records to %s (%zu lines skipped)\n", count, output_path, skipped);
+    return EXIT_SUCCESS;
+}
+
+static int lookup(const char* const image_path, char** const names, const int count) {
+    PersonImage image;
+    const PersonImageStatus status = person_image_open(&image, image_path);
+    if (status != PERSON_IMAGE_OK) {
+        fprintf(stderr, "%s: %s\n", image_path, person_image_status_string(status));
+        return EXIT_FAILURE;
+    }
+    int missing = 0;
+    for (int i = 0; i < count; ++i) {
+        const CPerson* const person = person_image_lookup(&image, names[i]);
+        if (person == NULL) {
+            printf("%s is not found in the image!\n", names[i]);
+            ++missing;
+        } else {
+            printf("Found %s, age %i\n", person->name, person->age);
+        }
+    }
+    person_image_close(&image);
+    return missing == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 4 && strcmp(argv[1], "build") == 0) {
+        return build(argv[2], argv[3]);
+    }
+    if (argc >= 4 && strcmp(argv[1], "lookup") == 0) {
+        return lookup(argv[2], argv + 3, argc - 3);
+    }
+    return usage(argv[0]);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file person_slot.h
+ * @author Xuhua Huang
+ * @brief Slot layout that keeps the full hash and short keys next to the
+ * record pointer, so probing rarely has to dereference a `CPerson*`.
+ *
+ * A `CPerson` is 260 bytes; comparing names through the pointer costs one
+ * cache miss per probed slot. A `PersonSlot` is 32 bytes, two per cache line:
+ *   - the full 64-bit hash rejects almost every mismatch on its own,
+ *   - names shorter than PERSON_SLOT_INLINE_KEY bytes are compared in place,
+ *   - longer names fall back to the record, reached only after a hash match.
+ * Records must not be renamed while they are stored in a table.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef PERSON_SLOT_H
+#define PERSON_SLOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "person.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PERSON_SLOT_INLINE_KEY 15
+#define PERSON_SLOT_SPILLED 0xFF     /* the name lives only in the record */
+
+typedef struct PersonSlot {
+    uint64_t hash;                      /* full hash of the name, also reused on rehash */
+    CPerson* person;                    /* payload, dereferenced only on a hash match */
+    uint8_t length;                     /* name length, or PERSON_SLOT_SPILLED */
+    char key[PERSON_SLOT_INLINE_KEY];   /* inline copy of short names, not null-terminated */
+} PersonSlot;
+
+/**
+ * @brief Fill a slot for a record whose name hash and length are known.
+ * @return void
+ */
+static inline void person_slot_fill(PersonSlot* const slot, CPerson* const person,
+                                    const uint64_t hash, const size_t length) {
+    slot->hash = hash;
+    slot->person = person;
+    if (length <= PERSON_SLOT_INLINE_KEY) {
+        slot->length = (uint8_t)length;
+        memcpy(slot->key, person->name, length);
+    } else {
+        slot->length = PERSON_SLOT_SPILLED;
+    }
+    return;
+}
+
+/**
+ * @brief Compare a slot against a key over its full length.
+ * @return bool
+ */
+static inline bool person_slot_matches(const PersonSlot* const slot, const uint64_t hash,
+                                       const char* const name, const size_t length) {
+    if (slot->hash != hash) {
+        return false;
+    }
+    if (slot->length != PERSON_SLOT_SPILLED) {
+        return slot->length == length && memcmp(slot->key, name, length) == 0;
+    }
+    return strnlen(slot->person->name, MAX_NAME) == length
+        && memcmp(slot->person->name, name, length) == 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERSON_SLOT_H */
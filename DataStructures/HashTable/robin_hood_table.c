@@ -0,0 +1,191 @@
+/**
+ * @file robin_hood_table.c
+ * @author Xuhua Huang
+ * @brief Robin Hood hashing with backward-shift deletion.
+ *
+ * Invariant: walking from a key's home bucket, the stored distances never
+ * drop below the distance walked so far until the key is found. A lookup can
+ * therefore stop at the first slot whose distance is smaller than its own,
+ * and only compares names in slots that share the key's home bucket.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "robin_hood_table.h"
+#include "table_stats.h"
+
+#define ROBIN_HOOD_NOT_FOUND ((size_t)-1)
+
+/* maximum load factor of 7/8 */
+static inline size_t max_load(const size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+static bool allocate(RobinHoodTable* const table, size_t capacity) {
+    capacity = round_up_pow2(capacity < 8 ? 8 : capacity);
+    uint8_t* dist = (uint8_t*)calloc(capacity, sizeof(uint8_t));
+    PersonSlot* slots = (PersonSlot*)malloc(capacity * sizeof(PersonSlot));
+    if (dist == NULL || slots == NULL) {
+        free(dist);
+        free(slots);
+        return false;
+    }
+    table->dist = dist;
+    table->slots = slots;
+    table->capacity = capacity;
+    table->size = 0;
+    HASH_TABLE_COUNT(HASH_TABLE_ROBIN_HOOD, HASH_TABLE_ALLOCATIONS, 2);
+    HASH_TABLE_COUNT(HASH_TABLE_ROBIN_HOOD, HASH_TABLE_BYTES_ALLOCATED, capacity * (sizeof(uint8_t) + sizeof(PersonSlot)));
+    return true;
+}
+
+static bool grow(RobinHoodTable* table);
+
+/**
+ * @brief Place a slot whose key is known to be absent, displacing richer elements.
+ * @return bool -> false only if growing the table failed
+ */
+static bool place(RobinHoodTable* const table, PersonSlot slot) {
+    const size_t mask = table->capacity - 1;
+    size_t index = (size_t)slot.hash & mask;
+    uint8_t dist = 1;
+    size_t probes = 1;
+    for (;;) {
+        if (table->dist[index] == 0) {
+            table->dist[index] = dist;
+            table->slots[index] = slot;
+            ++table->size;
+            HASH_TABLE_COUNT_PROBE(HASH_TABLE_ROBIN_HOOD, probes);
+            return true;
+        }
+        if (table->dist[index] < dist) {    /* take from the rich, the resident moves on */
+            HASH_TABLE_COUNT(HASH_TABLE_ROBIN_HOOD, HASH_TABLE_DISPLACEMENTS, 1);
+            const PersonSlot displaced = table->slots[index];
+            const uint8_t displaced_dist = table->dist[index];
+            table->slots[index] = slot;
+            table->dist[index] = dist;
+            slot = displaced;
+            dist = displaced_dist;
+        }
+        if (dist == ROBIN_HOOD_MAX_DIST) {  /* the element in hand is the only one not placed */
+            HASH_TABLE_COUNT_PROBE(HASH_TABLE_ROBIN_HOOD, probes);
+            return grow(table) && place(table, slot);
+        }
+        ++dist;
+        ++probes;
+        index = (index + 1) & mask;
+    }
+}
+
+static bool grow(RobinHoodTable* table) {
+    RobinHoodTable old = *table;
+    if (!allocate(table, old.capacity * 2)) {
+        *table = old;
+        return false;
+    }
+    HASH_TABLE_COUNT(HASH_TABLE_ROBIN_HOOD, HASH_TABLE_REHASHES, 1);
+    for (size_t i = 0; i < old.capacity; ++i) {
+        if (old.dist[i] != 0 && !place(table, old.slots[i])) {
+            robin_hood_free(table);
+            *table = old;
+            return false;
+        }
+    }
+    robin_hood_free(&old);
+    return true;
+}
+
+static size_t find_index(const RobinHoodTable* const table, const char* const name,
+                         const size_t length, const uint64_t hash) {
+    const size_t mask = table->capacity - 1;
+    size_t index = (size_t)hash & mask;
+    unsigned dist = 1;
+    for (; table->dist[index] >= dist; ++dist) {
+        if (table->dist[index] == dist && person_slot_matches(&table->slots[index], hash, name, length)) {
+            HASH_TABLE_COUNT_PROBE(HASH_TABLE_ROBIN_HOOD, dist);
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+    HASH_TABLE_COUNT_PROBE(HASH_TABLE_ROBIN_HOOD, dist);  /* the slot that ended the probe included */
+    return ROBIN_HOOD_NOT_FOUND;
+}
+
+bool robin_hood_init(RobinHoodTable* table, size_t capacity) {
+    if (table == NULL) {
+        return false;
+    }
+    /* leave room for the 7/8 maximum load factor */
+    return allocate(table, (capacity * 8 + 6) / 7);
+}
+
+void robin_hood_free(RobinHoodTable* table) {
+    if (table == NULL) {
+        return;
+    }
+    free(table->dist);
+    free(table->slots);
+    table->dist = NULL;
+    table->slots = NULL;
+    table->capacity = table->size = 0;
+    return;
+}
+
+bool robin_hood_insert(RobinHoodTable* table, CPerson* person) {
+    if (table == NULL || person == NULL) {
+        return false;
+    }
+    const size_t length = strnlen(person->name, MAX_NAME);
+    const uint64_t hash = hash_name64(person->name, length);
+    if (find_index(table, person->name, length, hash) != ROBIN_HOOD_NOT_FOUND) {
+        return false;
+    }
+    if (table->size + 1 > max_load(table->capacity) && !grow(table)) {
+        return false;
+    }
+    PersonSlot slot;
+    person_slot_fill(&slot, person, hash, length);
+    return place(table, slot);
+}
+
+CPerson* robin_hood_lookup(const RobinHoodTable* table, const char* name) {
+    if (table == NULL || name == NULL) {
+        return NULL;
+    }
+    const size_t length = strnlen(name, MAX_NAME);
+    const size_t index = find_index(table, name, length, hash_name64(name, length));
+    return index == ROBIN_HOOD_NOT_FOUND ? NULL : table->slots[index].person;
+}
+
+CPerson* robin_hood_erase(RobinHoodTable* table, const char* name) {
+    if (table == NULL || name == NULL) {
+        return NULL;
+    }
+    const size_t length = strnlen(name, MAX_NAME);
+    size_t index = find_index(table, name, length, hash_name64(name, length));
+    if (index == ROBIN_HOOD_NOT_FOUND) {
+        return NULL;
+    }
+    CPerson* const removed = table->slots[index].person;
+
+    /* shift the rest of the cluster back until an empty slot or an element at home */
+    const size_t mask = table->capacity - 1;
+    size_t next = (index + 1) & mask;
+    while (table->dist[next] > 1) {
+        HASH_TABLE_COUNT(HASH_TABLE_ROBIN_HOOD, HASH_TABLE_DISPLACEMENTS, 1);
+        table->slots[index] = table->slots[next];
+        table->dist[index] = table->dist[next] - 1;
+        index = next;
+        next = (next + 1) & mask;
+    }
+    table->dist[index] = 0;
+    --table->size;
+    return removed;
+}
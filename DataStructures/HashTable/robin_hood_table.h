@@ -0,0 +1,81 @@
+/**
+ * @file robin_hood_table.h
+ * @author Xuhua Huang
+ * @brief Linear probing hash table with Robin Hood insertion
+ * and backward-shift deletion.
+ *
+ * Each slot keeps one byte of metadata: 0 for an empty slot, otherwise the
+ * distance from its home bucket plus one. Insertion lets an element take the
+ * slot of a "richer" element (one closer to home), which keeps probe lengths
+ * short and evenly distributed. Deletion shifts the following cluster back by
+ * one slot instead of leaving a `DELETED_NODE` tombstone, so lookups never
+ * slow down after erasures. Slots are `PersonSlot`s, so the name comparison
+ * on a matching distance is usually settled by the stored hash alone.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef ROBIN_HOOD_TABLE_H
+#define ROBIN_HOOD_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "person.h"
+#include "person_slot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* probe distances are stored in a byte, the table grows before one overflows */
+#define ROBIN_HOOD_MAX_DIST 254
+
+typedef struct RobinHoodTable {
+    uint8_t* dist;          /* 0 for empty, otherwise probe distance + 1 */
+    PersonSlot* slots;      /* capacity slots, valid where dist is non-zero */
+    size_t capacity;        /* power of two */
+    size_t size;            /* number of occupied slots */
+} RobinHoodTable;
+
+/**
+ * @brief Allocate a table able to hold at least `capacity` elements.
+ * @return bool -> false if the allocation failed
+ */
+bool robin_hood_init(RobinHoodTable* table, size_t capacity);
+
+/**
+ * @brief Release the metadata and slot arrays; the records are not owned.
+ * @return void
+ */
+void robin_hood_free(RobinHoodTable* table);
+
+/**
+ * @brief Insert a person keyed by name, growing the table when needed.
+ * @return bool -> false for NULL input, duplicate names or allocation failure
+ */
+bool robin_hood_insert(RobinHoodTable* table, CPerson* person);
+
+/**
+ * @brief Look up a person by name. Probing stops as soon as a slot is
+ * closer to its home bucket than the key would be.
+ * @return CPerson* -> NULL if the name is not in the table
+ */
+CPerson* robin_hood_lookup(const RobinHoodTable* table, const char* name);
+
+/**
+ * @brief Remove a person by name with backward-shift deletion.
+ * @return CPerson* -> the removed record, NULL if the name was not found
+ */
+CPerson* robin_hood_erase(RobinHoodTable* table, const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROBIN_HOOD_TABLE_H */
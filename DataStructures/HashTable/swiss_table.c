@@ -0,0 +1,291 @@
+/**
+ * @file swiss_table.c
+ * @author Xuhua Huang
+ * @brief SwissTable-style open addressing with SIMD metadata scans.
+ *
+ * The 64-bit hash is split in two:
+ *   - H1 (hash >> 7) selects the group where probing starts,
+ *   - H2 (hash & 0x7F) is stored in the control byte of the slot.
+ * Groups are probed with triangular steps of 16 slots, which visits every
+ * group exactly once because the capacity is a power of two.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "swiss_table.h"
+#include "table_stats.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#define SWISS_NOT_FOUND ((size_t)-1)
+
+/* one bit per slot of a group, bit i stands for slot (pos + i) */
+typedef uint32_t BitMask;
+
+static inline unsigned trailing_zeros(const BitMask mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctz(mask);
+#endif
+}
+
+static inline unsigned leading_zeros16(const BitMask mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return 15u - (unsigned)index;
+#else
+    return (unsigned)__builtin_clz(mask) - 16u;
+#endif
+}
+
+/**
+ * @brief Compare 16 control bytes against a tag.
+ * @return BitMask -> bit i is set when group[i] == tag
+ */
+static inline BitMask group_match(const int8_t* const group, const int8_t tag) {
+#ifdef SWISS_USE_SSE2
+    const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (BitMask)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), ctrl));
+#else
+    BitMask mask = 0;
+    for (int i = 0; i < SWISS_GROUP_WIDTH; ++i) {
+        mask |= (BitMask)(group[i] == tag) << i;
+    }
+    return mask;
+#endif
+}
+
+static inline BitMask group_match_empty(const int8_t* const group) {
+    return group_match(group, SWISS_EMPTY);
+}
+
+/**
+ * @brief Both special values are negative and below -1, full slots are not.
+ * @return BitMask -> bit i is set when group[i] is empty or deleted
+ */
+static inline BitMask group_match_empty_or_deleted(const int8_t* const group) {
+#ifdef SWISS_USE_SSE2
+    const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (BitMask)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl));
+#else
+    BitMask mask = 0;
+    for (int i = 0; i < SWISS_GROUP_WIDTH; ++i) {
+        mask |= (BitMask)(group[i] < -1) << i;
+    }
+    return mask;
+#endif
+}
+
+static inline size_t h1(const uint64_t hash) { return (size_t)(hash >> 7); }
+static inline int8_t h2(const uint64_t hash) { return (int8_t)(hash & 0x7F); }
+
+/* maximum load factor of 7/8 */
+static inline size_t capacity_to_growth(const size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+/**
+ * @brief Write a control byte and keep the mirrored tail in sync, so that
+ * a 16-byte load starting near the end of the array wraps around correctly.
+ * @return void
+ */
+static inline void set_ctrl(SwissTable* const table, const size_t index, const int8_t value) {
+    table->ctrl[index] = value;
+    if (index < SWISS_GROUP_WIDTH) {
+        table->ctrl[table->capacity + index] = value;
+    }
+}
+
+static bool allocate(SwissTable* const table, size_t capacity) {
+    capacity = round_up_pow2(capacity < SWISS_GROUP_WIDTH ? SWISS_GROUP_WIDTH : capacity);
+    int8_t* ctrl = (int8_t*)malloc(capacity + SWISS_GROUP_WIDTH);
+    PersonSlot* slots = (PersonSlot*)malloc(capacity * sizeof(PersonSlot));
+    if (ctrl == NULL || slots == NULL) {
+        free(ctrl);
+        free(slots);
+        return false;
+    }
+    memset(ctrl, (unsigned char)SWISS_EMPTY, capacity + SWISS_GROUP_WIDTH);
+    HASH_TABLE_COUNT(HASH_TABLE_SWISS, HASH_TABLE_ALLOCATIONS, 2);
+    HASH_TABLE_COUNT(HASH_TABLE_SWISS, HASH_TABLE_BYTES_ALLOCATED,
+                     capacity + SWISS_GROUP_WIDTH + capacity * sizeof(PersonSlot));
+    table->ctrl = ctrl;
+    table->slots = slots;
+    table->capacity = capacity;
+    table->size = 0;
+    table->growth_left = capacity_to_growth(capacity);
+    return true;
+}
+
+/**
+ * @brief Locate the first empty or deleted slot on the probe sequence of a hash.
+ * Always succeeds because the load factor keeps empty slots around.
+ * @return size_t
+ */
+static size_t find_first_non_full(const SwissTable* const table, const uint64_t hash) {
+    const size_t mask = table->capacity - 1;
+    size_t pos = h1(hash) & mask;
+    size_t step = 0;
+    for (;;) {
+        const BitMask candidates = group_match_empty_or_deleted(table->ctrl + pos);
+        if (candidates != 0) {
+            HASH_TABLE_COUNT_PROBE(HASH_TABLE_SWISS, step / SWISS_GROUP_WIDTH + 1);
+            return (pos + trailing_zeros(candidates)) & mask;
+        }
+        step += SWISS_GROUP_WIDTH;
+        pos = (pos + step) & mask;
+    }
+}
+
+/**
+ * @brief Locate the slot holding `name`.
+ * @return size_t -> SWISS_NOT_FOUND if the name is absent
+ */
+static size_t find_index(const SwissTable* const table, const char* const name,
+                         const size_t length, const uint64_t hash) {
+    const size_t mask = table->capacity - 1;
+    const int8_t tag = h2(hash);
+    size_t pos = h1(hash) & mask;
+    size_t step = 0;
+    while (step < table->capacity) {
+        const int8_t* const group = table->ctrl + pos;
+        for (BitMask match = group_match(group, tag); match != 0; match &= match - 1) {
+            const size_t index = (pos + trailing_zeros(match)) & mask;
+            if (person_slot_matches(&table->slots[index], hash, name, length)) {
+                HASH_TABLE_COUNT_PROBE(HASH_TABLE_SWISS, step / SWISS_GROUP_WIDTH + 1);
+                return index;
+            }
+        }
+        if (group_match_empty(group) != 0) {    /* an empty slot ends every probe sequence */
+            HASH_TABLE_COUNT_PROBE(HASH_TABLE_SWISS, step / SWISS_GROUP_WIDTH + 1);
+            return SWISS_NOT_FOUND;
+        }
+        step += SWISS_GROUP_WIDTH;
+        pos = (pos + step) & mask;
+    }
+    HASH_TABLE_COUNT_PROBE(HASH_TABLE_SWISS, step / SWISS_GROUP_WIDTH);
+    return SWISS_NOT_FOUND;
+}
+
+/**
+ * @brief Rebuild the table, doubling it unless tombstones are the reason we ran out of room.
+ * @return bool
+ */
+static bool rehash(SwissTable* const table) {
+    SwissTable old = *table;
+    const size_t new_capacity = (old.size > capacity_to_growth(old.capacity) / 2) ? old.capacity * 2 : old.capacity;
+    if (!allocate(table, new_capacity)) {
+        *table = old;
+        return false;
+    }
+    HASH_TABLE_COUNT(HASH_TABLE_SWISS, HASH_TABLE_REHASHES, 1);
+    for (size_t i = 0; i < old.capacity; ++i) {
+        if (old.ctrl[i] >= 0) {
+            const size_t index = find_first_non_full(table, old.slots[i].hash);
+            set_ctrl(table, index, old.ctrl[i]);
+            table->slots[index] = old.slots[i];     /* the stored hash saves rehashing names */
+        }
+    }
+    table->size = old.size;
+    table->growth_left -= old.size;
+    swiss_table_free(&old);
+    return true;
+}
+
+bool swiss_table_init(SwissTable* table, size_t capacity) {
+    if (table == NULL) {
+        return false;
+    }
+    /* leave room for the 7/8 maximum load factor */
+    return allocate(table, (capacity * 8 + 6) / 7);
+}
+
+void swiss_table_free(SwissTable* table) {
+    if (table == NULL) {
+        return;
+    }
+    free(table->ctrl);
+    free(table->slots);
+    table->ctrl = NULL;
+    table->slots = NULL;
+    table->capacity = table->size = table->growth_left = 0;
+    return;
+}
+
+bool swiss_table_insert(SwissTable* table, CPerson* person) {
+    if (table == NULL || person == NULL) {
+        return false;
+    }
+    const size_t length = strnlen(person->name, MAX_NAME);
+    const uint64_t hash = hash_name64(person->name, length);
+    if (find_index(table, person->name, length, hash) != SWISS_NOT_FOUND) {
+        return false;
+    }
+    size_t index = find_first_non_full(table, hash);
+    if (table->growth_left == 0 && table->ctrl[index] == SWISS_EMPTY) {
+        if (!rehash(table)) {
+            return false;
+        }
+        index = find_first_non_full(table, hash);
+    }
+    table->growth_left -= (table->ctrl[index] == SWISS_EMPTY);  /* reusing a tombstone is free */
+    set_ctrl(table, index, h2(hash));
+    person_slot_fill(&table->slots[index], person, hash, length);
+    ++table->size;
+    return true;
+}
+
+CPerson* swiss_table_lookup(const SwissTable* table, const char* name) {
+    if (table == NULL || name == NULL) {
+        return NULL;
+    }
+    const size_t length = strnlen(name, MAX_NAME);
+    const size_t index = find_index(table, name, length, hash_name64(name, length));
+    return index == SWISS_NOT_FOUND ? NULL : table->slots[index].person;
+}
+
+CPerson* swiss_table_erase(SwissTable* table, const char* name) {
+    if (table == NULL || name == NULL) {
+        return NULL;
+    }
+    const size_t length = strnlen(name, MAX_NAME);
+    const size_t index = find_index(table, name, length, hash_name64(name, length));
+    if (index == SWISS_NOT_FOUND) {
+        return NULL;
+    }
+    CPerson* const removed = table->slots[index].person;
+
+    /*
+     * If every 16-slot window containing this slot also contains an
+     * empty slot, no probe sequence ever continued past it and the slot can
+     * simply become empty again instead of leaving a tombstone behind.
+     */
+    const size_t mask = table->capacity - 1;
+    const BitMask empty_after = group_match_empty(table->ctrl + index);
+    const BitMask empty_before = group_match_empty(table->ctrl + ((index - SWISS_GROUP_WIDTH) & mask));
+    const bool was_never_full = empty_before != 0 && empty_after != 0
+        && trailing_zeros(empty_after) + leading_zeros16(empty_before) < SWISS_GROUP_WIDTH;
+
+    set_ctrl(table, index, was_never_full ? SWISS_EMPTY : SWISS_DELETED);
+    table->growth_left += was_never_full;
+    --table->size;
+    return removed;
+}
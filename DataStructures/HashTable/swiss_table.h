@@ -0,0 +1,84 @@
+/**
+ * @file swiss_table.h
+ * @author Xuhua Huang
+ * @brief Open addressing hash table with one control byte per slot,
+ * in the style of Abseil's SwissTable.
+ *
+ * Every slot owns one byte of metadata stored in a separate array:
+ *   - 0b1000'0000 (SWISS_EMPTY)   the slot has never been used,
+ *   - 0b1111'1110 (SWISS_DELETED) the slot held an element that was erased,
+ *   - 0b0xxx'xxxx                 the slot is full, low 7 bits of the hash.
+ * Probing loads 16 control bytes at once (SSE2 when available) and compares
+ * them against the 7-bit tag. Slots are `PersonSlot`s holding the full hash
+ * and short names inline, so a `CPerson*` is only dereferenced on a hit.
+ * A miss usually ends on the first group: one cache line.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "person.h"
+#include "person_slot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SWISS_GROUP_WIDTH 16
+#define SWISS_EMPTY ((int8_t)-128)
+#define SWISS_DELETED ((int8_t)-2)
+
+typedef struct SwissTable {
+    int8_t* ctrl;           /* capacity + SWISS_GROUP_WIDTH bytes; the tail mirrors the head */
+    PersonSlot* slots;      /* capacity slots, valid where ctrl is full */
+    size_t capacity;        /* power of two, at least SWISS_GROUP_WIDTH */
+    size_t size;            /* number of full slots */
+    size_t growth_left;     /* insertions into empty slots left before a rehash */
+} SwissTable;
+
+/**
+ * @brief Allocate a table able to hold at least `capacity` elements.
+ * @return bool -> false if the allocation failed
+ */
+bool swiss_table_init(SwissTable* table, size_t capacity);
+
+/**
+ * @brief Release the metadata and slot arrays; the records are not owned.
+ * @return void
+ */
+void swiss_table_free(SwissTable* table);
+
+/**
+ * @brief Insert a person keyed by name, growing the table when needed.
+ * @return bool -> false for NULL input, duplicate names or allocation failure
+ */
+bool swiss_table_insert(SwissTable* table, CPerson* person);
+
+/**
+ * @brief Look up a person by name.
+ * @return CPerson* -> NULL if the name is not in the table
+ */
+CPerson* swiss_table_lookup(const SwissTable* table, const char* name);
+
+/**
+ * @brief Remove a person by name. The slot only becomes a tombstone when
+ * the surrounding group has been full, otherwise it is marked empty again.
+ * @return CPerson* -> the removed record, NULL if the name was not found
+ */
+CPerson* swiss_table_erase(SwissTable* table, const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SWISS_TABLE_H */
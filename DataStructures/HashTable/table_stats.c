@@ -0,0 +1,88 @@
+/**
+ * @file table_stats.c
+ * @author Xuhua Huang
+ * @brief Storage, reading and JSON output of the hash table counters.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "table_stats.h"
+
+static const char* const kind_names[HASH_TABLE_KIND_COUNT] = { "swiss_table", "robin_hood" };
+
+static const char* const stat_names[HASH_TABLE_PROBE_HISTOGRAM] = {
+    "allocations", "bytes_allocated", "rehashes", "lookups", "probes", "displacements"
+};
+
+#ifdef HASH_TABLE_STATS
+_Atomic uint64_t hash_table_counters[HASH_TABLE_KIND_COUNT][HASH_TABLE_STAT_COUNT];
+#endif
+
+bool hash_table_stats_enabled(void) {
+#ifdef HASH_TABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void hash_table_stats_read(HashTableKind kind, HashTableStats* stats) {
+    if (stats == NULL) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+#ifdef HASH_TABLE_STATS
+    if ((unsigned)kind < HASH_TABLE_KIND_COUNT) {
+        for (int i = 0; i < HASH_TABLE_STAT_COUNT; ++i) {
+            stats->counts[i] = atomic_load_explicit(&hash_table_counters[kind][i], memory_order_relaxed);
+        }
+    }
+#else
+    (void)kind;
+#endif
+    return;
+}
+
+void hash_table_stats_reset(void) {
+#ifdef HASH_TABLE_STATS
+    for (int kind = 0; kind < HASH_TABLE_KIND_COUNT; ++kind) {
+        for (int i = 0; i < HASH_TABLE_STAT_COUNT; ++i) {
+            atomic_store_explicit(&hash_table_counters[kind][i], 0, memory_order_relaxed);
+        }
+    }
+#endif
+    return;
+}
+
+/**
+ * @brief {"enabled": true, "swiss_table": {"allocations": 2, ..., "probe_histogram": [...]}, ...}
+ * @return void
+ */
+void hash_table_stats_write_json(FILE* out) {
+    if (out == NULL) {
+        return;
+    }
+    fprintf(out, "{\n  \"enabled\": %s", hash_table_stats_enabled() ? "true" : "false");
+    for (int kind = 0; kind < HASH_TABLE_KIND_COUNT; ++kind) {
+        HashTableStats stats;
+        hash_table_stats_read((HashTableKind)kind, &stats);
+        fprintf(out, ",\n  \"%s\": {", kind_names[kind]);
+        for (int i = 0; i < HASH_TABLE_PROBE_HISTOGRAM; ++i) {
+            fprintf(out, "\"%s\": %" PRIu64 ", ", stat_names[i], stats.counts[i]);
+        }
+        fprintf(out, "\"probe_histogram\": [");
+        for (int i = 0; i < HASH_TABLE_PROBE_BUCKETS; ++i) {
+            fprintf(out, "%s%" PRIu64, i == 0 ? "" : ", ", stats.counts[HASH_TABLE_PROBE_HISTOGRAM + i]);
+        }
+        fprintf(out, "]}");
+    }
+    fprintf(out, "\n}\n");
+    return;
+}
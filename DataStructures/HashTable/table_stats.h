@@ -0,0 +1,115 @@
+/**
+ * @file table_stats.h
+ * @author Xuhua Huang
+ * @brief Opt-in counters of what the hash tables spend memory and time on.
+ *
+ * Compiled with HASH_TABLE_STATS defined, swiss_table and robin_hood count
+ * their allocations and bytes, rehashes, lookups and the length of every
+ * probe sequence, and robin_hood the residents that its insertion moves
+ * on or its erasure shifts back. Counters are process-wide relaxed
+ * atomics, so tables on different threads add up. Without
+ * HASH_TABLE_STATS the HASH_TABLE_COUNT calls expand to nothing and the
+ * tables are unchanged; reading then returns zeros and the JSON says
+ * "enabled": false.
+ *
+ * A probe length is the number of slots compared for robin_hood and the
+ * number of 16-slot groups loaded for swiss_table, counted for every
+ * lookup, insertion and erasure, and summarized in a histogram of powers
+ * of two: bucket i holds the probes of length in [2^i, 2^(i+1)).
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#ifndef TABLE_STATS_H
+#define TABLE_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum HashTableKind {
+    HASH_TABLE_SWISS,
+    HASH_TABLE_ROBIN_HOOD,
+    HASH_TABLE_KIND_COUNT
+} HashTableKind;
+
+#define HASH_TABLE_PROBE_BUCKETS 8
+
+typedef enum HashTableStat {
+    HASH_TABLE_ALLOCATIONS,         /* blocks allocated, metadata and slots separately */
+    HASH_TABLE_BYTES_ALLOCATED,
+    HASH_TABLE_REHASHES,            /* tables rebuilt, to grow or to drop tombstones */
+    HASH_TABLE_LOOKUPS,             /* probe sequences walked */
+    HASH_TABLE_PROBES,              /* slots or groups visited by all of them */
+    HASH_TABLE_DISPLACEMENTS,       /* residents moved on by insertion or shifted back by erasure */
+    HASH_TABLE_PROBE_HISTOGRAM,     /* first of HASH_TABLE_PROBE_BUCKETS buckets */
+    HASH_TABLE_STAT_COUNT = HASH_TABLE_PROBE_HISTOGRAM + HASH_TABLE_PROBE_BUCKETS
+} HashTableStat;
+
+typedef struct HashTableStats {
+    uint64_t counts[HASH_TABLE_STAT_COUNT];
+} HashTableStats;
+
+/**
+ * @brief Whether the tables were compiled with HASH_TABLE_STATS.
+ * @return bool
+ */
+bool hash_table_stats_enabled(void);
+
+/**
+ * @brief Copy the counters of one kind of table.
+ * @return void
+ */
+void hash_table_stats_read(HashTableKind kind, HashTableStats* stats);
+
+/**
+ * @brief Set every counter back to zero.
+ * @return void
+ */
+void hash_table_stats_reset(void);
+
+/**
+ * @brief Write the counters of every kind of table as one JSON object.
+ * @return void
+ */
+void hash_table_stats_write_json(FILE* out);
+
+#if defined(HASH_TABLE_STATS) && !defined(__cplusplus)
+#include <stdatomic.h>
+
+extern _Atomic uint64_t hash_table_counters[HASH_TABLE_KIND_COUNT][HASH_TABLE_STAT_COUNT];
+
+#define HASH_TABLE_COUNT(kind, stat, n) \
+    atomic_fetch_add_explicit(&hash_table_counters[kind][stat], (uint64_t)(n), memory_order_relaxed)
+
+/* one probe sequence of `length` slots or groups, into the sum and the histogram */
+#define HASH_TABLE_COUNT_PROBE(kind, length) hash_table_count_probe(kind, (uint64_t)(length))
+
+static inline void hash_table_count_probe(const HashTableKind kind, const uint64_t length) {
+    unsigned bucket = 0;
+    while (bucket + 1 < HASH_TABLE_PROBE_BUCKETS && (length >> (bucket + 1)) != 0) {
+        ++bucket;
+    }
+    HASH_TABLE_COUNT(kind, HASH_TABLE_LOOKUPS, 1);
+    HASH_TABLE_COUNT(kind, HASH_TABLE_PROBES, length);
+    HASH_TABLE_COUNT(kind, HASH_TABLE_PROBE_HISTOGRAM + bucket, 1);
+    return;
+}
+#else
+#define HASH_TABLE_COUNT(kind, stat, n) ((void)0)
+#define HASH_TABLE_COUNT_PROBE(kind, length) ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TABLE_STATS_H */
@@ -4,6 +4,11 @@
 
 #include <stdio.h>
 
+/* printf_s is only provided by the MSVC runtime */
+#if !defined(_MSC_VER) && !defined(printf_s)
+#define printf_s printf
+#endif
+
 #define LISTSIZE 100
 
 typedef struct
@@ -6,6 +6,10 @@
  * \date   September 2021
  *********************************************************************/
 
+#pragma once
+#ifndef LINKLIST_H
+#define LINKLIST_H
+
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -69,6 +73,7 @@ ListNode* LocElement(const LinkList& head, int e) {
         else
             return p;
     }
+    return nullptr;
 }
 
 /* Function to locate the element by content */
@@ -87,8 +92,7 @@ int GetElementPos(LinkList head, int e) {
             index++;
         }
     }
-    if (!p)
-        return 0;
+    return 0;
 }
 
 /* Function to insert an element to the list. */
@@ -180,4 +184,7 @@ void DestroyLinkList(LinkList head) {
         p = p->next;
         free(q);
     }
+    free(p);
 }
+
+#endif
@@ -0,0 +1,849 @@
+/*****************************************************************//**
+ * \file   bplus_tree.hpp
+ * \brief  In-memory B+-tree ordered map with nodes sized to cache lines.
+ *
+ * Every node occupies about NodeBytes bytes, eight 64-byte cache lines by
+ * default or a 4096-byte page when NodeBytes is set so: how many keys a
+ * node holds is computed at compile time from the sizes of the key, the
+ * value and a child pointer. Inner nodes hold only separator keys and
+ * children, so one node read narrows a search by its whole fanout; for
+ * 8-byte keys and values the default gives 30 elements per leaf and 32
+ * children per inner node, and 50 million elements bulk-loaded are found
+ * in six node reads. Leaves keep their keys apart from their values, so a
+ * search compares keys packed next to each other, and are linked in key
+ * order, so a range scan reads leaf after leaf without climbing back up.
+ *
+ * Nodes stay at least half full: a full node splits into two, and a node
+ * that falls below half borrows from a sibling or merges with it. Sorted
+ * input is best loaded with bulk_load, which builds the tree bottom-up in
+ * O(n) with every node filled. Iterators are invalidated by every insert
+ * and erase.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef BPLUS_TREE_HPP
+#define BPLUS_TREE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace util::data_structure {
+
+template<typename _Key, typename _Value, typename _Compare = std::less<_Key>, std::size_t _NodeBytes = 512>
+requires (_NodeBytes >= 64)
+class bplus_tree_map {
+public:
+    using key_type = _Key;
+    using mapped_type = _Value;
+    using value_type = std::pair<_Key, _Value>;
+    using key_compare = _Compare;
+    using size_type = std::size_t;
+
+    static_assert(std::is_nothrow_move_constructible_v<_Key> && std::is_nothrow_move_assignable_v<_Key>,
+                  "keys are shifted inside nodes and must move without throwing");
+    static_assert(std::is_nothrow_move_constructible_v<_Value> && std::is_nothrow_move_assignable_v<_Value>,
+                  "values are shifted inside nodes and must move without throwing");
+
+    /* keys and values per leaf, and separator keys per inner node; at least 3 each */
+    static constexpr size_type leaf_capacity =
+        std::max<size_type>(3, (_NodeBytes - sizeof(size_type) - 2 * sizeof(void*)) / (sizeof(_Key) + sizeof(_Value)));
+    static constexpr size_type inner_capacity =
+        std::max<size_type>(3, (_NodeBytes - sizeof(size_type) - sizeof(void*)) / (sizeof(_Key) + sizeof(void*)));
+
+private:
+    /* nodes start on a cache line, so a node of n lines is read with n misses */
+    struct alignas(64) node {
+        size_type count = 0;
+    };
+
+    /* count keys and values, the unions leave the slots unconstructed until they are filled */
+    struct leaf_node : node {
+        leaf_node* prev = nullptr;
+        leaf_node* next = nullptr;
+        union { _Key keys[leaf_capacity]; };
+        union { _Value values[leaf_capacity]; };
+        leaf_node() {}
+        ~leaf_node() {}
+    };
+
+    /* count separator keys and count + 1 children: child i holds the keys in [keys[i - 1], keys[i]) */
+    struct inner_node : node {
+        union { _Key keys[inner_capacity]; };
+        node* children[inner_capacity + 1];
+        inner_node() {}
+        ~inner_node() {}
+    };
+
+    /* the inner nodes from the root down to a leaf and the child taken in each */
+    static constexpr size_type max_height = 64;
+    struct path_type {
+        std::array<inner_node*, max_height> nodes;
+        std::array<size_type, max_height> indices;
+    };
+
+public:
+    template<bool _Const>
+    class basic_iterator {
+    public:
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::pair<_Key, _Value>;
+        using difference_type = std::ptrdiff_t;
+        /* keys and values live in separate arrays, so elements are referred to by a pair of references */
+        using reference = std::pair<const _Key&, std::conditional_t<_Const, const _Value&, _Value&>>;
+
+        struct pointer {
+            reference ref;
+            const reference* operator -> () const { return &ref; }
+        };
+
+        basic_iterator() = default;
+
+        /* iterator converts to const_iterator */
+        template<bool _OtherConst>
+        requires (_Const && !_OtherConst)
+        basic_iterator(const basic_iterator<_OtherConst>& other) : leaf(other.leaf), index(other.index) {}
+
+        reference operator * () const { return { leaf->keys[index], leaf->values[index] }; }
+        pointer operator -> () const { return pointer{ **this }; }
+
+        /* past the last element of a leaf continue with the first of the next one */
+        basic_iterator& operator ++ () {
+            if (++index == leaf->count && leaf->next != nullptr) {
+                leaf = leaf->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        basic_iterator operator ++ (int) {
+            basic_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        basic_iterator& operator -- () {
+            if (index == 0) {
+                leaf = leaf->prev;
+                index = leaf->count;
+            }
+            --index;
+            return *this;
+        }
+
+        basic_iterator operator -- (int) {
+            basic_iterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator == (const basic_iterator&, const basic_iterator&) = default;
+
+    private:
+        friend class bplus_tree_map;
+        template<bool> friend class basic_iterator;
+
+        using leaf_pointer = std::conditional_t<_Const, const leaf_node*, leaf_node*>;
+
+        basic_iterator(const leaf_pointer l, const size_type i) : leaf(l), index(i) {}
+
+        /* end() is one past the last element of the last leaf, or null in an empty tree */
+        leaf_pointer leaf = nullptr;
+        size_type index = 0;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* default constructor */
+    bplus_tree_map() = default;
+
+    explicit bplus_tree_map(const _Compare& compare) : comp(compare) {}
+
+    /* copies are rebuilt bottom-up from the sorted elements of other */
+    bplus_tree_map(const bplus_tree_map& other) : comp(other.comp) {
+        bulk_load(other.begin(), other.end());
+    }
+
+    bplus_tree_map& operator = (const bplus_tree_map& other) {
+        if (this != &other) {
+            bplus_tree_map copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /* the moved-from tree is left empty */
+    bplus_tree_map(bplus_tree_map&& other) noexcept
+        : root(std::exchange(other.root, nullptr))
+        , first(std::exchange(other.first, nullptr))
+        , last(std::exchange(other.last, nullptr))
+        , levels(std::exchange(other.levels, 0))
+        , count(std::exchange(other.count, 0))
+        , comp(other.comp) {}
+
+    bplus_tree_map& operator = (bplus_tree_map&& other) noexcept {
+        if (this != &other) {
+            bplus_tree_map moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~bplus_tree_map() { clear(); }
+
+    /* iterators */
+    iterator begin() { return iterator(first, 0); }
+    iterator end() { return last == nullptr ? iterator() : iterator(last, last->count); }
+    const_iterator begin() const { return const_iterator(first, 0); }
+    const_iterator end() const { return last == nullptr ? const_iterator() : const_iterator(last, last->count); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return count == 0; }
+    size_type size() const { return count; }
+
+    /* number of inner levels above the leaves, 0 while the root is a leaf */
+    size_type height() const { return levels; }
+
+    /* lookup */
+    iterator find(const _Key& key) { return unconst(find_const(key)); }
+    const_iterator find(const _Key& key) const { return find_const(key); }
+
+    bool contains(const _Key& key) const { return find_const(key) != end(); }
+
+    /* the value of key, throws std::out_of_range if it is not in the map */
+    _Value& at(const _Key& key) { return const_cast<_Value&>(std::as_const(*this).at(key)); }
+
+    const _Value& at(const _Key& key) const {
+        const const_iterator it = find_const(key);
+        if (it == end()) {
+            throw std::out_of_range("key is not in the map");
+        }
+        return it.leaf->values[it.index];
+    }
+
+    /* the first element whose key is not less than key */
+    iterator lower_bound(const _Key& key) { return unconst(bound_const(key, false)); }
+    const_iterator lower_bound(const _Key& key) const { return bound_const(key, false); }
+
+    /* the first element whose key is greater than key */
+    iterator upper_bound(const _Key& key) { return unconst(bound_const(key, true)); }
+    const_iterator upper_bound(const _Key& key) const { return bound_const(key, true); }
+
+    /* modifiers */
+    _Value& operator [] (const _Key& key) { return try_emplace(key).first->second; }
+
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(value.first, std::move(value.second)); }
+
+    template<typename _Arg>
+    std::pair<iterator, bool> insert_or_assign(const _Key& key, _Arg&& value) {
+        const std::pair<iterator, bool> result = try_emplace(key, std::forward<_Arg>(value));
+        if (!result.second) {
+            result.first.leaf->values[result.first.index] = std::forward<_Arg>(value);
+        }
+        return result;
+    }
+
+    /*
+     * Insert key with a value constructed from args unless key is already in
+     * the map, in which case nothing is constructed. A full leaf splits in
+     * two and the separator moves up, splitting full inner nodes on the way;
+     * all nodes needed are allocated before the tree is changed.
+     */
+    template<typename... _Args>
+    std::pair<iterator, bool> try_emplace(const _Key& key, _Args&&... args) {
+        path_type path;
+        leaf_node* leaf = nullptr;
+        size_type position = 0;
+        if (root != nullptr) {
+            leaf = descend(key, path);
+            position = key_lower_bound(leaf->keys, leaf->count, key);
+            if (position < leaf->count && !comp(key, leaf->keys[position])) {
+                return { iterator(leaf, position), false };
+            }
+        }
+
+        /* whatever may throw happens before the tree changes */
+        _Key new_key(key);
+        _Value new_value(std::forward<_Args>(args)...);
+        if (root == nullptr) {
+            leaf = new leaf_node;
+            root = first = last = leaf;
+        }
+        else if (leaf->count == leaf_capacity) {
+            /* whichever half the new key joins, the right half starts with the key at mid */
+            constexpr size_type mid = leaf_capacity / 2;
+            _Key separator(leaf->keys[mid]);
+            spare_nodes spare(*this, path);
+            leaf_node* const right = spare.take_leaf();
+            split_leaf(leaf, right, mid);
+            insert_separator(path, std::move(separator), right, spare);
+            if (position > mid) {
+                leaf = right;
+                position -= mid;
+            }
+        }
+        insert_at(leaf->keys, leaf->count, position, std::move(new_key));
+        insert_at(leaf->values, leaf->count, position, std::move(new_value));
+        ++leaf->count;
+        ++count;
+        return { iterator(leaf, position), true };
+    }
+
+    /*
+     * Remove key, returning 1, or 0 if it is not in the map. A leaf that
+     * falls below half full borrows a neighbour's element or merges with it,
+     * and the parent repairs itself the same way up to the root.
+     */
+    size_type erase(const _Key& key) {
+        if (root == nullptr) {
+            return 0;
+        }
+        path_type path;
+        leaf_node* const leaf = descend(key, path);
+        const size_type position = key_lower_bound(leaf->keys, leaf->count, key);
+        if (position == leaf->count || comp(key, leaf->keys[position])) {
+            return 0;
+        }
+        if (levels > 0 && leaf->count == min_leaf) {
+            erase_and_rebalance(path, leaf, position);
+        }
+        else {
+            remove_from_leaf(leaf, position);
+            if (leaf->count == 0) {
+                destroy_leaf(leaf);
+                root = first = last = nullptr;
+            }
+        }
+        --count;
+        return 1;
+    }
+
+    /* remove the element at it, returning an iterator to the element after it */
+    iterator erase(const const_iterator it) {
+        const _Key key(it.leaf->keys[it.index]);
+        erase(key);
+        return lower_bound(key);
+    }
+
+    /*
+     * Replace the contents with the elements of [first_it, last_it), pairs
+     * that must be sorted by key without duplicates; throws
+     * std::invalid_argument otherwise, leaving the map unchanged. The range
+     * is read twice, to check it and count it, then to fill leaves and inner
+     * nodes level by level with the elements spread evenly, in O(n).
+     *
+     * Only a sentinel is required of the iterators, so that iterators whose
+     * reference is a pair of references, as this map's own are, qualify on
+     * standard libraries without the C++23 common_reference for std::pair.
+     */
+    template<typename _ForwardIt, std::sentinel_for<_ForwardIt> _Sentinel>
+    void bulk_load(_ForwardIt first_it, _Sentinel last_it) {
+        size_type n = 0;
+        for (_ForwardIt it = first_it, previous = first_it; it != last_it; previous = it, ++it, ++n) {
+            if (n > 0 && !comp((*previous).first, (*it).first)) {
+                throw std::invalid_argument("bulk_load input is not sorted by unique keys");
+            }
+        }
+        bplus_tree_map loaded(comp);
+        loaded.build(first_it, n);
+        swap(loaded);
+        return;
+    }
+
+    template<std::ranges::range _Range>
+    void bulk_load(_Range&& range) {
+        bulk_load(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    /* release every node, inner levels before the leaves they lead to */
+    void clear() {
+        if (root != nullptr) {
+            release(root, levels);
+        }
+        root = first = last = nullptr;
+        levels = 0;
+        count = 0;
+        return;
+    }
+
+    void swap(bplus_tree_map& other) noexcept {
+        std::swap(root, other.root);
+        std::swap(first, other.first);
+        std::swap(last, other.last);
+        std::swap(levels, other.levels);
+        std::swap(count, other.count);
+        std::swap(comp, other.comp);
+        return;
+    }
+
+    friend void swap(bplus_tree_map& lhs, bplus_tree_map& rhs) noexcept { lhs.swap(rhs); }
+
+private:
+    /* below these counts a non-root node borrows from or merges with a sibling */
+    static constexpr size_type min_leaf = leaf_capacity / 2;
+    static constexpr size_type min_inner = (inner_capacity - 1) / 2;
+
+    node* root = nullptr;
+    leaf_node* first = nullptr;
+    leaf_node* last = nullptr;
+    size_type levels = 0;
+    size_type count = 0;
+    [[no_unique_address]] _Compare comp;
+
+    /* ------------------------------ node arrays ------------------------------ */
+
+    iterator unconst(const const_iterator it) {
+        return iterator(const_cast<leaf_node*>(it.leaf), it.index);
+    }
+
+    size_type key_lower_bound(const _Key* keys, const size_type n, const _Key& key) const {
+        return static_cast<size_type>(std::lower_bound(keys, keys + n, key, comp) - keys);
+    }
+
+    size_type key_upper_bound(const _Key* keys, const size_type n, const _Key& key) const {
+        return static_cast<size_type>(std::upper_bound(keys, keys + n, key, comp) - keys);
+    }
+
+    /* insert into an array of n constructed slots, constructing slot n */
+    template<typename _Elem, typename _Arg>
+    static void insert_at(_Elem* items, const size_type n, const size_type position, _Arg&& value) {
+        if (position == n) {
+            std::construct_at(items + n, std::forward<_Arg>(value));
+            return;
+        }
+        std::construct_at(items + n, std::move(items[n - 1]));
+        std::move_backward(items + position, items + n - 1, items + n);
+        items[position] = std::forward<_Arg>(value);
+        return;
+    }
+
+    /* remove from an array of n constructed slots, destroying slot n - 1 */
+    template<typename _Elem>
+    static void erase_at(_Elem* items, const size_type n, const size_type position) {
+        std::move(items + position + 1, items + n, items + position);
+        std::destroy_at(items + n - 1);
+        return;
+    }
+
+    /* move n constructed slots into unconstructed ones and destroy the sources */
+    template<typename _Elem>
+    static void relocate(_Elem* from, const size_type n, _Elem* to) {
+        std::uninitialized_move_n(from, n, to);
+        std::destroy_n(from, n);
+        return;
+    }
+
+    static void destroy_leaf(leaf_node* const leaf) {
+        std::destroy_n(leaf->keys, leaf->count);
+        std::destroy_n(leaf->values, leaf->count);
+        delete leaf;
+        return;
+    }
+
+    static void destroy_inner(inner_node* const inner) {
+        std::destroy_n(inner->keys, inner->count);
+        delete inner;
+        return;
+    }
+
+    static void release(node* const n, const size_type level) {
+        if (level == 0) {
+            destroy_leaf(static_cast<leaf_node*>(n));
+            return;
+        }
+        inner_node* const inner = static_cast<inner_node*>(n);
+        for (size_type i = 0; i <= inner->count; ++i) {
+            release(inner->children[i], level - 1);
+        }
+        destroy_inner(inner);
+        return;
+    }
+
+    /* -------------------------------- lookup --------------------------------- */
+
+    /* the leaf key belongs in, recording the inner nodes passed */
+    leaf_node* descend(const _Key& key, path_type& path) const {
+        node* n = root;
+        for (size_type depth = 0; depth < levels; ++depth) {
+            inner_node* const inner = static_cast<inner_node*>(n);
+            const size_type child = key_upper_bound(inner->keys, inner->count, key);
+            path.nodes[depth] = inner;
+            path.indices[depth] = child;
+            n = inner->children[child];
+        }
+        return static_cast<leaf_node*>(n);
+    }
+
+    const leaf_node* descend(const _Key& key) const {
+        const node* n = root;
+        for (size_type depth = 0; depth < levels; ++depth) {
+            const inner_node* const inner = static_cast<const inner_node*>(n);
+            n = inner->children[key_upper_bound(inner->keys, inner->count, key)];
+        }
+        return static_cast<const leaf_node*>(n);
+    }
+
+    const_iterator find_const(const _Key& key) const {
+        if (root == nullptr) {
+            return end();
+        }
+        const leaf_node* const leaf = descend(key);
+        const size_type position = key_lower_bound(leaf->keys, leaf->count, key);
+        if (position == leaf->count || comp(key, leaf->keys[position])) {
+            return end();
+        }
+        return const_iterator(leaf, position);
+    }
+
+    /* a bound past the keys of its leaf is the first element of the next leaf */
+    const_iterator bound_const(const _Key& key, const bool upper) const {
+        if (root == nullptr) {
+            return end();
+        }
+        const leaf_node* const leaf = descend(key);
+        const size_type position = upper ? key_upper_bound(leaf->keys, leaf->count, key)
+                                         : key_lower_bound(leaf->keys, leaf->count, key);
+        if (position == leaf->count && leaf->next != nullptr) {
+            return const_iterator(leaf->next, 0);
+        }
+        return const_iterator(leaf, position);
+    }
+
+    /* ------------------------------- insertion ------------------------------- */
+
+    /* the nodes one insertion may need: a leaf, one inner node per full level and a new root */
+    class spare_nodes {
+    public:
+        spare_nodes(const bplus_tree_map& tree, const path_type& path) {
+            size_type needed = 0;
+            while (needed < tree.levels && path.nodes[tree.levels - 1 - needed]->count == inner_capacity) {
+                ++needed;
+            }
+            if (needed == tree.levels) {
+                ++needed;
+            }
+            leaf = std::make_unique<leaf_node>();
+            for (size_type i = 0; i < needed; ++i) {
+                inners[i] = std::make_unique<inner_node>();
+            }
+        }
+
+        leaf_node* take_leaf() { return leaf.release(); }
+        inner_node* take_inner() { return inners[taken++].release(); }
+
+    private:
+        std::unique_ptr<leaf_node> leaf;
+        std::array<std::unique_ptr<inner_node>, max_height + 1> inners;
+        size_type taken = 0;
+    };
+
+    /* move the keys from mid on into the empty leaf right and link it after leaf */
+    void split_leaf(leaf_node* const leaf, leaf_node* const right, const size_type mid) {
+        relocate(leaf->keys + mid, leaf->count - mid, right->keys);
+        relocate(leaf->values + mid, leaf->count - mid, right->values);
+        right->count = leaf->count - mid;
+        leaf->count = mid;
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next != nullptr) {
+            leaf->next->prev = right;
+        }
+        else {
+            last = right;
+        }
+        leaf->next = right;
+        return;
+    }
+
+    /* insert separator and the new node to its right into the parents, splitting the full ones */
+    void insert_separator(path_type& path, _Key separator, node* right, spare_nodes& spare) {
+        for (size_type depth = levels; depth-- > 0;) {
+            inner_node* const parent = path.nodes[depth];
+            const size_type position = path.indices[depth];
+            if (parent->count < inner_capacity) {
+                insert_at(parent->keys, parent->count, position, std::move(separator));
+                insert_at(parent->children, parent->count + 1, position + 1, right);
+                ++parent->count;
+                return;
+            }
+
+            /* keys [0, mid) stay, key mid moves up, keys (mid, capacity) move to sibling */
+            constexpr size_type mid = inner_capacity / 2;
+            inner_node* const sibling = spare.take_inner();
+            relocate(parent->keys + mid + 1, inner_capacity - mid - 1, sibling->keys);
+            std::copy_n(parent->children + mid + 1, inner_capacity - mid, sibling->children);
+            sibling->count = inner_capacity - mid - 1;
+            _Key up(std::move(parent->keys[mid]));
+            std::destroy_at(parent->keys + mid);
+            parent->count = mid;
+
+            inner_node* const target = position <= mid ? parent : sibling;
+            const size_type at = position <= mid ? position : position - mid - 1;
+            insert_at(target->keys, target->count, at, std::move(separator));
+            insert_at(target->children, target->count + 1, at + 1, right);
+            ++target->count;
+
+            separator = std::move(up);
+            right = sibling;
+        }
+
+        /* the root split: the tree grows by one level */
+        inner_node* const new_root = spare.take_inner();
+        std::construct_at(new_root->keys, std::move(separator));
+        new_root->children[0] = root;
+        new_root->children[1] = right;
+        new_root->count = 1;
+        root = new_root;
+        ++levels;
+        return;
+    }
+
+    /* -------------------------------- erasure -------------------------------- */
+
+    /* remove separator position and the child to its right from an inner node */
+    static void remove_separator(inner_node* const inner, const size_type position) {
+        erase_at(inner->keys, inner->count, position);
+        erase_at(inner->children, inner->count + 1, position + 1);
+        --inner->count;
+        return;
+    }
+
+    static void remove_from_leaf(leaf_node* const leaf, const size_type position) {
+        erase_at(leaf->keys, leaf->count, position);
+        erase_at(leaf->values, leaf->count, position);
+        --leaf->count;
+        return;
+    }
+
+    /* remove an element from a leaf that would fall below half full, then borrow or merge */
+    void erase_and_rebalance(path_type& path, leaf_node* const leaf, const size_type position) {
+        inner_node* const parent = path.nodes[levels - 1];
+        const size_type index = path.indices[levels - 1];
+        leaf_node* const left = index > 0 ? static_cast<leaf_node*>(parent->children[index - 1]) : nullptr;
+        leaf_node* const right = index < parent->count ? static_cast<leaf_node*>(parent->children[index + 1]) : nullptr;
+
+        /* a new separator is copied before the element is removed, so a throwing copy changes nothing */
+        if (left != nullptr && left->count > min_leaf) {
+            _Key separator(left->keys[left->count - 1]);
+            remove_from_leaf(leaf, position);
+            insert_at(leaf->keys, leaf->count, 0, std::move(left->keys[left->count - 1]));
+            insert_at(leaf->values, leaf->count, 0, std::move(left->values[left->count - 1]));
+            std::destroy_at(left->keys + left->count - 1);
+            std::destroy_at(left->values + left->count - 1);
+            --left->count;
+            ++leaf->count;
+            parent->keys[index - 1] = std::move(separator);
+            return;
+        }
+        if (right != nullptr && right->count > min_leaf) {
+            _Key separator(right->keys[1]);
+            remove_from_leaf(leaf, position);
+            std::construct_at(leaf->keys + leaf->count, std::move(right->keys[0]));
+            std::construct_at(leaf->values + leaf->count, std::move(right->values[0]));
+            erase_at(right->keys, right->count, 0);
+            erase_at(right->values, right->count, 0);
+            --right->count;
+            ++leaf->count;
+            parent->keys[index] = std::move(separator);
+            return;
+        }
+
+        /* neither sibling can spare an element: merge the right one of the pair into the left */
+        remove_from_leaf(leaf, position);
+        leaf_node* const into = left != nullptr ? left : leaf;
+        leaf_node* const from = left != nullptr ? leaf : right;
+        relocate(from->keys, from->count, into->keys + into->count);
+        relocate(from->values, from->count, into->values + into->count);
+        into->count += from->count;
+        from->count = 0;
+        into->next = from->next;
+        if (from->next != nullptr) {
+            from->next->prev = into;
+        }
+        else {
+            last = into;
+        }
+        delete from;
+        remove_separator(parent, left != nullptr ? index - 1 : index);
+        repair(path, levels - 1);
+        return;
+    }
+
+    /* the inner node at depth lost a separator: fix it and every ancestor that underflows */
+    void repair(path_type& path, size_type depth) {
+        for (;;) {
+            inner_node* const n = path.nodes[depth];
+            if (depth == 0) {
+                if (n->count == 0) {
+                    /* a root left with one child hands the tree to it */
+                    root = n->children[0];
+                    --levels;
+                    destroy_inner(n);
+                }
+                return;
+            }
+            if (n->count >= min_inner) {
+                return;
+            }
+
+            inner_node* const parent = path.nodes[depth - 1];
+            const size_type index = path.indices[depth - 1];
+            inner_node* const left = index > 0 ? static_cast<inner_node*>(parent->children[index - 1]) : nullptr;
+            inner_node* const right = index < parent->count ? static_cast<inner_node*>(parent->children[index + 1]) : nullptr;
+
+            if (left != nullptr && left->count > min_inner) {
+                /* rotate right: the separator comes down, the left sibling's last key goes up */
+                insert_at(n->keys, n->count, 0, std::move(parent->keys[index - 1]));
+                insert_at(n->children, n->count + 1, 0, left->children[left->count]);
+                ++n->count;
+                parent->keys[index - 1] = std::move(left->keys[left->count - 1]);
+                std::destroy_at(left->keys + left->count - 1);
+                --left->count;
+                return;
+            }
+            if (right != nullptr && right->count > min_inner) {
+                /* rotate left: the separator comes down, the right sibling's first key goes up */
+                std::construct_at(n->keys + n->count, std::move(parent->keys[index]));
+                n->children[n->count + 1] = right->children[0];
+                ++n->count;
+                parent->keys[index] = std::move(right->keys[0]);
+                erase_at(right->keys, right->count, 0);
+                erase_at(right->children, right->count + 1, 0);
+                --right->count;
+                return;
+            }
+
+            /* merge the right node of the pair into the left, pulling their separator down between */
+            inner_node* const into = left != nullptr ? left : n;
+            inner_node* const from = left != nullptr ? n : right;
+            const size_type separator = left != nullptr ? index - 1 : index;
+            std::construct_at(into->keys + into->count, std::move(parent->keys[separator]));
+            relocate(from->keys, from->count, into->keys + into->count + 1);
+            std::copy_n(from->children, from->count + 1, into->children + into->count + 1);
+            into->count += from->count + 1;
+            from->count = 0;
+            delete from;
+            remove_separator(parent, separator);
+            --depth;
+        }
+    }
+
+    /* ------------------------------- bulk load ------------------------------- */
+
+    /* build this empty tree from n sorted elements, releasing every node built if a copy throws */
+    template<typename _ForwardIt>
+    void build(_ForwardIt it, const size_type n) {
+        if (n == 0) {
+            return;
+        }
+        /*
+         * Every level is built in a buffer of one pointer per leaf. A node
+         * leaves the buffer of its level once its parent adopts it, so on an
+         * exception each pointer still in a buffer roots a subtree of its own.
+         */
+        const size_type leaves = (n + leaf_capacity - 1) / leaf_capacity;
+        std::unique_ptr<node*[]> level(new node*[leaves]());
+        std::unique_ptr<node*[]> above(new node*[leaves]());
+
+        try {
+            for (size_type i = 0; i < leaves; ++i) {
+                leaf_node* const leaf = new leaf_node;
+                leaf->prev = last;
+                (last != nullptr ? last->next : first) = leaf;
+                last = leaf;
+                level[i] = leaf;
+                const size_type fill = n / leaves + (i < n % leaves ? 1 : 0);
+                for (; leaf->count < fill; ++it) {
+                    auto&& [key, value] = *it;
+                    std::construct_at(leaf->keys + leaf->count, key);
+                    try {
+                        std::construct_at(leaf->values + leaf->count, value);
+                    }
+                    catch (...) {
+                        std::destroy_at(leaf->keys + leaf->count);
+                        throw;
+                    }
+                    ++leaf->count;
+                }
+            }
+            count = n;
+
+            for (size_type width = leaves; width > 1; ++levels) {
+                const size_type parents = (width + inner_capacity) / (inner_capacity + 1);
+                size_type child = 0;
+                for (size_type i = 0; i < parents; ++i) {
+                    const size_type fill = width / parents + (i < width % parents ? 1 : 0);
+                    inner_node* const inner = new inner_node;
+                    above[i] = inner;
+                    inner->children[0] = std::exchange(level[child++], nullptr);
+                    while (inner->count + 1 < fill) {
+                        std::construct_at(inner->keys + inner->count, smallest_key(level[child], levels));
+                        inner->children[++inner->count] = std::exchange(level[child++], nullptr);
+                    }
+                }
+                std::swap(level, above);
+                width = parents;
+            }
+            root = level[0];
+        }
+        catch (...) {
+            for (size_type i = 0; i < leaves; ++i) {
+                if (levels > 0 && level[i] != nullptr) {
+                    release_inner_levels(level[i], levels);
+                }
+                if (above[i] != nullptr) {
+                    release_inner_levels(above[i], levels + 1);
+                }
+            }
+            for (leaf_node* leaf = first; leaf != nullptr;) {
+                leaf_node* const next = leaf->next;
+                destroy_leaf(leaf);
+                leaf = next;
+            }
+            root = first = last = nullptr;
+            levels = 0;
+            count = 0;
+            throw;
+        }
+        return;
+    }
+
+    /* the first key in the subtree of n, whose leaves are level levels below it */
+    static const _Key& smallest_key(const node* n, size_type level) {
+        for (; level > 0; --level) {
+            n = static_cast<const inner_node*>(n)->children[0];
+        }
+        return static_cast<const leaf_node*>(n)->keys[0];
+    }
+
+    /* release the inner nodes of a subtree, leaving its leaves to the leaf list */
+    static void release_inner_levels(node* const n, const size_type level) {
+        if (level == 0) {
+            return;
+        }
+        inner_node* const inner = static_cast<inner_node*>(n);
+        for (size_type i = 0; i <= inner->count; ++i) {
+            release_inner_levels(inner->children[i], level - 1);
+        }
+        destroy_inner(inner);
+        return;
+    }
+};
+
+} // namespace util::data_structure
+
+#endif // BPLUS_TREE_HPP
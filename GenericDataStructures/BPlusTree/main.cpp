@@ -0,0 +1,63 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  B+-tree ordered map test cases.
+ *
+ * An index of order ids bulk-loaded from sorted input, then updated,
+ * queried for one id and scanned over a range through the linked leaves.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <cstdint>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <bplus_tree.hpp>
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+    using index_type = bplus_tree_map<std::uint64_t, std::uint64_t>;
+
+    std::cout << "\033[32mNode capacities for 8-byte keys and values \033[m" << "\n";
+    std::cout << "elements per leaf: " << index_type::leaf_capacity << "\n";
+    std::cout << "separators per inner node: " << index_type::inner_capacity << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing bulk_load() from sorted input          */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mBulk-loading 100000 orders, ids 0, 10, 20, ... \033[m" << "\n";
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> orders;
+    for (std::uint64_t id = 0; id < 100000; ++id) {
+        orders.emplace_back(id * 10, id % 97);
+    }
+    index_type index;
+    index.bulk_load(orders);
+    std::cout << "size: " << index.size() << ", height: " << index.height() << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing insertion, lookup and erasure          */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mUpdating single orders \033[m" << "\n";
+    index[55] = 1;
+    index.insert_or_assign(60, 2);
+    index.erase(70);
+    std::cout << "contains 55: " << std::boolalpha << index.contains(55) << "\n";
+    std::cout << "at(60): " << index.at(60) << "\n";
+    std::cout << "contains 70: " << index.contains(70) << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing a range scan with lower/upper_bound    */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mOrders with ids in [45, 100] \033[m" << "\n";
+    const auto stop = index.upper_bound(100);
+    for (auto it = index.lower_bound(45); it != stop; ++it) {
+        std::cout << it->first << " -> " << it->second << "\n";
+    }
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
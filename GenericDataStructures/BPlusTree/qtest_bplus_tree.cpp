@@ -0,0 +1,270 @@
+/*****************************************************************//**
+ * \file   qtest_bplus_tree.cpp
+ * \brief  bplus_tree_map<> test cases with QTest framework.
+ *
+ * The map is checked against std::map on random inserts and erases, with
+ * nodes of the minimum capacity so that splits, borrows and merges happen
+ * on almost every operation, and with the default node size.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include <bplus_tree.hpp>
+
+class TestBPlusTree : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    void capacitiesFollowNodeBytes() const;
+    void matchesStdMap() const;
+    void boundsAndIteration() const;
+    void bulkLoad() const;
+    void copyAndMove() const;
+    void missingKeyThrows() const;
+
+private:
+    /* random inserts and erases, comparing contents and bounds with std::map */
+    template<typename Map>
+    static bool matchesStdMap(unsigned seed, int key_range);
+
+    template<typename Map>
+    static bool sameElements(const Map& map, const std::map<typename Map::key_type, int>& reference);
+};
+
+template<typename Map>
+bool TestBPlusTree::sameElements(const Map& map, const std::map<typename Map::key_type, int>& reference)
+{
+    if (map.size() != reference.size()) {
+        return false;
+    }
+    auto it = map.begin();
+    for (const auto& [key, value] : reference) {
+        if (it == map.end() || it->first != key || it->second != value) {
+            return false;
+        }
+        ++it;
+    }
+    return it == map.end();
+}
+
+template<typename Map>
+bool TestBPlusTree::matchesStdMap(const unsigned seed, const int key_range)
+{
+    using key_type = typename Map::key_type;
+    Map map;
+    std::map<key_type, int> reference;
+    std::mt19937 engine(seed);
+    const auto random_key = [&] {
+        if constexpr (std::is_same_v<key_type, std::string>) {
+            return "key " + std::to_string(engine() % key_range) + " long enough for the heap";
+        }
+        else {
+            return static_cast<key_type>(engine() % key_range);
+        }
+    };
+
+    for (int step = 0; step < 50000; ++step) {
+        const key_type key = random_key();
+        if (engine() % 5 < 3) {
+            const int value = static_cast<int>(engine() % 1000);
+            if (map.try_emplace(key, value).second != reference.try_emplace(key, value).second) {
+                return false;
+            }
+        }
+        else if (map.erase(key) != reference.erase(key)) {
+            return false;
+        }
+        const auto bound = map.lower_bound(key);
+        const auto expected = reference.lower_bound(key);
+        if ((bound == map.end()) != (expected == reference.end())
+            || (expected != reference.end() && bound->first != expected->first)) {
+            return false;
+        }
+        if (step % 1000 == 0 && !sameElements(map, reference)) {
+            return false;
+        }
+    }
+
+    /* erase everything in random order, so the tree shrinks back to nothing */
+    std::vector<key_type> keys;
+    for (const auto& element : reference) {
+        keys.push_back(element.first);
+    }
+    std::shuffle(keys.begin(), keys.end(), engine);
+    for (const key_type& key : keys) {
+        if (map.erase(key) != 1) {
+            return false;
+        }
+    }
+    return map.empty() && map.height() == 0 && map.begin() == map.end();
+}
+
+void TestBPlusTree::capacitiesFollowNodeBytes() const
+{
+    using util::data_structure::bplus_tree_map;
+
+    qDebug() << "Fanout grows with the node size and shrinks with the element size";
+    QCOMPARE_EQ((bplus_tree_map<std::uint64_t, std::uint64_t>::leaf_capacity), 30);
+    QCOMPARE_EQ((bplus_tree_map<std::uint64_t, std::uint64_t>::inner_capacity), 31);
+    QCOMPARE_EQ((bplus_tree_map<std::uint64_t, std::uint64_t, std::less<>, 4096>::leaf_capacity), 254);
+    QCOMPARE_EQ((bplus_tree_map<std::uint32_t, std::uint32_t>::leaf_capacity), 61);
+    QCOMPARE_EQ((bplus_tree_map<std::string, int, std::less<>, 64>::leaf_capacity), 3);
+
+    return;
+}
+
+void TestBPlusTree::matchesStdMap() const
+{
+    using util::data_structure::bplus_tree_map;
+
+    qDebug() << "Minimum capacity nodes, few and many distinct keys";
+    QVERIFY((matchesStdMap<bplus_tree_map<int, int, std::less<int>, 64>>(1, 300)));
+    QVERIFY((matchesStdMap<bplus_tree_map<int, int, std::less<int>, 64>>(2, 30000)));
+
+    qDebug() << "String keys that own heap memory";
+    QVERIFY((matchesStdMap<bplus_tree_map<std::string, int, std::less<std::string>, 64>>(3, 3000)));
+
+    qDebug() << "Default node size";
+    QVERIFY((matchesStdMap<bplus_tree_map<std::int64_t, int>>(4, 100000)));
+
+    return;
+}
+
+void TestBPlusTree::boundsAndIteration() const
+{
+    util::data_structure::bplus_tree_map<int, int, std::less<int>, 64> map;
+    for (int key = 0; key < 1000; key += 2) {
+        map[key] = key * 10;
+    }
+
+    qDebug() << "lower_bound and upper_bound across leaf boundaries";
+    QCOMPARE_EQ(map.lower_bound(501)->first, 502);
+    QCOMPARE_EQ(map.lower_bound(502)->first, 502);
+    QCOMPARE_EQ(map.upper_bound(502)->first, 504);
+    QVERIFY(map.lower_bound(999) == map.end());
+    QCOMPARE_EQ(map.lower_bound(-5)->first, 0);
+
+    qDebug() << "A range scan visits every key of the range once";
+    int visited = 0;
+    bool ordered = true;
+    for (auto it = map.lower_bound(100); it != map.upper_bound(300); ++it) {
+        ordered = ordered && it->first == 100 + 2 * visited;
+        ++visited;
+    }
+    QVERIFY(ordered);
+    QCOMPARE_EQ(visited, 101);
+
+    qDebug() << "Iteration backwards from end and writes through iterators";
+    auto it = map.end();
+    --it;
+    QCOMPARE_EQ(it->first, 998);
+    it->second = -1;
+    QCOMPARE_EQ(map.at(998), -1);
+    const auto next = map.erase(map.find(500));
+    QCOMPARE_EQ(next->first, 502);
+    QVERIFY(!map.contains(500));
+
+    return;
+}
+
+void TestBPlusTree::bulkLoad() const
+{
+    using map_type = util::data_structure::bplus_tree_map<int, int, std::less<int>, 64>;
+
+    for (const int n : { 0, 1, 3, 4, 50, 5000 }) {
+        qDebug() << "Bulk-loading" << n << "sorted elements";
+        std::vector<std::pair<int, int>> sorted;
+        std::map<int, int> reference;
+        for (int i = 0; i < n; ++i) {
+            sorted.emplace_back(i * 3, i);
+            reference.emplace(i * 3, i);
+        }
+        map_type map;
+        map[-1] = 0;
+        map.bulk_load(sorted);
+        QVERIFY(sameElements(map, reference));
+
+        /* the loaded tree takes inserts and erases like any other */
+        for (int i = 0; i < n; i += 2) {
+            map.erase(i * 3);
+            reference.erase(i * 3);
+            map.try_emplace(i * 3 + 1, i);
+            reference.try_emplace(i * 3 + 1, i);
+        }
+        QVERIFY(sameElements(map, reference));
+    }
+
+    qDebug() << "Unsorted or duplicate keys are rejected, leaving the map unchanged";
+    map_type map;
+    map[7] = 7;
+    const std::vector<std::pair<int, int>> unsorted = { { 1, 0 }, { 3, 0 }, { 2, 0 } };
+    const std::vector<std::pair<int, int>> duplicate = { { 1, 0 }, { 1, 0 } };
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, map.bulk_load(unsorted));
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, map.bulk_load(duplicate));
+    QCOMPARE_EQ(map.size(), 1);
+    QCOMPARE_EQ(map.at(7), 7);
+
+    return;
+}
+
+void TestBPlusTree::copyAndMove() const
+{
+    using map_type = util::data_structure::bplus_tree_map<std::string, int, std::less<std::string>, 64>;
+
+    map_type map;
+    std::map<std::string, int> reference;
+    for (int i = 0; i < 500; ++i) {
+        map["name " + std::to_string(i * 7 % 500)] = i;
+        reference["name " + std::to_string(i * 7 % 500)] = i;
+    }
+
+    qDebug() << "A copy is rebuilt bottom-up and independent of the original";
+    map_type copy(map);
+    QVERIFY(sameElements(copy, reference));
+    copy.erase("name 0");
+    QVERIFY(map.contains("name 0"));
+
+    qDebug() << "Moving leaves the source empty";
+    map_type moved(std::move(copy));
+    QVERIFY(copy.empty());
+    QCOMPARE_EQ(moved.size(), 499);
+    copy = map;
+    QVERIFY(sameElements(copy, reference));
+
+    return;
+}
+
+void TestBPlusTree::missingKeyThrows() const
+{
+    util::data_structure::bplus_tree_map<int, int> map;
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, map.at(1));
+    map[1] = 1;
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, map.at(2));
+    QCOMPARE_EQ(map.erase(2), 0);
+
+    return;
+}
+
+QTEST_MAIN(TestBPlusTree)
+#include "qtest_bplus_tree.moc"
@@ -11,12 +11,16 @@
 #ifndef DENODE_HPP
 #define DENODE_HPP
 
+#include <cstdlib>
 #include <iostream>
 #include <concepts>
 #include <new>
-#include <format>
 #include <type_traits>
 
+/* counts allocations, links followed and element copies and moves */
+/* when built with GDS_INSTRUMENTATION, otherwise compiles to nothing */
+#include "../Instrumentation/instrumentation.hpp"
+
 namespace util::data_structure {
 
 template<typename _Elem>
@@ -33,30 +37,30 @@ public:
 
     /* default constructor */
     /* std::is_default_constructible<elem_type>::value */
-    explicit denode<elem_type>()
+    explicit denode()
     requires std::default_initializable<elem_type>;
 
     /* overloaded constructor */
     /* std::is_copy_constructible<elem_type>::value */
-    explicit denode<elem_type>(const elem_type& value)
+    explicit denode(const elem_type& value)
     requires std::copy_constructible<elem_type>;
 
     /* specialized overload for head node of double linked list */
-    explicit denode<elem_type>(const elem_type& value, denode<elem_type>* const next)
+    explicit denode(const elem_type& value, denode<elem_type>* const next)
     requires std::copy_constructible<elem_type>;
 
     /* specialized overload for tail node of double linked list */
-    explicit denode<elem_type>(denode<elem_type>* const prev, const elem_type& value)
+    explicit denode(denode<elem_type>* const prev, const elem_type& value)
     requires std::copy_constructible<elem_type>;
 
     /* specialized overload for ordinary node */
-    explicit denode<elem_type>(const elem_type& value, denode<elem_type>* const prev, denode<elem_type>* const next)
+    explicit denode(const elem_type& value, denode<elem_type>* const prev, denode<elem_type>* const next)
     requires std::copy_constructible<elem_type>;
 
     /* copy constructor */
     /* std::is_copy_constructible<denode<elem_type>>::value */
-    denode<elem_type>(const denode<elem_type>& rhs)
-    requires std::copy_constructible<elem_type>::value;
+    denode(const denode<elem_type>& rhs)
+    requires std::copy_constructible<elem_type>;
 
     /* copy assignment operator overload */
     /* std::is_copy_assignable<elem_type>::value */
@@ -65,7 +69,7 @@ public:
 
     /* move constructor overload */
     /* std::is_move_constructible<denode<elem_type>>::value */
-    denode<elem_type>(denode<elem_type>&& rhs) noexcept
+    denode(denode<elem_type>&& rhs) noexcept
     requires std::movable<elem_type>;
 
     /* move assignment operator overload */
@@ -77,13 +81,13 @@ public:
     && std::is_nothrow_move_assignable<elem_type>::value;
 
     /* destructor */
-    ~denode<elem_type>()
-    requires std::destructible<elem_type>;
+    ~denode()
+    requires std::destructible<elem_type> = default;
 
     /* overloaded new and delete operator */
     /* otherwise denode<_Elem>* will fail */
     [[nodiscard]] static void* operator new(std::size_t size);
-    static void operator delete(void* ptr) noexcept;
+    static void operator delete(void* ptr, std::size_t size) noexcept;
 
     [[nodiscard]] static void* operator new[](std::size_t count);
     static void operator delete[](void* ptr, std::size_t size);
@@ -98,11 +102,11 @@ public:
     requires std::copyable<elem_type> { return elem_value; }
 
     /* previous node mutator and accessor */
-    inline denode<elem_type>* prev() const { return prev_denode; }
+    inline denode<elem_type>* prev() const { return step_to(prev_denode); }
     inline void set_prev(denode<elem_type>* prev) { prev->next_denode = this; prev_denode = prev; }
 
     /* next node mutator and accessor */
-    inline denode<elem_type>* next() const { return next_denode; }
+    inline denode<elem_type>* next() const { return step_to(next_denode); }
     inline void set_next(denode<elem_type>* next) { next->prev_denode = this; next_denode = next; }
 
     /* link-as-previous node member function */
@@ -111,6 +115,12 @@ public:
     /* link-as-next node member function */
     void linear_append(denode<elem_type>* node);
 
+    /* unlink-self member function, joins the neighbours in O(1) */
+    void unlink() noexcept;
+
+    /* whether the node has a neighbour on either side */
+    inline bool linked() const noexcept { return prev_denode != nullptr || next_denode != nullptr; }
+
     static inline void drop_all_before(denode<elem_type>* node);
 
     static inline void drop_all_after(denode<elem_type>* node);
@@ -144,15 +154,22 @@ public:
     }
 
     /* operator >> overload to link a node */
-    inline friend void operator >> (denode<elem_type>& lhs, denode<elem_type>* rhs) noexcept;
+    /* lhs >> &rhs */
+    inline friend void operator >> (denode<elem_type>& lhs, denode<elem_type>* rhs) noexcept {
+        lhs.linear_append(rhs);
+        return;
+    }
 
     /* operator << overload with attribute-like signature */
     inline friend std::ostream& operator << (std::ostream& out, const denode<elem_type>& node) {
         return out << __func__ << " [[std::ostream&]] << denode data: " << node.elem_value << "\n";
     }
 
-    // friend denode<elem_type>& operator << (denode<elem_type>& lhs, denode<elem_type>* const rhs);
-    friend auto operator << (denode<elem_type>& lhs, denode<elem_type>* const rhs) -> denode<elem_type>&;
+    /* lhs << &rhs << &rhs_next, returns the node linked last */
+    inline friend auto operator << (denode<elem_type>& lhs, denode<elem_type>* const rhs) -> denode<elem_type>& {
+        lhs.linear_append(rhs);
+        return *rhs;
+    }
 
     /* supportive debug and print functionality */
     inline void debug_this();
@@ -168,11 +185,407 @@ private:
     elem_type elem_value;
     denode<elem_type>* prev_denode;
     denode<elem_type>* next_denode;
+
+    static inline void record(const util::instrumentation::event event, const std::size_t n = 1) noexcept {
+        util::instrumentation::record(util::instrumentation::structure::denode, event, n);
+    }
+
+    /* a link followed to a neighbour counts as one traversal step */
+    static inline denode<elem_type>* step_to(denode<elem_type>* const neighbour) noexcept {
+        if (neighbour != nullptr) {
+            record(util::instrumentation::event::traversal_steps);
+        }
+        return neighbour;
+    }
 };
 
+/* default constructor */
+template<typename elem_type>
+denode<elem_type>::denode()
+requires std::default_initializable<elem_type>
+: elem_value{}
+, prev_denode{ nullptr }
+, next_denode{ nullptr } {}
+
+/* overloaded constructor */
+template<typename elem_type>
+denode<elem_type>::denode(const elem_type& value)
+requires std::copy_constructible<elem_type>
+: elem_value{ value }
+, prev_denode{ nullptr }
+, next_denode{ nullptr } {
+    record(util::instrumentation::event::copies);
+}
+
+/* head node, linked both ways with next */
+template<typename elem_type>
+denode<elem_type>::denode(const elem_type& value, denode<elem_type>* const next)
+requires std::copy_constructible<elem_type>
+: elem_value{ value }
+, prev_denode{ nullptr }
+, next_denode{ nullptr } {
+    record(util::instrumentation::event::copies);
+    if (next != nullptr) {
+        set_next(next);
+    }
+}
+
+/* tail node, linked both ways with prev */
+template<typename elem_type>
+denode<elem_type>::denode(denode<elem_type>* const prev, const elem_type& value)
+requires std::copy_constructible<elem_type>
+: elem_value{ value }
+, prev_denode{ nullptr }
+, next_denode{ nullptr } {
+    record(util::instrumentation::event::copies);
+    if (prev != nullptr) {
+        set_prev(prev);
+    }
+}
+
+/* ordinary node, linked both ways with prev and next */
+template<typename elem_type>
+denode<elem_type>::denode(const elem_type& value, denode<elem_type>* const prev, denode<elem_type>* const next)
+requires std::copy_constructible<elem_type>
+: elem_value{ value }
+, prev_denode{ nullptr }
+, next_denode{ nullptr } {
+    record(util::instrumentation::event::copies);
+    if (prev != nullptr) {
+        set_prev(prev);
+    }
+    if (next != nullptr) {
+        set_next(next);
+    }
+}
+
+/* copy constructor, copies the links as node<elem_type> does */
+template<typename elem_type>
+denode<elem_type>::denode(const denode<elem_type>& rhs)
+requires std::copy_constructible<elem_type>
+: elem_value{ rhs.elem_value }
+, prev_denode{ rhs.prev_denode }
+, next_denode{ rhs.next_denode } {
+    record(util::instrumentation::event::copies);
+}
+
+/* copy assignment operator */
+template<typename elem_type>
+denode<elem_type>&
+denode<elem_type>::operator = (const denode<elem_type>& rhs)
+requires std::copyable<elem_type> {
+    // guard self assignment
+    if (this == &rhs) { return *this; }
+    elem_value = rhs.elem_value;
+    prev_denode = rhs.prev_denode;
+    next_denode = rhs.next_denode;
+    record(util::instrumentation::event::copies);
+    return *this;
+}
+
+/* move constructor */
+template<typename elem_type>
+denode<elem_type>::denode(denode<elem_type>&& rhs) noexcept
+requires std::movable<elem_type>
+: elem_value{ std::move(rhs.elem_value) }
+, prev_denode{ rhs.prev_denode }
+, next_denode{ rhs.next_denode } {
+    record(util::instrumentation::event::moves);
+}
+
+/* move assignment operator */
+template<typename elem_type>
+denode<elem_type>&
+denode<elem_type>::operator = (denode<elem_type>&& rhs) noexcept
+requires std::copyable<elem_type>
+&& std::movable<elem_type>
+&& std::is_nothrow_move_assignable<elem_type>::value {
+    // guard self assignment
+    if (this == &rhs) { return *this; }
+    elem_value = std::move(rhs.elem_value);
+    prev_denode = rhs.prev_denode;
+    next_denode = rhs.next_denode;
+    record(util::instrumentation::event::moves);
+    return *this;
+}
+
+/**
+ * Overloaded new operator to allocate a denode on the heap.
+ *
+ * \param size
+ * \return void*, a pointer without type information
+ */
+template<typename elem_type>
+[[nodiscard]] void*
+denode<elem_type>::operator new(std::size_t size) {
+    if (size == 0) {
+        ++size; // avoid std::malloc(0) which may return nullptr on success
+    }
+
+    if (void* ptr = std::malloc(size)) {
+        record(util::instrumentation::event::allocations);
+        record(util::instrumentation::event::bytes_allocated, size);
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+/**
+ * Overloaded delete operator to deallocate a denode on the heap.
+ *
+ * \param ptr
+ * \param size, the size requested from operator new
+ * \return void
+ */
+template<typename elem_type>
+void
+denode<elem_type>::operator delete(void* ptr, std::size_t size) noexcept {
+    if (ptr != nullptr) {
+        record(util::instrumentation::event::deallocations);
+        record(util::instrumentation::event::bytes_deallocated, size);
+    }
+    std::free(ptr);
+    return;
+}
+
+/**
+ * Overloaded new[] operator to allocate an array of denode on the heap.
+ *
+ * \param count
+ * \return void*, a pointer without type information
+ */
+template<typename elem_type>
+[[nodiscard]] void*
+denode<elem_type>::operator new[](std::size_t count) {
+    void* ptr = ::operator new[](count);
+    record(util::instrumentation::event::allocations);
+    record(util::instrumentation::event::bytes_allocated, count);
+    return ptr;
+}
+
+/**
+ * Overloaded delete[] operator to deallocate an array of denode on the heap.
+ *
+ * \param ptr
+ * \return void
+ */
 template<typename elem_type>
-inline void denode<elem_type>::print_all_before(const double_linked_list<elem_type>* const node)
-{
+void
+denode<elem_type>::operator delete[](void* ptr, std::size_t size) {
+    if (ptr != nullptr) {
+        record(util::instrumentation::event::deallocations);
+        record(util::instrumentation::event::bytes_deallocated, size);
+    }
+    ::operator delete[](ptr);
+    return;
+}
+
+/**
+ * Insert a node between this node and the one before it,
+ * keeping both directions of every link consistent.
+ *
+ * \param node
+ * \return void
+ */
+template<typename elem_type>
+void
+denode<elem_type>::linear_prepend(denode<elem_type>* node) {
+    if (node == nullptr) {
+        std::cout << "Warning! Attempting to linearly link a null pointer" << "\n";
+        std::cout << "Returning the control flow" << "\n";
+    }
+    else if (prev_denode == node || node == this) {
+        std::cout << "Warning! Attempting to linearly link a node already linked as the previous" << "\n";
+        std::cout << "Returning the control flow" << "\n";
+    }
+    else [[likely]] {
+        node->prev_denode = prev_denode;
+        node->next_denode = this;
+        if (prev_denode != nullptr) {
+            prev_denode->next_denode = node;
+        }
+        prev_denode = node;
+    }
+
+    return;
+}
+
+/**
+ * Insert a node between this node and the one after it,
+ * keeping both directions of every link consistent.
+ *
+ * \param node
+ * \return void
+ */
+template<typename elem_type>
+void
+denode<elem_type>::linear_append(denode<elem_type>* node) {
+    if (node == nullptr) {
+        std::cout << "Warning! Attempting to linearly link a null pointer" << "\n";
+        std::cout << "Returning the control flow" << "\n";
+    }
+    else if (next_denode == node || node == this) {
+        std::cout << "Warning! Attempting to linearly link a node already linked as the next" << "\n";
+        std::cout << "Returning the control flow" << "\n";
+    }
+    else [[likely]] {
+        node->next_denode = next_denode;
+        node->prev_denode = this;
+        if (next_denode != nullptr) {
+            next_denode->prev_denode = node;
+        }
+        next_denode = node;
+    }
+
+    return;
+}
+
+/**
+ * Take this node out of its list, linking its neighbours to each other;
+ * the node is left without neighbours and can be linked again. Lists
+ * closed into a ring, like intrusive buckets with a sentinel, work too.
+ *
+ * \param void
+ * \return void
+ */
+template<typename elem_type>
+void
+denode<elem_type>::unlink() noexcept {
+    if (prev_denode != nullptr) {
+        prev_denode->next_denode = next_denode;
+    }
+    if (next_denode != nullptr) {
+        next_denode->prev_denode = prev_denode;
+    }
+    prev_denode = nullptr;
+    next_denode = nullptr;
+    return;
+}
+
+/**
+ * Cut the list in front of node; the detached nodes require manual
+ * deallocation if they are allocated on the heap.
+ *
+ * \param node
+ */
+template<typename elem_type>
+inline void
+denode<elem_type>::drop_all_before(denode<elem_type>* node) {
+    if (node->prev_denode != nullptr) {
+        node->prev_denode->next_denode = nullptr;
+        node->prev_denode = nullptr;
+    }
+    return;
+}
+
+/**
+ * Cut the list after node; the detached nodes require manual
+ * deallocation if they are allocated on the heap.
+ *
+ * \param node
+ */
+template<typename elem_type>
+inline void
+denode<elem_type>::drop_all_after(denode<elem_type>* node) {
+    if (node->next_denode != nullptr) {
+        node->next_denode->prev_denode = nullptr;
+        node->next_denode = nullptr;
+    }
+    return;
+}
+
+/* prefix increment, stays on the tail node */
+template<typename elem_type>
+denode<elem_type>&
+denode<elem_type>::operator ++ () {
+    return next_denode != nullptr ? *step_to(next_denode) : *this;
+}
+
+/* prefix decrement, stays on the head node */
+template<typename elem_type>
+denode<elem_type>&
+denode<elem_type>::operator -- () {
+    return prev_denode != nullptr ? *step_to(prev_denode) : *this;
+}
+
+/* equality comparison operator, same value and same neighbours */
+template<typename elem_type>
+inline bool
+denode<elem_type>::operator == (const denode<elem_type>& node) const
+requires std::equality_comparable<elem_type> {
+    return elem_value == node.elem_value
+        && prev_denode == node.prev_denode
+        && next_denode == node.next_denode;
+}
+
+/**
+ * Print the node and both of its neighbours to stdout.
+ *
+ * \param void
+ */
+template<typename elem_type>
+inline void
+denode<elem_type>::debug_this() {
+    std::cout << "denode data: " << elem_value
+        << ", prev denode: " << reinterpret_cast<void*>(prev_denode)
+        << ", next denode: " << reinterpret_cast<void*>(next_denode) << "\n";
+    return;
+}
+
+/**
+ * Using class specific friend oprator << to output to received std::ostream&.
+ *
+ * \param out
+ */
+template<typename elem_type>
+inline void
+denode<elem_type>::debug_this(std::ostream& out) {
+    out << (*this);
+    return;
+}
+
+/**
+ * Non-member function to print double linked list from its head up to a node.
+ *
+ * \param node
+ */
+template<typename elem_type>
+void
+denode<elem_type>::print_all_before(const double_linked_list<elem_type>* const node) {
+    std::cout << "double_linked_list nullptr";
+    const denode<elem_type>* head(node);
+    while (head != nullptr && head->prev_denode != nullptr) {
+        head = step_to(head->prev_denode);
+    }
+    for (const denode<elem_type>* temp(head); temp != nullptr; temp = step_to(temp->next_denode)) {
+        std::cout << " <-> " << temp->value();
+        if (temp == node) {
+            break;
+        }
+    }
+    std::cout << "\n";
+
+    return;
+}
+
+/**
+ * Non-member function to print double linked list starting from a node.
+ *
+ * \param node
+ */
+template<typename elem_type>
+void
+denode<elem_type>::print_all_after(const double_linked_list<elem_type>* const node) {
+    std::cout << "double_linked_list ";
+    const denode<elem_type>* temp(node);
+    while (temp != nullptr) {
+        std::cout << temp->value() << " <-> ";
+        temp = step_to(temp->next_denode);
+    }
+    std::cout << "nullptr\n";
+
+    return;
 }
 
 } // util::data_structure
@@ -0,0 +1,842 @@
+/*****************************************************************//**
+ * \file   flat_map.hpp
+ * \brief  Sorted flat map and flat set on LinearVector.
+ *
+ * flat_map keeps its keys sorted in one LinearVector and its values at the
+ * same positions in another, in the manner of C++23 std::flat_map: a
+ * lookup binary-searches the key array alone, so its comparisons read keys
+ * packed next to each other instead of chasing tree nodes, and values are
+ * only read for the element found. flat_set is the same without values.
+ *
+ * Inserting one element shifts every element after it, O(n). Many
+ * elements are best inserted at once: insert(first, last) appends them all
+ * and then sorts the appended ones and merges them with the rest in one
+ * O(n + m log m) pass, or O(n + m) through insert(sorted_unique, first,
+ * last) for input already sorted. Keys already present, and later
+ * duplicates among the inserted, are dropped. Iterators are invalidated
+ * by every insert and erase; elements are moved, so keys and values must
+ * move without throwing.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../LinearVector/linear_vector.hpp"
+
+namespace util::data_structure {
+
+/* tag for input known to be sorted by unique keys, as std::sorted_unique */
+struct sorted_unique_t {
+    explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+namespace detail::flat {
+
+/*
+ * Index of the first of keys[0, n) for which pred is false, keys being
+ * partitioned by pred. The range halves without a branch on the outcome
+ * of pred, which compiles to a conditional move for scalar keys, so a
+ * lookup in a table that fits in cache does not pay for mispredictions.
+ */
+template<typename _Key, typename _Pred>
+std::size_t partition_point(const _Key* const keys, std::size_t n, _Pred pred) {
+    if (n == 0) {
+        return 0;
+    }
+    const _Key* base = keys;
+    while (n > 1) {
+        const std::size_t half = n / 2;
+        base = pred(base[half]) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<std::size_t>(base - keys) + (pred(*base) ? 1 : 0);
+}
+
+/* whether keys[first - 1, n) is strictly increasing, that is appending keys[first, n) kept the order */
+template<typename _Key, typename _Compare>
+bool appended_in_order(const _Key* const keys, const std::size_t first, const std::size_t n, const _Compare& comp) {
+    for (std::size_t i = std::max<std::size_t>(first, 1); i < n; ++i) {
+        if (!comp(keys[i - 1], keys[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Indices of keys[0, n) in sorted order without duplicate keys, where
+ * keys[0, first) are sorted and unique and keys[first, n) were appended
+ * in any order, or in sorted order if appended_sorted, which skips
+ * sorting them. Of equal keys the one already present is kept, then the
+ * earliest appended. Only indices are sorted, so nothing has been moved
+ * when the comparison or an allocation throws.
+ */
+template<typename _Key, typename _Compare>
+LinearVector<std::size_t> merged_order(const _Key* const keys, const std::size_t first, const std::size_t n,
+                                       const _Compare& comp, const bool appended_sorted = false) {
+    LinearVector<std::size_t> appended;
+    appended.reserve(n - first);
+    for (std::size_t i = first; i < n; ++i) {
+        appended.push_back(i);
+    }
+    if (!appended_sorted && !appended_in_order(keys, first, n, comp)) {
+        std::stable_sort(appended.begin(), appended.end(),
+                         [&](const std::size_t lhs, const std::size_t rhs) { return comp(keys[lhs], keys[rhs]); });
+    }
+
+    LinearVector<std::size_t> order;
+    order.reserve(n);
+    std::size_t present = 0;
+    const std::size_t* next_appended = appended.begin();
+    while (present < first || next_appended != appended.end()) {
+        const bool take_present = next_appended == appended.end()
+            || (present < first && !comp(keys[*next_appended], keys[present]));
+        const std::size_t next = take_present ? present++ : *next_appended++;
+        if (order.empty() || comp(keys[order.back()], keys[next])) {
+            order.push_back(next);
+        }
+    }
+    return order;
+}
+
+} // namespace detail::flat
+
+template<typename _Key, typename _Value, typename _Compare = std::less<_Key>,
+         typename _KeyContainer = LinearVector<_Key>, typename _MappedContainer = LinearVector<_Value>>
+class flat_map {
+public:
+    using key_type = _Key;
+    using mapped_type = _Value;
+    using value_type = std::pair<_Key, _Value>;
+    using key_compare = _Compare;
+    using key_container_type = _KeyContainer;
+    using mapped_container_type = _MappedContainer;
+    using size_type = std::size_t;
+
+    static_assert(std::is_nothrow_move_constructible_v<_Key> && std::is_nothrow_move_assignable_v<_Key>,
+                  "keys are shifted inside the key array and must move without throwing");
+    static_assert(std::is_nothrow_move_constructible_v<_Value> && std::is_nothrow_move_assignable_v<_Value>,
+                  "values are shifted inside the value array and must move without throwing");
+
+    /* the two arrays, as extract() hands them out and replace() takes them */
+    struct containers {
+        _KeyContainer keys;
+        _MappedContainer values;
+    };
+
+    template<bool _Const>
+    class basic_iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::pair<_Key, _Value>;
+        using difference_type = std::ptrdiff_t;
+        /* keys and values live in separate arrays, so elements are referred to by a pair of references */
+        using reference = std::pair<const _Key&, std::conditional_t<_Const, const _Value&, _Value&>>;
+
+        struct pointer {
+            reference ref;
+            const reference* operator -> () const { return &ref; }
+        };
+
+        basic_iterator() = default;
+
+        /* iterator converts to const_iterator */
+        template<bool _OtherConst>
+        requires (_Const && !_OtherConst)
+        basic_iterator(const basic_iterator<_OtherConst>& other) : key(other.key), value(other.value) {}
+
+        reference operator * () const { return { *key, *value }; }
+        pointer operator -> () const { return pointer{ **this }; }
+        reference operator [] (const difference_type n) const { return { key[n], value[n] }; }
+
+        basic_iterator& operator ++ () {
+            ++key;
+            ++value;
+            return *this;
+        }
+
+        basic_iterator operator ++ (int) {
+            basic_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        basic_iterator& operator -- () {
+            --key;
+            --value;
+            return *this;
+        }
+
+        basic_iterator operator -- (int) {
+            basic_iterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        basic_iterator& operator += (const difference_type n) {
+            key += n;
+            value += n;
+            return *this;
+        }
+
+        basic_iterator& operator -= (const difference_type n) { return *this += -n; }
+
+        friend basic_iterator operator + (basic_iterator it, const difference_type n) { return it += n; }
+        friend basic_iterator operator + (const difference_type n, basic_iterator it) { return it += n; }
+        friend basic_iterator operator - (basic_iterator it, const difference_type n) { return it -= n; }
+        friend difference_type operator - (const basic_iterator& lhs, const basic_iterator& rhs) { return lhs.key - rhs.key; }
+
+        friend bool operator == (const basic_iterator& lhs, const basic_iterator& rhs) { return lhs.key == rhs.key; }
+        friend auto operator <=> (const basic_iterator& lhs, const basic_iterator& rhs) { return lhs.key <=> rhs.key; }
+
+    private:
+        friend class flat_map;
+        template<bool> friend class basic_iterator;
+
+        using value_pointer = std::conditional_t<_Const, const _Value*, _Value*>;
+
+        basic_iterator(const _Key* const k, const value_pointer v) : key(k), value(v) {}
+
+        const _Key* key = nullptr;
+        value_pointer value = nullptr;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* default constructor */
+    flat_map() = default;
+
+    explicit flat_map(const _Compare& compare) : comp(compare) {}
+
+    /*
+     * Take the two arrays of equal length, sorting them by key; of equal keys
+     * the first is kept. Throws std::invalid_argument if the lengths differ.
+     */
+    flat_map(_KeyContainer key_cont, _MappedContainer mapped_cont, const _Compare& compare = _Compare())
+        : key_array(std::move(key_cont)), value_array(std::move(mapped_cont)), comp(compare) {
+        check_lengths();
+        merge_appended(0);
+    }
+
+    /* take two arrays already sorted by unique keys, throws std::invalid_argument if they are not */
+    flat_map(sorted_unique_t, _KeyContainer key_cont, _MappedContainer mapped_cont, const _Compare& compare = _Compare())
+        : key_array(std::move(key_cont)), value_array(std::move(mapped_cont)), comp(compare) {
+        check_lengths();
+        check_sorted_unique();
+    }
+
+    /* initialization from an iterator pair of key and value pairs */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    flat_map(_InputIt first, _Sentinel last, const _Compare& compare = _Compare()) : comp(compare) {
+        insert(std::move(first), std::move(last));
+    }
+
+    flat_map(std::initializer_list<value_type> init, const _Compare& compare = _Compare()) : comp(compare) {
+        insert(init.begin(), init.end());
+    }
+
+    /* iterators */
+    iterator begin() { return iterator(key_array.data(), value_array.data()); }
+    iterator end() { return begin() + static_cast<std::ptrdiff_t>(size()); }
+    const_iterator begin() const { return const_iterator(key_array.data(), value_array.data()); }
+    const_iterator end() const { return begin() + static_cast<std::ptrdiff_t>(size()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return key_array.empty(); }
+    size_type size() const { return key_array.size(); }
+
+    /* make room for n elements in both arrays */
+    void reserve(const size_type n) {
+        key_array.reserve(n);
+        value_array.reserve(n);
+        return;
+    }
+
+    /* the sorted keys and the values in the same order */
+    const _KeyContainer& keys() const { return key_array; }
+    const _MappedContainer& values() const { return value_array; }
+
+    key_compare key_comp() const { return comp; }
+
+    /* lookup, with keys of another type when the comparison is transparent */
+    iterator find(const _Key& key) { return begin() + find_index(key); }
+    const_iterator find(const _Key& key) const { return begin() + find_index(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    iterator find(const _Probe& key) { return begin() + find_index(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    const_iterator find(const _Probe& key) const { return begin() + find_index(key); }
+
+    bool contains(const _Key& key) const { return static_cast<size_type>(find_index(key)) != size(); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    bool contains(const _Probe& key) const { return static_cast<size_type>(find_index(key)) != size(); }
+
+    size_type count(const _Key& key) const { return contains(key) ? 1 : 0; }
+
+    /* the value of key, throws std::out_of_range if it is not in the map */
+    _Value& at(const _Key& key) { return const_cast<_Value&>(std::as_const(*this).at(key)); }
+
+    const _Value& at(const _Key& key) const {
+        const std::ptrdiff_t index = find_index(key);
+        if (static_cast<size_type>(index) == size()) {
+            throw std::out_of_range("key is not in the map");
+        }
+        return value_array.data()[index];
+    }
+
+    /* the first element whose key is not less than key */
+    iterator lower_bound(const _Key& key) { return begin() + lower_index(key); }
+    const_iterator lower_bound(const _Key& key) const { return begin() + lower_index(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    iterator lower_bound(const _Probe& key) { return begin() + lower_index(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    const_iterator lower_bound(const _Probe& key) const { return begin() + lower_index(key); }
+
+    /* the first element whose key is greater than key */
+    iterator upper_bound(const _Key& key) { return begin() + upper_index(key); }
+    const_iterator upper_bound(const _Key& key) const { return begin() + upper_index(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    iterator upper_bound(const _Probe& key) { return begin() + upper_index(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    const_iterator upper_bound(const _Probe& key) const { return begin() + upper_index(key); }
+
+    /* modifiers */
+    _Value& operator [] (const _Key& key) { return (*try_emplace(key).first).second; }
+    _Value& operator [] (_Key&& key) { return (*try_emplace(std::move(key)).first).second; }
+
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(std::move(value.first), std::move(value.second)); }
+
+    template<typename... _Args>
+    std::pair<iterator, bool> emplace(_Args&&... args) {
+        return insert(value_type(std::forward<_Args>(args)...));
+    }
+
+    /* insert key with a value constructed from args unless key is already in the map */
+    template<typename... _Args>
+    std::pair<iterator, bool> try_emplace(const _Key& key, _Args&&... args) {
+        return emplace_unique(key, std::forward<_Args>(args)...);
+    }
+
+    template<typename... _Args>
+    std::pair<iterator, bool> try_emplace(_Key&& key, _Args&&... args) {
+        return emplace_unique(std::move(key), std::forward<_Args>(args)...);
+    }
+
+    template<typename _Arg>
+    std::pair<iterator, bool> insert_or_assign(const _Key& key, _Arg&& value) {
+        const std::pair<iterator, bool> result = try_emplace(key, std::forward<_Arg>(value));
+        if (!result.second) {
+            *result.first.value = std::forward<_Arg>(value);
+        }
+        return result;
+    }
+
+    /*
+     * Insert the key and value pairs of [first, last): they are appended, then
+     * sorted and merged with the elements already present in one pass. If
+     * anything throws, the map is left as it was.
+     */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    void insert(_InputIt first, _Sentinel last) {
+        append_and_merge(std::move(first), std::move(last), false);
+        return;
+    }
+
+    /* the input must be sorted by unique keys, so the appended elements are merged without sorting them */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    void insert(sorted_unique_t, _InputIt first, _Sentinel last) {
+        append_and_merge(std::move(first), std::move(last), true);
+        return;
+    }
+
+    void insert(std::initializer_list<value_type> init) { insert(init.begin(), init.end()); }
+
+    template<std::ranges::input_range _Range>
+    void insert_range(_Range&& range) {
+        insert(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    /* remove key, returning 1, or 0 if it is not in the map */
+    size_type erase(const _Key& key) {
+        const std::ptrdiff_t index = find_index(key);
+        if (static_cast<size_type>(index) == size()) {
+            return 0;
+        }
+        erase(begin() + index);
+        return 1;
+    }
+
+    /* remove the element at it, returning an iterator to the element after it */
+    iterator erase(const const_iterator it) {
+        const std::ptrdiff_t index = it.key - key_array.data();
+        std::move(key_array.begin() + index + 1, key_array.end(), key_array.begin() + index);
+        std::move(value_array.begin() + index + 1, value_array.end(), value_array.begin() + index);
+        key_array.pop_back();
+        value_array.pop_back();
+        return begin() + index;
+    }
+
+    /* hand out the arrays, leaving the map empty */
+    containers extract() && {
+        containers extracted{ std::move(key_array), std::move(value_array) };
+        key_array.clear();
+        value_array.clear();
+        return extracted;
+    }
+
+    /* take arrays already sorted by unique keys, throws std::invalid_argument if they are not */
+    void replace(_KeyContainer&& key_cont, _MappedContainer&& mapped_cont) {
+        flat_map replacement(sorted_unique, std::move(key_cont), std::move(mapped_cont), comp);
+        swap(replacement);
+        return;
+    }
+
+    void clear() {
+        key_array.clear();
+        value_array.clear();
+        return;
+    }
+
+    void swap(flat_map& other) noexcept {
+        using std::swap;
+        swap(key_array, other.key_array);
+        swap(value_array, other.value_array);
+        swap(comp, other.comp);
+        return;
+    }
+
+    friend void swap(flat_map& lhs, flat_map& rhs) noexcept { lhs.swap(rhs); }
+
+    friend bool operator == (const flat_map& lhs, const flat_map& rhs) {
+        return lhs.key_array == rhs.key_array && lhs.value_array == rhs.value_array;
+    }
+
+private:
+    _KeyContainer key_array;
+    _MappedContainer value_array;
+    [[no_unique_address]] _Compare comp;
+
+    /* ------------------------------ key searches ----------------------------- */
+
+    template<typename _Probe>
+    std::ptrdiff_t lower_index(const _Probe& key) const {
+        return static_cast<std::ptrdiff_t>(detail::flat::partition_point(
+            key_array.data(), size(), [&](const _Key& element) { return comp(element, key); }));
+    }
+
+    template<typename _Probe>
+    std::ptrdiff_t upper_index(const _Probe& key) const {
+        return static_cast<std::ptrdiff_t>(detail::flat::partition_point(
+            key_array.data(), size(), [&](const _Key& element) { return !comp(key, element); }));
+    }
+
+    /* index of key, or size() if it is not in the map */
+    template<typename _Probe>
+    std::ptrdiff_t find_index(const _Probe& key) const {
+        const std::ptrdiff_t index = lower_index(key);
+        if (static_cast<size_type>(index) == size() || comp(key, key_array.data()[index])) {
+            return static_cast<std::ptrdiff_t>(size());
+        }
+        return index;
+    }
+
+    /* ------------------------------- modifiers ------------------------------- */
+
+    /* append the element at the end of both arrays, or neither if constructing one throws */
+    template<typename _KeyArg, typename... _Args>
+    void append(_KeyArg&& key, _Args&&... args) {
+        key_array.emplace_back(std::forward<_KeyArg>(key));
+        try {
+            value_array.emplace_back(std::forward<_Args>(args)...);
+        }
+        catch (...) {
+            key_array.pop_back();
+            throw;
+        }
+        return;
+    }
+
+    /* append the element and rotate it into its place, shifting the greater keys and their values by one */
+    template<typename _KeyArg, typename... _Args>
+    std::pair<iterator, bool> emplace_unique(_KeyArg&& key, _Args&&... args) {
+        const std::ptrdiff_t index = lower_index(key);
+        if (static_cast<size_type>(index) < size() && !comp(key, key_array.data()[index])) {
+            return { begin() + index, false };
+        }
+        append(std::forward<_KeyArg>(key), std::forward<_Args>(args)...);
+        std::rotate(key_array.begin() + index, key_array.end() - 1, key_array.end());
+        std::rotate(value_array.begin() + index, value_array.end() - 1, value_array.end());
+        return { begin() + index, true };
+    }
+
+    template<typename _InputIt, typename _Sentinel>
+    void append_and_merge(_InputIt first, _Sentinel last, const bool appended_sorted) {
+        const size_type present = size();
+        if constexpr (std::sized_sentinel_for<_Sentinel, _InputIt>) {
+            reserve(present + static_cast<size_type>(last - first));
+        }
+        try {
+            for (; first != last; ++first) {
+                auto&& element = *first;
+                append(std::forward<decltype(element)>(element).first, std::forward<decltype(element)>(element).second);
+            }
+        }
+        catch (...) {
+            truncate(present);
+            throw;
+        }
+        merge_appended(present, appended_sorted);
+        return;
+    }
+
+    /* pop the elements from index n on */
+    void truncate(const size_type n) {
+        while (size() > n) {
+            key_array.pop_back();
+            value_array.pop_back();
+        }
+        return;
+    }
+
+    /*
+     * Sort the elements appended from index present on into the sorted
+     * ones before them, dropping duplicate keys. Elements appended in
+     * order past the greatest key stay where they are; otherwise both
+     * arrays are rebuilt in merged order, and if the comparison or an
+     * allocation throws the appended elements are dropped. appended_sorted
+     * says the appended elements are in order among themselves.
+     */
+    void merge_appended(const size_type present, const bool appended_sorted = false) {
+        const size_type n = size();
+        try {
+            if (detail::flat::appended_in_order(key_array.data(), present, n, comp)) {
+                return;
+            }
+            const LinearVector<std::size_t> order = detail::flat::merged_order(key_array.data(), present, n, comp, appended_sorted);
+            _KeyContainer merged_keys;
+            _MappedContainer merged_values;
+            merged_keys.reserve(order.size());
+            merged_values.reserve(order.size());
+            for (const std::size_t index : order) {
+                merged_keys.emplace_back(std::move(key_array.data()[index]));
+                merged_values.emplace_back(std::move(value_array.data()[index]));
+            }
+            using std::swap;
+            swap(key_array, merged_keys);
+            swap(value_array, merged_values);
+        }
+        catch (...) {
+            truncate(present);
+            throw;
+        }
+        return;
+    }
+
+    void check_lengths() const {
+        if (key_array.size() != value_array.size()) {
+            throw std::invalid_argument("key and value arrays differ in length");
+        }
+        return;
+    }
+
+    void check_sorted_unique() const {
+        if (!detail::flat::appended_in_order(key_array.data(), 0, size(), comp)) {
+            throw std::invalid_argument("keys are not sorted and unique");
+        }
+        return;
+    }
+};
+
+template<typename _Key, typename _Compare = std::less<_Key>, typename _KeyContainer = LinearVector<_Key>>
+class flat_set {
+public:
+    using key_type = _Key;
+    using value_type = _Key;
+    using key_compare = _Compare;
+    using container_type = _KeyContainer;
+    using size_type = std::size_t;
+
+    static_assert(std::is_nothrow_move_constructible_v<_Key> && std::is_nothrow_move_assignable_v<_Key>,
+                  "keys are shifted inside the key array and must move without throwing");
+
+    /* keys are not modifiable in place, so both iterators are read-only */
+    using iterator = const _Key*;
+    using const_iterator = const _Key*;
+
+    /* default constructor */
+    flat_set() = default;
+
+    explicit flat_set(const _Compare& compare) : comp(compare) {}
+
+    /* take the keys in any order; of equal keys the first is kept */
+    explicit flat_set(_KeyContainer cont, const _Compare& compare = _Compare())
+        : key_array(std::move(cont)), comp(compare) {
+        merge_appended(0);
+    }
+
+    /* take keys already sorted and unique, throws std::invalid_argument if they are not */
+    flat_set(sorted_unique_t, _KeyContainer cont, const _Compare& compare = _Compare())
+        : key_array(std::move(cont)), comp(compare) {
+        if (!detail::flat::appended_in_order(key_array.data(), 0, size(), comp)) {
+            throw std::invalid_argument("keys are not sorted and unique");
+        }
+    }
+
+    /* initialization from an iterator pair */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    flat_set(_InputIt first, _Sentinel last, const _Compare& compare = _Compare()) : comp(compare) {
+        insert(std::move(first), std::move(last));
+    }
+
+    flat_set(std::initializer_list<_Key> init, const _Compare& compare = _Compare()) : comp(compare) {
+        insert(init.begin(), init.end());
+    }
+
+    /* iterators */
+    const_iterator begin() const { return key_array.data(); }
+    const_iterator end() const { return key_array.data() + size(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return key_array.empty(); }
+    size_type size() const { return key_array.size(); }
+
+    void reserve(const size_type n) {
+        key_array.reserve(n);
+        return;
+    }
+
+    key_compare key_comp() const { return comp; }
+
+    /* lookup, with keys of another type when the comparison is transparent */
+    const_iterator find(const _Key& key) const { return find_key(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    const_iterator find(const _Probe& key) const { return find_key(key); }
+
+    bool contains(const _Key& key) const { return find_key(key) != end(); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    bool contains(const _Probe& key) const { return find_key(key) != end(); }
+
+    size_type count(const _Key& key) const { return contains(key) ? 1 : 0; }
+
+    /* the first key not less than key */
+    const_iterator lower_bound(const _Key& key) const { return lower_key(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    const_iterator lower_bound(const _Probe& key) const { return lower_key(key); }
+
+    /* the first key greater than key */
+    const_iterator upper_bound(const _Key& key) const { return upper_key(key); }
+
+    template<typename _Probe>
+    requires requires { typename _Compare::is_transparent; }
+    const_iterator upper_bound(const _Probe& key) const { return upper_key(key); }
+
+    /* modifiers */
+    std::pair<iterator, bool> insert(const _Key& key) { return emplace_unique(key); }
+    std::pair<iterator, bool> insert(_Key&& key) { return emplace_unique(std::move(key)); }
+
+    template<typename... _Args>
+    std::pair<iterator, bool> emplace(_Args&&... args) {
+        return emplace_unique(_Key(std::forward<_Args>(args)...));
+    }
+
+    /*
+     * Insert the keys of [first, last): they are appended, then sorted and
+     * merged with the keys already present in one pass. If anything throws,
+     * the set is left as it was.
+     */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    void insert(_InputIt first, _Sentinel last) {
+        append_and_merge(std::move(first), std::move(last), false);
+        return;
+    }
+
+    /* the input must be sorted and unique, so the appended keys are merged without sorting them */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    void insert(sorted_unique_t, _InputIt first, _Sentinel last) {
+        append_and_merge(std::move(first), std::move(last), true);
+        return;
+    }
+
+    void insert(std::initializer_list<_Key> init) { insert(init.begin(), init.end()); }
+
+    template<std::ranges::input_range _Range>
+    void insert_range(_Range&& range) {
+        insert(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    /* remove key, returning 1, or 0 if it is not in the set */
+    size_type erase(const _Key& key) {
+        const const_iterator it = find_key(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    /* remove the key at it, returning an iterator to the key after it */
+    iterator erase(const const_iterator it) {
+        const std::ptrdiff_t index = it - key_array.data();
+        std::move(key_array.begin() + index + 1, key_array.end(), key_array.begin() + index);
+        key_array.pop_back();
+        return begin() + index;
+    }
+
+    /* hand out the key array, leaving the set empty */
+    _KeyContainer extract() && {
+        _KeyContainer extracted(std::move(key_array));
+        key_array.clear();
+        return extracted;
+    }
+
+    /* take keys already sorted and unique, throws std::invalid_argument if they are not */
+    void replace(_KeyContainer&& cont) {
+        flat_set replacement(sorted_unique, std::move(cont), comp);
+        swap(replacement);
+        return;
+    }
+
+    void clear() {
+        key_array.clear();
+        return;
+    }
+
+    void swap(flat_set& other) noexcept {
+        using std::swap;
+        swap(key_array, other.key_array);
+        swap(comp, other.comp);
+        return;
+    }
+
+    friend void swap(flat_set& lhs, flat_set& rhs) noexcept { lhs.swap(rhs); }
+
+    friend bool operator == (const flat_set& lhs, const flat_set& rhs) { return lhs.key_array == rhs.key_array; }
+
+private:
+    _KeyContainer key_array;
+    [[no_unique_address]] _Compare comp;
+
+    template<typename _Probe>
+    const_iterator lower_key(const _Probe& key) const {
+        return begin() + detail::flat::partition_point(
+            key_array.data(), size(), [&](const _Key& element) { return comp(element, key); });
+    }
+
+    template<typename _Probe>
+    const_iterator upper_key(const _Probe& key) const {
+        return begin() + detail::flat::partition_point(
+            key_array.data(), size(), [&](const _Key& element) { return !comp(key, element); });
+    }
+
+    template<typename _Probe>
+    const_iterator find_key(const _Probe& key) const {
+        const const_iterator it = lower_key(key);
+        return it == end() || comp(key, *it) ? end() : it;
+    }
+
+    template<typename _Arg>
+    std::pair<iterator, bool> emplace_unique(_Arg&& key) {
+        const std::ptrdiff_t index = lower_key(key) - begin();
+        if (static_cast<size_type>(index) < size() && !comp(key, key_array.data()[index])) {
+            return { begin() + index, false };
+        }
+        key_array.emplace_back(std::forward<_Arg>(key));
+        std::rotate(key_array.begin() + index, key_array.end() - 1, key_array.end());
+        return { begin() + index, true };
+    }
+
+    template<typename _InputIt, typename _Sentinel>
+    void append_and_merge(_InputIt first, _Sentinel last, const bool appended_sorted) {
+        const size_type present = size();
+        if constexpr (std::sized_sentinel_for<_Sentinel, _InputIt>) {
+            reserve(present + static_cast<size_type>(last - first));
+        }
+        try {
+            for (; first != last; ++first) {
+                key_array.emplace_back(*first);
+            }
+        }
+        catch (...) {
+            truncate(present);
+            throw;
+        }
+        merge_appended(present, appended_sorted);
+        return;
+    }
+
+    void truncate(const size_type n) {
+        while (size() > n) {
+            key_array.pop_back();
+        }
+        return;
+    }
+
+    /* as flat_map::merge_appended, on the key array alone */
+    void merge_appended(const size_type present, const bool appended_sorted = false) {
+        const size_type n = size();
+        try {
+            if (detail::flat::appended_in_order(key_array.data(), present, n, comp)) {
+                return;
+            }
+            const LinearVector<std::size_t> order = detail::flat::merged_order(key_array.data(), present, n, comp, appended_sorted);
+            _KeyContainer merged;
+            merged.reserve(order.size());
+            for (const std::size_t index : order) {
+                merged.emplace_back(std::move(key_array.data()[index]));
+            }
+            using std::swap;
+            swap(key_array, merged);
+        }
+        catch (...) {
+            truncate(present);
+            throw;
+        }
+        return;
+    }
+};
+
+} // namespace util::data_structure
+
+#endif // FLAT_MAP_HPP
@@ -0,0 +1,61 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Flat sorted map and set test cases.
+ *
+ * A symbol table filled with one batched insert and then only read, the
+ * read-mostly use flat_map is meant for, and a keyword set looked up by
+ * std::string_view through a transparent comparison.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <functional>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <flat_map.hpp>
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+
+    /* ---------------------------------------------- */
+    /* testing a batched insert, sorted and merged    */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mLoading a symbol table in one batch \033[m" << "\n";
+    const std::vector<std::pair<std::string, int>> symbols = {
+        { "printf", 0x1040 }, { "main", 0x1000 }, { "exit", 0x10a0 }, { "malloc", 0x1080 }, { "main", 0xdead }
+    };
+    flat_map<std::string, int, std::less<>> table;
+    table.insert(symbols.begin(), symbols.end());
+    for (const auto& [name, address] : table) {
+        std::cout << name << " -> 0x" << std::hex << address << std::dec << "\n";
+    }
+
+    /* ---------------------------------------------- */
+    /* testing lookups on the key array               */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mLooking up symbols by string_view \033[m" << "\n";
+    for (const std::string_view name : { "malloc", "free" }) {
+        const auto it = table.find(name);
+        std::cout << name << ": " << (it == table.end() ? "undefined" : "defined") << "\n";
+    }
+    std::cout << "symbols from \"m\": " << table.end() - table.lower_bound(std::string_view("m")) << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing flat_set                               */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mKeywords in a flat_set \033[m" << "\n";
+    const flat_set<std::string, std::less<>> keywords{ "while", "if", "return", "else", "if" };
+    for (const std::string& keyword : keywords) {
+        std::cout << keyword << " ";
+    }
+    std::cout << "\n" << "is \"return\" a keyword: " << std::boolalpha << keywords.contains(std::string_view("return")) << "\n";
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
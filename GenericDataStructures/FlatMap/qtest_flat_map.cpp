@@ -0,0 +1,253 @@
+/*****************************************************************//**
+ * \file   qtest_flat_map.cpp
+ * \brief  flat_map<> and flat_set<> test cases with QTest framework.
+ *
+ * Both are checked against std::map and std::set on random single and
+ * batched inserts and erases, batches that are sorted, unsorted and full
+ * of duplicates, so every path of the sort-and-merge is taken.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <random>
+#include <ranges>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include <flat_map.hpp>
+
+/* std::less that counts its calls */
+struct CountingLess
+{
+    static inline std::size_t calls = 0;
+
+    bool operator () (const int lhs, const int rhs) const {
+        ++calls;
+        return lhs < rhs;
+    }
+};
+
+class TestFlatMap : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    void matchesStdMapAndSet() const;
+    void batchInsertKeepsPresentKeys() const;
+    void constructionFromArrays() const;
+    void sortedUniqueInsertMerges() const;
+    void transparentLookup() const;
+    void extractAndReplace() const;
+    void missingKeyThrows() const;
+
+private:
+    static LinearVector<int> make_vec(std::initializer_list<int> values)
+    {
+        LinearVector<int> vec;
+        for (const int value : values) {
+            vec.push_back(value);
+        }
+        return vec;
+    }
+};
+
+void TestFlatMap::matchesStdMapAndSet() const
+{
+    util::data_structure::flat_map<int, int> map;
+    util::data_structure::flat_set<int> set;
+    std::map<int, int> reference;
+    std::set<int> reference_set;
+    std::mt19937 engine(2021);
+
+    qDebug() << "Random single inserts, batches, erases and bounds";
+    bool same = true;
+    for (int step = 0; step < 20000 && same; ++step) {
+        const int key = static_cast<int>(engine() % 3000);
+        switch (engine() % 4) {
+        case 0:
+            same = map.try_emplace(key, step).second == reference.try_emplace(key, step).second
+                && set.insert(key).second == reference_set.insert(key).second;
+            break;
+        case 1: {
+            std::vector<std::pair<int, int>> batch;
+            for (int i = static_cast<int>(engine() % 64); i > 0; --i) {
+                batch.emplace_back(static_cast<int>(engine() % 3000), step);
+            }
+            if (engine() % 2 == 0) {
+                std::sort(batch.begin(), batch.end());
+            }
+            map.insert(batch.begin(), batch.end());
+            reference.insert(batch.begin(), batch.end());
+            for (const auto& element : batch) {
+                set.insert(element.first);
+                reference_set.insert(element.first);
+            }
+            break;
+        }
+        case 2:
+            same = map.erase(key) == reference.erase(key) && set.erase(key) == reference_set.erase(key);
+            break;
+        default: {
+            const auto bound = map.upper_bound(key);
+            const auto expected = reference.upper_bound(key);
+            same = (bound == map.end()) == (expected == reference.end())
+                && (expected == reference.end() || bound->first == expected->first);
+            break;
+        }
+        }
+    }
+    QVERIFY(same);
+    QCOMPARE_EQ(map.size(), reference.size());
+    QVERIFY(std::equal(map.begin(), map.end(), reference.begin(), reference.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first && lhs.second == rhs.second; }));
+    QVERIFY(std::equal(set.begin(), set.end(), reference_set.begin(), reference_set.end()));
+
+    return;
+}
+
+void TestFlatMap::batchInsertKeepsPresentKeys() const
+{
+    util::data_structure::flat_map<int, std::string> map{ { 2, "two" }, { 4, "four" } };
+
+    qDebug() << "Keys already present win, then the first of duplicates in the batch";
+    const std::vector<std::pair<int, std::string>> batch = { { 4, "FOUR" }, { 1, "one" }, { 3, "three" }, { 1, "ONE" } };
+    map.insert(batch.begin(), batch.end());
+    QCOMPARE_EQ(map.size(), 4);
+    QCOMPARE_EQ(map.at(1), "one");
+    QCOMPARE_EQ(map.at(4), "four");
+    QVERIFY(std::is_sorted(map.keys().begin(), map.keys().end()));
+    QCOMPARE_EQ(map.values()[2], "three");
+
+    qDebug() << "Appending past the greatest key keeps the arrays in place";
+    map.reserve(16);
+    const int* const keys_reserved = map.keys().data();
+    map.insert_range(std::vector<std::pair<int, std::string>>{ { 5, "five" }, { 6, "six" } });
+    QVERIFY(map.keys().data() == keys_reserved);
+    QCOMPARE_EQ(map.size(), 6);
+
+    return;
+}
+
+void TestFlatMap::constructionFromArrays() const
+{
+    using util::data_structure::flat_map;
+    using util::data_structure::flat_set;
+    using util::data_structure::sorted_unique;
+
+    qDebug() << "Unsorted arrays are sorted together, keeping the first of equal keys";
+    const flat_map<int, int> map(make_vec({ 3, 1, 3, 2 }), make_vec({ 30, 10, 31, 20 }));
+    QVERIFY(map.keys() == make_vec({ 1, 2, 3 }));
+    QVERIFY(map.values() == make_vec({ 10, 20, 30 }));
+
+    const flat_set<int> set(make_vec({ 5, 1, 5, 3 }));
+    QCOMPARE_EQ(set.size(), 3);
+    QCOMPARE_EQ(*set.begin(), 1);
+
+    qDebug() << "Arrays claimed sorted and unique are checked";
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, (flat_map<int, int>(sorted_unique, make_vec({ 1, 1 }), make_vec({ 0, 0 }))));
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, (flat_set<int>(sorted_unique, make_vec({ 2, 1 }))));
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, (flat_map<int, int>(make_vec({ 1, 2 }), make_vec({ 0 }))));
+
+    return;
+}
+
+void TestFlatMap::sortedUniqueInsertMerges() const
+{
+    using util::data_structure::flat_map;
+    using util::data_structure::flat_set;
+    using util::data_structure::sorted_unique;
+
+    qDebug() << "Sorted input interleaved with the present keys is merged in one linear pass";
+    flat_set<int, CountingLess> set;
+    flat_map<int, int, CountingLess> map;
+    std::vector<int> odd;
+    std::vector<std::pair<int, int>> odd_pairs;
+    for (int i = 0; i < 1000; ++i) {
+        set.insert(2 * i);
+        map.try_emplace(2 * i, i);
+        odd.push_back(2 * i + 1);
+        odd_pairs.emplace_back(2 * i + 1, i);
+    }
+    /* one comparison to find the order broken, then at most two for each element merged */
+    const std::size_t linear = 2 * 2000 + 1;
+
+    CountingLess::calls = 0;
+    set.insert(sorted_unique, odd.begin(), odd.end());
+    QVERIFY(CountingLess::calls <= linear);
+    CountingLess::calls = 0;
+    map.insert(sorted_unique, odd_pairs.begin(), odd_pairs.end());
+    QVERIFY(CountingLess::calls <= linear);
+
+    QCOMPARE_EQ(set.size(), 2000);
+    QCOMPARE_EQ(map.size(), 2000);
+    QVERIFY(std::ranges::equal(set, std::views::iota(0, 2000)));
+    QCOMPARE_EQ(map.at(1999), 999);
+    QCOMPARE_EQ(map.at(1998), 999);
+
+    return;
+}
+
+void TestFlatMap::transparentLookup() const
+{
+    util::data_structure::flat_map<std::string, int, std::less<>> symbols{ { "main", 0 }, { "exit", 1 }, { "printf", 2 } };
+    util::data_structure::flat_set<std::string, std::less<>> keywords{ "if", "else", "while" };
+
+    qDebug() << "Lookup by string_view without building a std::string";
+    const std::string_view name = "printf";
+    QVERIFY(symbols.contains(name));
+    QCOMPARE_EQ(symbols.find(name)->second, 2);
+    QCOMPARE_EQ(symbols.lower_bound(std::string_view("f"))->first, "main");
+    QVERIFY(keywords.contains(std::string_view("else")));
+    QVERIFY(!keywords.contains(std::string_view("for")));
+
+    return;
+}
+
+void TestFlatMap::extractAndReplace() const
+{
+    util::data_structure::flat_map<int, int> map{ { 1, 10 }, { 2, 20 } };
+
+    qDebug() << "extract() hands out both arrays and leaves the map empty";
+    auto [keys, values] = std::move(map).extract();
+    QVERIFY(map.empty());
+    QCOMPARE_EQ(keys.size(), 2);
+
+    qDebug() << "replace() takes them back";
+    values[1] = 21;
+    map.replace(std::move(keys), std::move(values));
+    QCOMPARE_EQ(map.at(2), 21);
+
+    return;
+}
+
+void TestFlatMap::missingKeyThrows() const
+{
+    util::data_structure::flat_map<int, int> map;
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, map.at(1));
+    map[1] = 1;
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, map.at(2));
+    QCOMPARE_EQ(map.erase(2), 0);
+
+    return;
+}
+
+QTEST_MAIN(TestFlatMap)
+#include "qtest_flat_map.moc"
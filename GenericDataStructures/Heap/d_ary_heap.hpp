@@ -0,0 +1,393 @@
+/*****************************************************************//**
+ * \file   d_ary_heap.hpp
+ * \brief  Implicit d-ary heaps stored in LinearVector.
+ *
+ * With Arity children per node the heap is log(Arity) times shallower
+ * than a binary heap, and the children of a node are adjacent: for 4 or 8
+ * small elements a sift-down step compares children already on one or two
+ * cache lines instead of missing the cache once per level. Elements are
+ * moved through a hole rather than swapped.
+ *
+ * d_ary_heap has the interface of std::priority_queue: with std::less the
+ * largest element is on top. indexed_d_ary_heap stores dense integer ids
+ * with a priority each and tracks where every id sits, so the priority of
+ * a queued id can be improved in place with decrease_key, as Dijkstra's
+ * algorithm does; with its default std::greater the smallest priority is
+ * on top.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef D_ARY_HEAP_HPP
+#define D_ARY_HEAP_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+#include "../LinearVector/linear_vector.hpp"
+
+namespace util::data_structure {
+
+template<typename _Elem, std::size_t _Arity = 4, typename _Compare = std::less<_Elem>, typename _Container = LinearVector<_Elem>>
+requires (_Arity >= 2)
+class d_ary_heap {
+public:
+    using container_type = _Container;
+    using value_compare = _Compare;
+    using value_type = typename _Container::value_type;
+    using size_type = typename _Container::size_type;
+    using const_reference = typename _Container::const_reference;
+
+    static constexpr std::size_t arity = _Arity;
+
+    /* default constructor */
+    d_ary_heap() = default;
+
+    explicit d_ary_heap(const _Compare& compare) : comp(compare) {}
+
+    /* initialization from a range in O(n) */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    d_ary_heap(_InputIt first, _Sentinel last, const _Compare& compare = _Compare()) : comp(compare) {
+        push_range(std::ranges::subrange(std::move(first), std::move(last)));
+    }
+
+    /* the element that compares greatest, throws std::out_of_range on an empty heap */
+    const_reference top() const {
+        if (c.empty()) {
+            throw_empty();
+        }
+        return c.data()[0];
+    }
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return c.empty(); }
+    size_type size() const { return c.size(); }
+    void reserve(const size_type capacity) { c.reserve(capacity); }
+
+    /* modifiers */
+    void push(const value_type& value) { emplace(value); }
+    void push(value_type&& value) { emplace(std::move(value)); }
+
+    template<typename... _Args>
+    void emplace(_Args&&... args) {
+        c.emplace_back(std::forward<_Args>(args)...);
+        sift_up(c.size() - 1);
+        return;
+    }
+
+    /*
+     * Append every element of the range, then restore the heap: by sifting
+     * each new element up when few are added, or by one bottom-up heapify
+     * in O(size()) when the range is large compared to the heap.
+     */
+    template<std::ranges::input_range _Range>
+    requires std::convertible_to<std::ranges::range_reference_t<_Range>, value_type>
+    void push_range(_Range&& range) {
+        if constexpr (std::ranges::sized_range<_Range>) {
+            c.reserve(c.size() + static_cast<size_type>(std::ranges::size(range)));
+        }
+        const size_type old_size = c.size();
+        for (auto&& value : range) {
+            c.emplace_back(std::forward<decltype(value)>(value));
+        }
+        const size_type added = c.size() - old_size;
+        if (added == 0) {
+            return;
+        }
+        /* sifting k elements up costs about k log(n), heapify about 2n comparisons */
+        if (added * depth(c.size()) < 2 * c.size()) {
+            for (size_type i = old_size; i < c.size(); ++i) {
+                sift_up(i);
+            }
+        }
+        else {
+            heapify();
+        }
+        return;
+    }
+
+    /* remove the top element, throws std::out_of_range on an empty heap */
+    void pop() {
+        if (c.empty()) {
+            throw_empty();
+        }
+        value_type last = std::move(c.data()[c.size() - 1]);
+        c.pop_back();
+        if (!c.empty()) {
+            sift_down(0, std::move(last));
+        }
+        return;
+    }
+
+    void clear() { c.clear(); }
+
+    /* restore the heap property over the whole container bottom-up in O(n) */
+    void heapify() {
+        const size_type n = c.size();
+        if (n < 2) {
+            return;
+        }
+        for (size_type i = (n - 2) / _Arity + 1; i-- > 0;) {
+            sift_down(i, std::move(c.data()[i]));
+        }
+        return;
+    }
+
+private:
+    _Container c;
+    [[no_unique_address]] _Compare comp;
+
+    [[noreturn]] static void throw_empty() {
+        throw std::out_of_range("heap is empty");
+    }
+
+    /* number of levels below the root of a heap with n elements */
+    static size_type depth(size_type n) {
+        size_type levels = 1;
+        while (n > _Arity) {
+            n /= _Arity;
+            ++levels;
+        }
+        return levels;
+    }
+
+    void sift_up(size_type hole) {
+        value_type* const data = c.data();
+        value_type value = std::move(data[hole]);
+        while (hole > 0) {
+            const size_type parent = (hole - 1) / _Arity;
+            if (!comp(data[parent], value)) {
+                break;
+            }
+            data[hole] = std::move(data[parent]);
+            hole = parent;
+        }
+        data[hole] = std::move(value);
+        return;
+    }
+
+    /* fill the hole with value, moving the greatest child up while it beats value */
+    void sift_down(size_type hole, value_type value) {
+        value_type* const data = c.data();
+        const size_type n = c.size();
+        for (;;) {
+            const size_type first = hole * _Arity + 1;
+            if (first >= n) {
+                break;
+            }
+            const size_type last = std::min(first + _Arity, n);
+            size_type best = first;
+            for (size_type child = first + 1; child < last; ++child) {
+                if (comp(data[best], data[child])) {
+                    best = child;
+                }
+            }
+            if (!comp(value, data[best])) {
+                break;
+            }
+            data[hole] = std::move(data[best]);
+            hole = best;
+        }
+        data[hole] = std::move(value);
+        return;
+    }
+};
+
+/* d-ary heap of dense ids 0, 1, 2, ... with a priority each and decrease_key */
+template<typename _Priority, std::size_t _Arity = 4, typename _Compare = std::greater<_Priority>>
+requires (_Arity >= 2)
+class indexed_d_ary_heap {
+public:
+    using priority_type = _Priority;
+    using size_type = std::size_t;
+    using id_type = std::size_t;
+
+    static constexpr std::size_t arity = _Arity;
+
+    /* default constructor */
+    indexed_d_ary_heap() = default;
+
+    /* ids below id_capacity are accepted without growing the position table */
+    explicit indexed_d_ary_heap(const size_type id_capacity, const _Compare& compare = _Compare()) : comp(compare) {
+        positions.reserve(id_capacity);
+        for (size_type id = 0; id < id_capacity; ++id) {
+            positions.push_back(npos);
+        }
+    }
+
+    /* the id on top and its priority, throw std::out_of_range on an empty heap */
+    id_type top() const {
+        if (heap.empty()) {
+            throw_empty();
+        }
+        return heap.data()[0].id;
+    }
+
+    const priority_type& top_priority() const {
+        if (heap.empty()) {
+            throw_empty();
+        }
+        return heap.data()[0].priority;
+    }
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return heap.empty(); }
+    size_type size() const { return heap.size(); }
+
+    bool contains(const id_type id) const {
+        return id < positions.size() && positions.data()[id] != npos;
+    }
+
+    /* priority of a queued id, throws std::out_of_range if it is not queued */
+    const priority_type& priority(const id_type id) const {
+        return heap.data()[position_of(id)].priority;
+    }
+
+    /* queue an id that is not queued yet, throws std::invalid_argument otherwise */
+    void push(const id_type id, priority_type priority) {
+        while (positions.size() <= id) {
+            positions.push_back(npos);
+        }
+        if (positions.data()[id] != npos) {
+            throw std::invalid_argument("id is already queued");
+        }
+        heap.push_back(entry{ std::move(priority), id });
+        positions.data()[id] = heap.size() - 1;
+        sift_up(heap.size() - 1);
+        return;
+    }
+
+    /*
+     * Move a queued id towards the top with a priority that does not compare
+     * worse than its current one (a smaller one for the default std::greater);
+     * throws std::out_of_range if the id is not queued and std::invalid_argument
+     * if the new priority is worse.
+     */
+    void decrease_key(const id_type id, priority_type priority) {
+        const size_type position = position_of(id);
+        entry* const data = heap.data();
+        if (comp(priority, data[position].priority)) {
+            throw std::invalid_argument("priority would move the id away from the top");
+        }
+        data[position].priority = std::move(priority);
+        sift_up(position);
+        return;
+    }
+
+    /* push the id, or decrease its key when the new priority is better; false if neither */
+    bool push_or_decrease(const id_type id, priority_type priority) {
+        if (!contains(id)) {
+            push(id, std::move(priority));
+            return true;
+        }
+        if (!comp(heap.data()[positions.data()[id]].priority, priority)) {
+            return false;
+        }
+        decrease_key(id, std::move(priority));
+        return true;
+    }
+
+    /* remove the top id, throws std::out_of_range on an empty heap */
+    void pop() {
+        if (heap.empty()) {
+            throw_empty();
+        }
+        entry last = std::move(heap.data()[heap.size() - 1]);
+        heap.pop_back();
+        positions.data()[heap.empty() ? last.id : heap.data()[0].id] = npos;
+        if (!heap.empty()) {
+            sift_down(0, std::move(last));
+        }
+        return;
+    }
+
+    void clear() {
+        for (const entry& queued : heap) {
+            positions.data()[queued.id] = npos;
+        }
+        heap.clear();
+        return;
+    }
+
+private:
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    /* priority and id together, so comparisons never leave the heap array */
+    struct entry {
+        priority_type priority;
+        id_type id;
+    };
+
+    LinearVector<entry> heap;
+    LinearVector<size_type> positions;
+    [[no_unique_address]] _Compare comp;
+
+    [[noreturn]] static void throw_empty() {
+        throw std::out_of_range("heap is empty");
+    }
+
+    size_type position_of(const id_type id) const {
+        if (!contains(id)) {
+            throw std::out_of_range("id is not queued");
+        }
+        return positions.data()[id];
+    }
+
+    void place(const size_type position, entry value) {
+        positions.data()[value.id] = position;
+        heap.data()[position] = std::move(value);
+        return;
+    }
+
+    void sift_up(size_type hole) {
+        entry* const data = heap.data();
+        entry value = std::move(data[hole]);
+        while (hole > 0) {
+            const size_type parent = (hole - 1) / _Arity;
+            if (!comp(data[parent].priority, value.priority)) {
+                break;
+            }
+            place(hole, std::move(data[parent]));
+            hole = parent;
+        }
+        place(hole, std::move(value));
+        return;
+    }
+
+    void sift_down(size_type hole, entry value) {
+        entry* const data = heap.data();
+        const size_type n = heap.size();
+        for (;;) {
+            const size_type first = hole * _Arity + 1;
+            if (first >= n) {
+                break;
+            }
+            const size_type last = std::min(first + _Arity, n);
+            size_type best = first;
+            for (size_type child = first + 1; child < last; ++child) {
+                if (comp(data[best].priority, data[child].priority)) {
+                    best = child;
+                }
+            }
+            if (!comp(value.priority, data[best].priority)) {
+                break;
+            }
+            place(hole, std::move(data[best]));
+            hole = best;
+        }
+        place(hole, std::move(value));
+        return;
+    }
+};
+
+} // namespace util::data_structure
+
+#endif // D_ARY_HEAP_HPP
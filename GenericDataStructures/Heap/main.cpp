@@ -0,0 +1,78 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Heap and priority queue test cases.
+ *
+ * Dijkstra's shortest paths with indexed_d_ary_heap<>::push_or_decrease,
+ * and two task queues melded into one with pairing_heap<>.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <string>
+#include <utility>
+
+#include <d_ary_heap.hpp>
+#include <pairing_heap.hpp>
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+
+    /* ---------------------------------------------- */
+    /* testing Dijkstra's algorithm with decrease_key */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mShortest distances from vertex 0 \033[m" << "\n";
+    struct edge { std::size_t to; std::int64_t weight; };
+    const std::array<std::array<edge, 2>, 5> graph = { {
+        { { { 1, 10 }, { 2, 3 } } },
+        { { { 3, 2 }, { 4, 1 } } },
+        { { { 1, 4 }, { 3, 8 } } },
+        { { { 4, 7 }, { 4, 7 } } },
+        { { { 0, 1 }, { 0, 1 } } },
+    } };
+    std::array<std::int64_t, 5> distance{};
+    distance.fill(std::numeric_limits<std::int64_t>::max());
+    distance[0] = 0;
+    indexed_d_ary_heap<std::int64_t, 4> frontier(graph.size());
+    frontier.push(0, 0);
+    while (!frontier.empty()) {
+        const std::size_t vertex = frontier.top();
+        frontier.pop();
+        for (const edge& e : graph[vertex]) {
+            const std::int64_t through = distance[vertex] + e.weight;
+            if (through < distance[e.to]) {
+                distance[e.to] = through;
+                frontier.push_or_decrease(e.to, through);
+            }
+        }
+    }
+    for (std::size_t vertex = 0; vertex < distance.size(); ++vertex) {
+        std::cout << vertex << " -> " << distance[vertex] << "\n";
+    }
+
+    /* --------------------------------------------------- */
+    /* testing pairing_heap<> meld and handle decrease_key */
+    /* --------------------------------------------------- */
+    std::cout << "\033[32mMelding two task queues \033[m" << "\n";
+    using task = std::pair<int, std::string>;
+    pairing_heap<task> urgent;
+    pairing_heap<task> background;
+    urgent.emplace(7, "reply to review");
+    urgent.emplace(9, "fix the build");
+    const auto backup = background.emplace(1, "back up the disk");
+    background.emplace(2, "rotate logs");
+    urgent.meld(background);
+    urgent.decrease_key(backup, task{ 8, "back up the disk" });
+    while (!urgent.empty()) {
+        std::cout << urgent.top().first << " " << urgent.top().second << "\n";
+        urgent.pop();
+    }
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
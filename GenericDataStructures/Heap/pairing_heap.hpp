@@ -0,0 +1,262 @@
+/*****************************************************************//**
+ * \file   pairing_heap.hpp
+ * \brief  Pairing heap with O(1) meld and decrease_key through handles.
+ *
+ * A heap-ordered multiway tree of individually allocated nodes: push,
+ * meld and decrease_key link two trees in O(1), and pop pairs up the
+ * children of the root left to right and folds the pairs right to left,
+ * O(log n) amortised. Unlike an implicit heap its nodes never move, so
+ * push returns a handle that stays valid until that element is popped,
+ * and two heaps meld without copying elements.
+ *
+ * As for std::priority_queue, with std::less the largest element is on
+ * top, so decrease_key raises an element towards the top.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef PAIRING_HEAP_HPP
+#define PAIRING_HEAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace util::data_structure {
+
+template<typename _Elem, typename _Compare = std::less<_Elem>>
+class pairing_heap {
+public:
+    using value_type = _Elem;
+    using value_compare = _Compare;
+    using size_type = std::size_t;
+    using const_reference = const _Elem&;
+
+private:
+    /* prev is the parent of a leftmost child, otherwise the left sibling */
+    struct node {
+        value_type value;
+        node* child = nullptr;
+        node* sibling = nullptr;
+        node* prev = nullptr;
+    };
+
+public:
+    /* refers to one pushed element until it is popped */
+    class handle {
+    public:
+        handle() = default;
+        const_reference operator * () const { return target->value; }
+        const _Elem* operator -> () const { return &target->value; }
+        friend bool operator == (const handle&, const handle&) = default;
+
+    private:
+        friend class pairing_heap;
+        explicit handle(node* const n) : target(n) {}
+        node* target = nullptr;
+    };
+
+    /* default constructor */
+    pairing_heap() = default;
+
+    explicit pairing_heap(const _Compare& compare) : comp(compare) {}
+
+    /* heaps own their nodes and are moved, never copied */
+    pairing_heap(const pairing_heap&) = delete;
+    pairing_heap& operator = (const pairing_heap&) = delete;
+
+    /* the moved-from heap is left empty */
+    pairing_heap(pairing_heap&& other) noexcept
+        : root(std::exchange(other.root, nullptr))
+        , count(std::exchange(other.count, 0))
+        , comp(other.comp) {}
+
+    pairing_heap& operator = (pairing_heap&& other) noexcept {
+        if (this != &other) {
+            clear();
+            root = std::exchange(other.root, nullptr);
+            count = std::exchange(other.count, 0);
+            comp = other.comp;
+        }
+        return *this;
+    }
+
+    ~pairing_heap() { clear(); }
+
+    /* the element that compares greatest, throws std::out_of_range on an empty heap */
+    const_reference top() const {
+        if (root == nullptr) {
+            throw_empty();
+        }
+        return root->value;
+    }
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return count == 0; }
+    size_type size() const { return count; }
+
+    /* modifiers */
+    handle push(const value_type& value) { return emplace(value); }
+    handle push(value_type&& value) { return emplace(std::move(value)); }
+
+    template<typename... _Args>
+    handle emplace(_Args&&... args) {
+        node* const n = new node{ value_type(std::forward<_Args>(args)...) };
+        root = root == nullptr ? n : link(root, n);
+        ++count;
+        return handle(n);
+    }
+
+    /* remove the top element, throws std::out_of_range on an empty heap */
+    void pop() {
+        if (root == nullptr) {
+            throw_empty();
+        }
+        node* const old_root = root;
+        root = merge_pairs(old_root->child);
+        delete old_root;
+        --count;
+        return;
+    }
+
+    /*
+     * Raise the element of handle h to value, which must not compare less
+     * than its current value; throws std::invalid_argument otherwise. The
+     * element's subtree is cut off and linked with the root in O(1).
+     */
+    void decrease_key(const handle h, value_type value) {
+        node* const n = h.target;
+        if (comp(value, n->value)) {
+            throw std::invalid_argument("value would move the element away from the top");
+        }
+        n->value = std::move(value);
+        if (n == root) {
+            return;
+        }
+        detach(n);
+        root = link(root, n);
+        return;
+    }
+
+    /* move every element of other into this heap in O(1); handles into other stay valid */
+    void meld(pairing_heap& other) {
+        if (this == &other || other.root == nullptr) {
+            return;
+        }
+        root = root == nullptr ? other.root : link(root, other.root);
+        count += std::exchange(other.count, 0);
+        other.root = nullptr;
+        return;
+    }
+
+    void meld(pairing_heap&& other) { meld(other); }
+
+    /* delete every node without recursion, by splicing each child list into the sibling chain */
+    void clear() {
+        node* n = root;
+        while (n != nullptr) {
+            if (n->child != nullptr) {
+                node* last = n->child;
+                while (last->sibling != nullptr) {
+                    last = last->sibling;
+                }
+                last->sibling = n->sibling;
+                n->sibling = n->child;
+            }
+            node* const next = n->sibling;
+            delete n;
+            n = next;
+        }
+        root = nullptr;
+        count = 0;
+        return;
+    }
+
+    void swap(pairing_heap& other) noexcept {
+        std::swap(root, other.root);
+        std::swap(count, other.count);
+        std::swap(comp, other.comp);
+        return;
+    }
+
+private:
+    node* root = nullptr;
+    size_type count = 0;
+    [[no_unique_address]] _Compare comp;
+
+    [[noreturn]] static void throw_empty() {
+        throw std::out_of_range("heap is empty");
+    }
+
+    /* make the lesser of two roots the leftmost child of the other */
+    node* link(node* a, node* b) {
+        if (comp(a->value, b->value)) {
+            std::swap(a, b);
+        }
+        b->prev = a;
+        b->sibling = a->child;
+        if (a->child != nullptr) {
+            a->child->prev = b;
+        }
+        a->child = b;
+        return a;
+    }
+
+    /* unlink n and its subtree from its parent's child list */
+    static void detach(node* const n) {
+        if (n->prev->child == n) {
+            n->prev->child = n->sibling;
+        }
+        else {
+            n->prev->sibling = n->sibling;
+        }
+        if (n->sibling != nullptr) {
+            n->sibling->prev = n->prev;
+        }
+        n->sibling = nullptr;
+        n->prev = nullptr;
+        return;
+    }
+
+    /* two-pass pairing of a child list, iterative so deep heaps cannot overflow the stack */
+    node* merge_pairs(node* first) {
+        if (first == nullptr) {
+            return nullptr;
+        }
+        /* left to right: link neighbours, collecting the pairs in reverse through sibling */
+        node* pairs = nullptr;
+        while (first != nullptr) {
+            node* const a = first;
+            node* const b = a->sibling;
+            if (b == nullptr) {
+                a->sibling = pairs;
+                pairs = a;
+                break;
+            }
+            first = b->sibling;
+            a->sibling = nullptr;
+            b->sibling = nullptr;
+            node* const pair = link(a, b);
+            pair->sibling = pairs;
+            pairs = pair;
+        }
+        /* right to left: fold the pairs into one tree */
+        node* result = pairs;
+        pairs = pairs->sibling;
+        result->sibling = nullptr;
+        while (pairs != nullptr) {
+            node* const next = pairs->sibling;
+            pairs->sibling = nullptr;
+            result = link(result, pairs);
+            pairs = next;
+        }
+        result->prev = nullptr;
+        return result;
+    }
+};
+
+} // namespace util::data_structure
+
+#endif // PAIRING_HEAP_HPP
@@ -0,0 +1,246 @@
+/*****************************************************************//**
+ * \file   qtest_heap.cpp
+ * \brief  d_ary_heap<>, indexed_d_ary_heap<> and pairing_heap<> test
+ *         cases with QTest framework.
+ *
+ * Every heap is checked against std::priority_queue on the same random
+ * sequence of operations.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include <d_ary_heap.hpp>
+#include <pairing_heap.hpp>
+
+class TestHeap : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    /* d_ary_heap<> */
+    void dAryHeapMatchesPriorityQueue() const;
+    void dAryHeapPushRangeAndHeapify() const;
+
+    /* indexed_d_ary_heap<> */
+    void indexedHeapDecreaseKey() const;
+
+    /* pairing_heap<> */
+    void pairingHeapMatchesPriorityQueue() const;
+    void pairingHeapDecreaseKeyAndMeld() const;
+
+    /* all */
+    void emptyHeapThrows() const;
+
+private:
+    /* push and pop in random order, comparing every top with std::priority_queue */
+    template<typename Heap>
+    static bool matchesPriorityQueue(Heap& heap, unsigned seed);
+};
+
+template<typename Heap>
+bool TestHeap::matchesPriorityQueue(Heap& heap, const unsigned seed)
+{
+    std::mt19937 engine(seed);
+    std::priority_queue<int> reference;
+    for (int step = 0; step < 20000; ++step) {
+        if (reference.empty() || engine() % 3 != 0) {
+            const int value = static_cast<int>(engine() % 1000);
+            heap.push(value);
+            reference.push(value);
+        }
+        else {
+            if (heap.top() != reference.top()) {
+                return false;
+            }
+            heap.pop();
+            reference.pop();
+        }
+        if (heap.size() != reference.size()) {
+            return false;
+        }
+    }
+    while (!reference.empty()) {
+        if (heap.top() != reference.top()) {
+            return false;
+        }
+        heap.pop();
+        reference.pop();
+    }
+    return heap.empty();
+}
+
+void TestHeap::dAryHeapMatchesPriorityQueue() const
+{
+    using util::data_structure::d_ary_heap;
+
+    qDebug() << "Arity 2, 4 and 8 against std::priority_queue";
+    d_ary_heap<int, 2> binary;
+    d_ary_heap<int, 4> quaternary;
+    d_ary_heap<int, 8> octonary;
+    QVERIFY(matchesPriorityQueue(binary, 1));
+    QVERIFY(matchesPriorityQueue(quaternary, 2));
+    QVERIFY(matchesPriorityQueue(octonary, 3));
+
+    qDebug() << "std::greater puts the smallest element on top";
+    d_ary_heap<std::string, 4, std::greater<std::string>> words;
+    for (const char* word : { "pear", "apple", "fig", "banana" }) {
+        words.emplace(word);
+    }
+    QCOMPARE(words.top(), std::string("apple"));
+
+    return;
+}
+
+void TestHeap::dAryHeapPushRangeAndHeapify() const
+{
+    using util::data_structure::d_ary_heap;
+
+    std::mt19937 engine(4);
+    std::vector<int> values(5000);
+    for (int& value : values) {
+        value = static_cast<int>(engine() % 100000);
+    }
+
+    qDebug() << "Construction from a range heapifies";
+    d_ary_heap<int, 4> heap(values.begin(), values.end());
+    QCOMPARE_EQ(heap.size(), values.size());
+
+    qDebug() << "A small range is sifted up, a large one heapified";
+    heap.push_range(std::vector<int>{ 100001, -1, 50 });
+    heap.push_range(values);
+    std::vector<int> expected = values;
+    expected.insert(expected.end(), values.begin(), values.end());
+    expected.insert(expected.end(), { 100001, -1, 50 });
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    bool sorted = heap.size() == expected.size();
+    for (std::size_t i = 0; sorted && i < expected.size(); ++i) {
+        sorted = heap.top() == expected[i];
+        heap.pop();
+    }
+    QVERIFY(sorted);
+    QVERIFY(heap.empty());
+
+    return;
+}
+
+void TestHeap::indexedHeapDecreaseKey() const
+{
+    using util::data_structure::indexed_d_ary_heap;
+
+    qDebug() << "The smallest priority is on top";
+    indexed_d_ary_heap<int> heap(4);
+    heap.push(0, 40);
+    heap.push(1, 10);
+    heap.push(2, 30);
+    heap.push(7, 20);
+    QCOMPARE_EQ(heap.top(), 1);
+    QVERIFY(heap.contains(7) && !heap.contains(3));
+
+    qDebug() << "decrease_key moves an id to the top";
+    heap.decrease_key(0, 5);
+    QCOMPARE_EQ(heap.top(), 0);
+    QCOMPARE_EQ(heap.top_priority(), 5);
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, heap.decrease_key(2, 35));
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, heap.push(2, 1));
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, heap.decrease_key(3, 1));
+
+    qDebug() << "push_or_decrease only ever improves a priority";
+    QVERIFY(!heap.push_or_decrease(2, 31));
+    QVERIFY(heap.push_or_decrease(2, 15));
+    QVERIFY(heap.push_or_decrease(3, 12));
+
+    qDebug() << "Ids pop in priority order and leave the heap";
+    std::vector<std::size_t> order;
+    while (!heap.empty()) {
+        order.push_back(heap.top());
+        heap.pop();
+    }
+    QVERIFY((order == std::vector<std::size_t>{ 0, 1, 3, 2, 7 }));
+    QVERIFY(!heap.contains(0));
+
+    return;
+}
+
+void TestHeap::pairingHeapMatchesPriorityQueue() const
+{
+    util::data_structure::pairing_heap<int> heap;
+    QVERIFY(matchesPriorityQueue(heap, 5));
+
+    return;
+}
+
+void TestHeap::pairingHeapDecreaseKeyAndMeld() const
+{
+    using util::data_structure::pairing_heap;
+
+    qDebug() << "decrease_key raises an element through its handle";
+    pairing_heap<int> heap;
+    std::vector<pairing_heap<int>::handle> handles;
+    for (int value = 0; value < 100; ++value) {
+        handles.push_back(heap.push(value));
+    }
+    heap.pop();
+    heap.decrease_key(handles[10], 500);
+    QCOMPARE_EQ(heap.top(), 500);
+    QCOMPARE_EQ(*handles[10], 500);
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, heap.decrease_key(handles[20], 0));
+
+    qDebug() << "meld takes every element of the other heap";
+    pairing_heap<int> other;
+    const auto moved = other.push(1000);
+    other.push(-5);
+    heap.meld(other);
+    QVERIFY(other.empty());
+    QCOMPARE_EQ(heap.size(), 101);
+    QCOMPARE_EQ(heap.top(), 1000);
+    heap.decrease_key(moved, 2000);
+    QCOMPARE_EQ(heap.top(), 2000);
+
+    qDebug() << "Elements pop in order after both";
+    int previous = heap.top();
+    bool ordered = true;
+    while (!heap.empty()) {
+        ordered = ordered && heap.top() <= previous;
+        previous = heap.top();
+        heap.pop();
+    }
+    QVERIFY(ordered);
+
+    return;
+}
+
+void TestHeap::emptyHeapThrows() const
+{
+    util::data_structure::d_ary_heap<int> d_ary;
+    util::data_structure::indexed_d_ary_heap<int> indexed;
+    util::data_structure::pairing_heap<int> pairing;
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, d_ary.top());
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, d_ary.pop());
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, indexed.top());
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, indexed.pop());
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, pairing.top());
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, pairing.pop());
+
+    return;
+}
+
+QTEST_MAIN(TestHeap)
+#include "qtest_heap.moc"
@@ -0,0 +1,21 @@
+######################################################################
+# Instrumentation and hardware counter test cases with QTest framework
+######################################################################
+
+QT += core testlib
+TEMPLATE = app
+TARGET = Instrumentation
+INCLUDEPATH += .
+QMAKE_CXXFLAGS += -std=c++23 -Wall -Wextra -pedantic
+DEFINES += GDS_INSTRUMENTATION
+
+# You can make your code fail to compile if you use deprecated APIs.
+# In order to do so, uncomment the following line.
+# Please consult the documentation of the deprecated API in order to know
+# how to port your code away from it.
+# You can also select to disable deprecated APIs only up to a certain version of Qt.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+# Input
+HEADERS += instrumentation.hpp perf_counters.hpp ../LinkedList/node.hpp ../DoubleLinkedList/denode.hpp ../LinearVector/linear_vector.hpp
+SOURCES += qtest_instrumentation.cpp
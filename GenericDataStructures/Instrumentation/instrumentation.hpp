@@ -0,0 +1,178 @@
+/*****************************************************************//**
+ * \file   instrumentation.hpp
+ * \brief  Opt-in counters of allocations and element operations.
+ *
+ * node, denode and LinearVector report what they do through record():
+ * allocations and bytes, reallocations, traversal steps from one node to
+ * the next, and elements copied or moved. Counters are kept per structure
+ * as process-wide relaxed atomics, read as a snapshot and written as JSON,
+ * so a running program can show where its memory and time go without a
+ * profiler attached.
+ *
+ * Instrumentation is off unless GDS_INSTRUMENTATION is defined before the
+ * first include, for the whole program. When off, record() has an empty
+ * body that inlines away and no counters exist; take_snapshot() returns
+ * zeros and the JSON says "enabled": false. record() is constexpr and
+ * counts nothing during constant evaluation.
+ *
+ * The C hash tables keep counters of their own, see
+ * "../../DataStructures/HashTable/table_stats.h".
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+#ifdef GDS_INSTRUMENTATION
+#include <atomic>
+#endif
+
+namespace util::instrumentation {
+
+#ifdef GDS_INSTRUMENTATION
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+/* the structures that report */
+enum class structure : std::size_t {
+    node,
+    denode,
+    linear_vector,
+};
+
+inline constexpr std::size_t structure_count = 3;
+inline constexpr std::array<std::string_view, structure_count> structure_names = {
+    "node", "denode", "linear_vector"
+};
+
+/* what they report */
+enum class event : std::size_t {
+    allocations,
+    deallocations,
+    bytes_allocated,
+    bytes_deallocated,
+    reallocations,      /* LinearVector blocks replaced by a larger one */
+    traversal_steps,    /* links followed from one node to the next or previous */
+    copies,             /* elements copied by the structure, constructed or assigned */
+    moves,              /* elements moved by the structure, constructed or assigned */
+};
+
+inline constexpr std::size_t event_count = 8;
+inline constexpr std::array<std::string_view, event_count> event_names = {
+    "allocations", "deallocations", "bytes_allocated", "bytes_deallocated",
+    "reallocations", "traversal_steps", "copies", "moves"
+};
+
+/* counter values at one point in time */
+struct snapshot {
+    std::array<std::array<std::uint64_t, event_count>, structure_count> counts{};
+
+    constexpr std::uint64_t operator () (const structure s, const event e) const {
+        return counts[static_cast<std::size_t>(s)][static_cast<std::size_t>(e)];
+    }
+
+    /* the counts from earlier to this snapshot */
+    friend constexpr snapshot operator - (const snapshot& later, const snapshot& earlier) {
+        snapshot difference;
+        for (std::size_t s = 0; s < structure_count; ++s) {
+            for (std::size_t e = 0; e < event_count; ++e) {
+                difference.counts[s][e] = later.counts[s][e] - earlier.counts[s][e];
+            }
+        }
+        return difference;
+    }
+};
+
+#ifdef GDS_INSTRUMENTATION
+namespace detail {
+inline std::array<std::array<std::atomic<std::uint64_t>, event_count>, structure_count> counters{};
+} // namespace detail
+#endif
+
+/* add n to the counter of e for s; nothing unless GDS_INSTRUMENTATION is defined */
+constexpr void record([[maybe_unused]] const structure s, [[maybe_unused]] const event e,
+                      [[maybe_unused]] const std::uint64_t n = 1) noexcept {
+#ifdef GDS_INSTRUMENTATION
+    if !consteval {
+        detail::counters[static_cast<std::size_t>(s)][static_cast<std::size_t>(e)].fetch_add(n, std::memory_order_relaxed);
+    }
+#endif
+    return;
+}
+
+/* one element constructed from an argument forwarded as _Arg&&: a move from a non-const _Elem rvalue, a copy from any other _Elem */
+template<typename _Elem, typename _Arg>
+constexpr void record_construction_from(const structure s) noexcept {
+    if constexpr (std::is_same_v<std::remove_cvref_t<_Arg>, _Elem>) {
+        if constexpr (!std::is_lvalue_reference_v<_Arg> && !std::is_const_v<std::remove_reference_t<_Arg>>) {
+            record(s, event::moves);
+        }
+        else {
+            record(s, event::copies);
+        }
+    }
+    return;
+}
+
+/* one element constructed from args, a copy or a move only if args is a single _Elem */
+template<typename _Elem, typename... _Args>
+constexpr void record_construction(const structure s) noexcept {
+    if constexpr (sizeof...(_Args) == 1) {
+        (record_construction_from<_Elem, _Args>(s), ...);
+    }
+    return;
+}
+
+/* the counters now */
+inline snapshot take_snapshot() noexcept {
+    snapshot result;
+#ifdef GDS_INSTRUMENTATION
+    for (std::size_t s = 0; s < structure_count; ++s) {
+        for (std::size_t e = 0; e < event_count; ++e) {
+            result.counts[s][e] = detail::counters[s][e].load(std::memory_order_relaxed);
+        }
+    }
+#endif
+    return result;
+}
+
+/* set every counter back to zero */
+inline void reset() noexcept {
+#ifdef GDS_INSTRUMENTATION
+    for (auto& events : detail::counters) {
+        for (auto& counter : events) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+#endif
+    return;
+}
+
+/* {"enabled": true, "node": {"allocations": 3, ...}, "denode": {...}, "linear_vector": {...}} */
+inline void write_json(std::ostream& out, const snapshot& counts = take_snapshot()) {
+    out << "{\n  \"enabled\": " << (enabled ? "true" : "false");
+    for (std::size_t s = 0; s < structure_count; ++s) {
+        out << ",\n  \"" << structure_names[s] << "\": {";
+        for (std::size_t e = 0; e < event_count; ++e) {
+            out << (e == 0 ? "" : ", ") << '"' << event_names[e] << "\": " << counts.counts[s][e];
+        }
+        out << "}";
+    }
+    out << "\n}\n";
+    return;
+}
+
+} // namespace util::instrumentation
+
+#endif // INSTRUMENTATION_HPP
@@ -0,0 +1,106 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Instrumentation test cases.
+ *
+ * Built with GDS_INSTRUMENTATION: a linked list, a double linked list and
+ * a LinearVector of strings do some work, then the counters are printed
+ * as JSON, first for the vector alone from two snapshots, then in total.
+ * Last, the hardware counters of a walk over a long linked list, per node.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+
+#include <instrumentation.hpp>
+#include <perf_counters.hpp>
+#include "../LinkedList/node.hpp"
+#include "../DoubleLinkedList/denode.hpp"
+#include "../LinearVector/linear_vector.hpp"
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+    namespace instrumentation = util::instrumentation;
+
+    /* ---------------------------------------------- */
+    /* testing node allocations and traversal         */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mLinking and walking 100 heap nodes \033[m" << "\n";
+    linked_list<int>* head = new linked_list<int>(0);
+    for (int i = 99; i > 0; --i) {
+        *head >> new node<int>(i);
+    }
+    long sum = 0;
+    for (const node<int>* n = head; n != nullptr; n = n->next()) {
+        sum += n->value();
+    }
+    while (head != nullptr) {
+        node<int>* const next = head->next();
+        delete head;
+        head = next;
+    }
+    std::cout << "sum: " << sum << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing denode traversal both ways             */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mWalking a double linked list both ways \033[m" << "\n";
+    denode<int> first(1), second(2), third(3);
+    first >> &third;
+    first >> &second;
+    denode<int>::print_all_after(&first);
+    denode<int>::print_all_before(&third);
+
+    /* ---------------------------------------------- */
+    /* testing LinearVector growth between snapshots  */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mGrowing a LinearVector of 1000 strings \033[m" << "\n";
+    const instrumentation::snapshot before = instrumentation::take_snapshot();
+    {
+        LinearVector<std::string> words;
+        for (int i = 0; i < 1000; ++i) {
+            words.push_back("word " + std::to_string(i));
+        }
+        LinearVector<std::string> copy(words);
+    }
+    const instrumentation::snapshot vector_only = instrumentation::take_snapshot() - before;
+    std::cout << "reallocations: " << vector_only(instrumentation::structure::linear_vector, instrumentation::event::reallocations)
+              << ", moves: " << vector_only(instrumentation::structure::linear_vector, instrumentation::event::moves)
+              << ", copies: " << vector_only(instrumentation::structure::linear_vector, instrumentation::event::copies) << "\n";
+
+    std::cout << "\033[32mEvery counter as JSON \033[m" << "\n";
+    instrumentation::write_json(std::cout);
+
+    /* ---------------------------------------------- */
+    /* testing hardware counters of a node walk       */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mHardware counters per node of a walk over 100000 nodes \033[m" << "\n";
+    constexpr int length = 100000;
+    linked_list<int>* list = new linked_list<int>(0);
+    for (int i = length - 1; i > 0; --i) {
+        *list >> new node<int>(i);
+    }
+    instrumentation::perf_counters counters;
+    if (!counters.unavailable_reason().empty()) {
+        std::cout << "unavailable: " << counters.unavailable_reason() << "\n";
+    }
+    long walked = 0;
+    const instrumentation::counter_sample sample = counters.measure([list, &walked] {
+        for (const node<int>* n = list; n != nullptr; n = n->next()) {
+            walked += n->value();
+        }
+    });
+    std::cout << "sum: " << walked << "\n";
+    instrumentation::write_json(std::cout, sample, length);
+    while (list != nullptr) {
+        node<int>* const next = list->next();
+        delete list;
+        list = next;
+    }
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,288 @@
+/*****************************************************************//**
+ * \file   perf_counters.hpp
+ * \brief  Hardware performance counters of a region of code, through the
+ *         Linux perf_event_open system call.
+ *
+ * Where instrumentation.hpp counts what a container does, perf_counters
+ * counts what the processor does while it does it: cycles, instructions,
+ * L1 data and last level cache read misses, branch misses and data TLB
+ * read misses, plus page faults. Any region, a LinearVector growing, a
+ * walk over nodes, hash table probes or a sort, is wrapped as
+ *
+ *   util::instrumentation::perf_counters counters;
+ *   const auto sample = counters.measure([&] { bubble_sort(arr, n); });
+ *   util::instrumentation::write_json(std::cout, sample, n);
+ *
+ * which writes every counter divided by n, the counts per operation.
+ *
+ * Each counter is opened on its own for the calling thread, user space
+ * only, so one the machine lacks does not take the others with it. When
+ * the kernel multiplexes more counters than the PMU has, a count is scaled
+ * by the share of time it was running. A counter that cannot be opened,
+ * as in most containers and virtual machines, or on any other system than
+ * Linux, is reported as unavailable: has() is false, per() is empty and
+ * the JSON says null, so callers keep working with their timings alone.
+ * unavailable_reason() tells why.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace util::instrumentation {
+
+/* the counters that are opened */
+enum class hardware_counter : std::size_t {
+    cycles,
+    instructions,
+    l1d_misses,         /* L1 data cache read misses */
+    llc_misses,         /* last level cache read misses */
+    branch_misses,
+    dtlb_misses,        /* data TLB read misses */
+    page_faults,        /* counted by the kernel, available wherever perf_event_open is */
+};
+
+inline constexpr std::size_t hardware_counter_count = 7;
+inline constexpr std::array<std::string_view, hardware_counter_count> hardware_counter_names = {
+    "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "dtlb_misses", "page_faults"
+};
+
+/* the counts of one region */
+struct counter_sample {
+    std::array<std::uint64_t, hardware_counter_count> values{};
+    std::array<bool, hardware_counter_count> valid{};   /* opened and running for part of the region at least */
+
+    constexpr bool has(const hardware_counter c) const {
+        return valid[static_cast<std::size_t>(c)];
+    }
+
+    constexpr std::uint64_t operator () (const hardware_counter c) const {
+        return values[static_cast<std::size_t>(c)];
+    }
+
+    /* the count for each of `operations`, empty if the counter is unavailable */
+    constexpr std::optional<double> per(const hardware_counter c, const std::uint64_t operations = 1) const {
+        if (!has(c) || operations == 0) {
+            return std::nullopt;
+        }
+        return static_cast<double>((*this)(c)) / static_cast<double>(operations);
+    }
+
+    /* instructions per cycle, empty unless both are available */
+    constexpr std::optional<double> ipc() const {
+        if (!has(hardware_counter::cycles) || !has(hardware_counter::instructions) || (*this)(hardware_counter::cycles) == 0) {
+            return std::nullopt;
+        }
+        return static_cast<double>((*this)(hardware_counter::instructions)) / static_cast<double>((*this)(hardware_counter::cycles));
+    }
+};
+
+#if defined(__linux__)
+namespace detail {
+constexpr std::uint64_t cache_read_miss(const std::uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+/* perf_event_attr type and config of each hardware_counter */
+inline constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, hardware_counter_count> event_types = {{
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_L1D) },
+    { PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_LL) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_DTLB) },
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+}};
+} // namespace detail
+#endif
+
+/**
+ * \brief A set of counters for the calling thread, stopped until start().
+ * Counts add up over every start() and stop() until the next reset().
+ */
+class perf_counters {
+public:
+    perf_counters() {
+#if defined(__linux__)
+        for (std::size_t c = 0; c < hardware_counter_count; ++c) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = detail::event_types[c].first;
+            attr.config = detail::event_types[c].second;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+            if (fd >= 0) {
+                fds_[c] = static_cast<int>(fd);
+            }
+            else if (reason_.empty()) {
+                reason_ = std::string(hardware_counter_names[c]) + ": perf_event_open: " + std::strerror(errno);
+            }
+        }
+#else
+        reason_ = "perf_event_open is only on Linux";
+#endif
+        reset();
+        return;
+    }
+
+    ~perf_counters() {
+#if defined(__linux__)
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+        return;
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator = (const perf_counters&) = delete;
+
+    /* whether any counter could be opened */
+    bool available() const {
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool available(const hardware_counter c) const {
+        return fds_[static_cast<std::size_t>(c)] >= 0;
+    }
+
+    /* why the first counter that could not be opened was not, empty if all were */
+    const std::string& unavailable_reason() const {
+        return reason_;
+    }
+
+    void start() {
+#if defined(__linux__)
+        control(PERF_EVENT_IOC_ENABLE);
+#endif
+        return;
+    }
+
+    void stop() {
+#if defined(__linux__)
+        control(PERF_EVENT_IOC_DISABLE);
+#endif
+        return;
+    }
+
+    /* count from zero again; the kernel keeps counting its times, so take them as the new origin */
+    void reset() {
+        origin_ = read_raw();
+        return;
+    }
+
+    /* the counts since the last reset() */
+    counter_sample read() const {
+        const std::array<raw_count, hardware_counter_count> now = read_raw();
+        counter_sample sample;
+        for (std::size_t c = 0; c < hardware_counter_count; ++c) {
+            const std::uint64_t value = now[c].value - origin_[c].value;
+            const std::uint64_t enabled = now[c].time_enabled - origin_[c].time_enabled;
+            const std::uint64_t running = now[c].time_running - origin_[c].time_running;
+            if (fds_[c] < 0 || running == 0) {
+                continue;
+            }
+            sample.valid[c] = true;
+            sample.values[c] = running < enabled
+                ? static_cast<std::uint64_t>(static_cast<double>(value) * static_cast<double>(enabled) / static_cast<double>(running))
+                : value;
+        }
+        return sample;
+    }
+
+    /* reset, run region between start() and stop(), and read */
+    template<typename _Region>
+    counter_sample measure(_Region&& region) {
+        reset();
+        start();
+        std::forward<_Region>(region)();
+        stop();
+        return read();
+    }
+
+private:
+    struct raw_count {
+        std::uint64_t value = 0;
+        std::uint64_t time_enabled = 0;
+        std::uint64_t time_running = 0;
+    };
+
+#if defined(__linux__)
+    void control(const unsigned long request) {
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                ioctl(fd, request, 0);
+            }
+        }
+        return;
+    }
+#endif
+
+    std::array<raw_count, hardware_counter_count> read_raw() const {
+        std::array<raw_count, hardware_counter_count> counts{};
+#if defined(__linux__)
+        for (std::size_t c = 0; c < hardware_counter_count; ++c) {
+            std::uint64_t fields[3];
+            if (fds_[c] >= 0 && ::read(fds_[c], fields, sizeof(fields)) == static_cast<ssize_t>(sizeof(fields))) {
+                counts[c] = { fields[0], fields[1], fields[2] };
+            }
+        }
+#endif
+        return counts;
+    }
+
+    std::array<int, hardware_counter_count> fds_ = { -1, -1, -1, -1, -1, -1, -1 };
+    std::array<raw_count, hardware_counter_count> origin_{};
+    std::string reason_;
+};
+
+/* {"cycles": 12.5, "instructions": 30.25, ..., "llc_misses": null}, every count divided by operations */
+inline void write_json(std::ostream& out, const counter_sample& sample, const std::uint64_t operations = 1) {
+    out << "{";
+    for (std::size_t c = 0; c < hardware_counter_count; ++c) {
+        const std::optional<double> count = sample.per(static_cast<hardware_counter>(c), operations);
+        out << (c == 0 ? "" : ", ") << '"' << hardware_counter_names[c] << "\": ";
+        if (count) {
+            out << *count;
+        }
+        else {
+            out << "null";
+        }
+    }
+    out << "}\n";
+    return;
+}
+
+} // namespace util::instrumentation
+
+#endif // PERF_COUNTERS_HPP
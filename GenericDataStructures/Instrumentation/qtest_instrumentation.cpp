@@ -0,0 +1,283 @@
+/*****************************************************************//**
+ * \file   qtest_instrumentation.cpp
+ * \brief  util::instrumentation test cases with QTest framework.
+ *
+ * Built with GDS_INSTRUMENTATION. Each case takes a snapshot, does work
+ * whose cost is known exactly, and compares the difference of the
+ * counters with that cost. The hardware counters are checked for what
+ * holds on any machine, with or without them.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <QTest>
+#include <QDebug>
+
+#include <instrumentation.hpp>
+#include <perf_counters.hpp>
+#include "../LinkedList/node.hpp"
+#include "../DoubleLinkedList/denode.hpp"
+#include "../LinearVector/linear_vector.hpp"
+
+class TestInstrumentation : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    void linearVectorGrowth() const;
+    void linearVectorCopiesWhenMoveMayThrow() const;
+    void nodeAllocationsAndSteps() const;
+    void denodeStepsBothWays() const;
+    void constantEvaluationCountsNothing() const;
+    void jsonHasEveryCounter() const;
+    void perfCountersOfARegion() const;
+    void perfCountersUnavailableAreNull() const;
+
+private:
+    using structure = util::instrumentation::structure;
+    using event = util::instrumentation::event;
+
+    /* a type whose move may throw, relocated by copy */
+    struct Sticky {
+        int value = 0;
+        Sticky(const int v) : value(v) {}
+        Sticky(const Sticky&) = default;
+        Sticky(Sticky&& other) noexcept(false) : value(other.value) {}
+    };
+};
+
+void TestInstrumentation::linearVectorGrowth() const
+{
+    namespace instrumentation = util::instrumentation;
+    QVERIFY(instrumentation::enabled);
+
+    const instrumentation::snapshot before = instrumentation::take_snapshot();
+    {
+        LinearVector<std::string> words;
+        for (int i = 0; i < 100; ++i) {
+            words.push_back(std::to_string(i));
+        }
+        const std::string last = "last";
+        words.push_back(last);
+    }
+    const instrumentation::snapshot spent = instrumentation::take_snapshot() - before;
+
+    qDebug() << "8 -> 16 -> 32 -> 64 -> 128 elements: one block at first, four reallocations";
+    QCOMPARE_EQ(spent(structure::linear_vector, event::allocations), 5);
+    QCOMPARE_EQ(spent(structure::linear_vector, event::deallocations), 5);
+    QCOMPARE_EQ(spent(structure::linear_vector, event::reallocations), 4);
+    QCOMPARE_EQ(spent(structure::linear_vector, event::bytes_allocated), (8 + 16 + 32 + 64 + 128) * sizeof(std::string));
+    QCOMPARE_EQ(spent(structure::linear_vector, event::bytes_deallocated), spent(structure::linear_vector, event::bytes_allocated));
+
+    qDebug() << "100 temporaries moved in, 8 + 16 + 32 + 64 relocated by move, one lvalue copied";
+    QCOMPARE_EQ(spent(structure::linear_vector, event::moves), 100 + 120);
+    QCOMPARE_EQ(spent(structure::linear_vector, event::copies), 1);
+
+    return;
+}
+
+void TestInstrumentation::linearVectorCopiesWhenMoveMayThrow() const
+{
+    namespace instrumentation = util::instrumentation;
+    const instrumentation::snapshot before = instrumentation::take_snapshot();
+    {
+        LinearVector<Sticky> values;
+        for (int i = 0; i < 9; ++i) {
+            values.emplace_back(i);
+        }
+    }
+    const instrumentation::snapshot spent = instrumentation::take_snapshot() - before;
+
+    qDebug() << "Constructing from an int is neither, relocating 8 elements that may throw on move copies them";
+    QCOMPARE_EQ(spent(structure::linear_vector, event::copies), 8);
+    QCOMPARE_EQ(spent(structure::linear_vector, event::moves), 0);
+
+    return;
+}
+
+void TestInstrumentation::nodeAllocationsAndSteps() const
+{
+    using namespace util::data_structure;
+    namespace instrumentation = util::instrumentation;
+    const instrumentation::snapshot before = instrumentation::take_snapshot();
+
+    linked_list<int>* head = new linked_list<int>(0);
+    for (int i = 9; i > 0; --i) {
+        *head >> new node<int>(i);
+    }
+    int count = 0;
+    for (const node<int>* n = head; n != nullptr; n = n->next()) {
+        ++count;
+    }
+    while (head != nullptr) {
+        node<int>* const next = head->next();
+        delete head;
+        head = next;
+    }
+    const instrumentation::snapshot spent = instrumentation::take_snapshot() - before;
+
+    qDebug() << "Ten nodes allocated and freed, with their sizes";
+    QCOMPARE_EQ(count, 10);
+    QCOMPARE_EQ(spent(structure::node, event::allocations), 10);
+    QCOMPARE_EQ(spent(structure::node, event::deallocations), 10);
+    QCOMPARE_EQ(spent(structure::node, event::bytes_allocated), 10 * sizeof(node<int>));
+    QCOMPARE_EQ(spent(structure::node, event::bytes_deallocated), 10 * sizeof(node<int>));
+
+    qDebug() << "Nine links followed by each walk, a value copied into every node";
+    QCOMPARE_EQ(spent(structure::node, event::traversal_steps), 18);
+    QCOMPARE_EQ(spent(structure::node, event::copies), 10);
+
+    return;
+}
+
+void TestInstrumentation::denodeStepsBothWays() const
+{
+    using namespace util::data_structure;
+    namespace instrumentation = util::instrumentation;
+    denode<int> first(1), second(2), third(3);
+    first >> &third;
+    first >> &second;
+
+    const instrumentation::snapshot before = instrumentation::take_snapshot();
+    const denode<int>* n = &first;
+    while (n->next() != nullptr) {
+        n = n->next();
+    }
+    denode<int>* back = &third;
+    back = &--(*back);
+    back = &--(*back);
+    back = &--(*back);
+    const instrumentation::snapshot spent = instrumentation::take_snapshot() - before;
+
+    qDebug() << "Forward: each link is read twice, backward: the head stays put";
+    QCOMPARE_EQ(n, &third);
+    QCOMPARE_EQ(back, &first);
+    QCOMPARE_EQ(spent(structure::denode, event::traversal_steps), 4 + 2);
+    QCOMPARE_EQ(spent(structure::denode, event::allocations), 0);
+
+    return;
+}
+
+void TestInstrumentation::constantEvaluationCountsNothing() const
+{
+    namespace instrumentation = util::instrumentation;
+    constexpr auto sum_of_pushed = [] {
+        LinearVector<int> values;
+        for (int i = 1; i <= 100; ++i) {
+            values.push_back(i);
+        }
+        int sum = 0;
+        for (const int value : values) {
+            sum += value;
+        }
+        return sum;
+    };
+
+    qDebug() << "record() is constexpr, so instrumented containers still run in constant expressions";
+    const instrumentation::snapshot before = instrumentation::take_snapshot();
+    static_assert(sum_of_pushed() == 5050);
+    const instrumentation::snapshot spent = instrumentation::take_snapshot() - before;
+    QCOMPARE_EQ(spent(structure::linear_vector, event::allocations), 0);
+
+    return;
+}
+
+void TestInstrumentation::jsonHasEveryCounter() const
+{
+    namespace instrumentation = util::instrumentation;
+    std::ostringstream out;
+    instrumentation::write_json(out);
+    const std::string json = out.str();
+
+    qDebug() << "Every structure and every event appears in the JSON";
+    QVERIFY(json.find("\"enabled\": true") != std::string::npos);
+    for (const std::string_view name : instrumentation::structure_names) {
+        QVERIFY(json.find("\"" + std::string(name) + "\": {") != std::string::npos);
+    }
+    for (const std::string_view name : instrumentation::event_names) {
+        QVERIFY(json.find("\"" + std::string(name) + "\": ") != std::string::npos);
+    }
+
+    return;
+}
+
+void TestInstrumentation::perfCountersOfARegion() const
+{
+    using namespace util::data_structure;
+    namespace instrumentation = util::instrumentation;
+    using counter = instrumentation::hardware_counter;
+    instrumentation::perf_counters counters;
+    if (!counters.available()) {
+        qDebug() << "No counters on this machine:" << counters.unavailable_reason().c_str();
+    }
+
+    constexpr int count = 100000;
+    long sum = 0;
+    const instrumentation::counter_sample sample = counters.measure([&sum] {
+        LinearVector<long> values;
+        for (int i = 0; i < count; ++i) {
+            values.push_back(i);
+        }
+        for (const long value : values) {
+            sum += value;
+        }
+    });
+    QCOMPARE_EQ(sum, static_cast<long>(count) * (count - 1) / 2);
+
+    qDebug() << "Only the counters that could be opened have counts";
+    for (std::size_t c = 0; c < instrumentation::hardware_counter_count; ++c) {
+        const counter which = static_cast<counter>(c);
+        QVERIFY(counters.available(which) || !sample.has(which));
+        QCOMPARE_EQ(sample.per(which, count).has_value(), sample.has(which));
+    }
+    QVERIFY(counters.available() || !counters.unavailable_reason().empty());
+
+    if (sample.has(counter::instructions)) {
+        qDebug() << "Instructions per push_back and add:" << *sample.per(counter::instructions, count);
+        QVERIFY(sample(counter::instructions) > 2 * count);
+    }
+    if (sample.has(counter::cycles)) {
+        QVERIFY(sample(counter::cycles) > 0);
+        QVERIFY(sample.ipc().has_value());
+    }
+
+    qDebug() << "Stopped counters do not count";
+    const instrumentation::counter_sample stopped = counters.read();
+    for (std::size_t c = 0; c < instrumentation::hardware_counter_count; ++c) {
+        QCOMPARE_EQ(stopped.values[c], sample.values[c]);
+    }
+
+    return;
+}
+
+void TestInstrumentation::perfCountersUnavailableAreNull() const
+{
+    namespace instrumentation = util::instrumentation;
+    instrumentation::counter_sample sample;
+    sample.valid[static_cast<std::size_t>(instrumentation::hardware_counter::cycles)] = true;
+    sample.values[static_cast<std::size_t>(instrumentation::hardware_counter::cycles)] = 300;
+    std::ostringstream out;
+    instrumentation::write_json(out, sample, 100);
+    const std::string json = out.str();
+
+    qDebug() << "A counter that was not opened is null, an opened one is divided by the operations";
+    QVERIFY(json.find("\"cycles\": 3") != std::string::npos);
+    for (std::size_t c = 1; c < instrumentation::hardware_counter_count; ++c) {
+        QVERIFY(json.find("\"" + std::string(instrumentation::hardware_counter_names[c]) + "\": null") != std::string::npos);
+    }
+    QVERIFY(!sample.ipc().has_value());
+
+    return;
+}
+
+QTEST_MAIN(TestInstrumentation)
+#include "qtest_instrumentation.moc"
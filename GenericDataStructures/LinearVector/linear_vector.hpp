@@ -2,110 +2,523 @@
  * \file   linear_vector.hpp
  * \brief  Linear vector with resizing policy implementation.
  *
- * TODO: pending refactoring and provide miscellaneous operators.
+ * LinearVector keeps its elements in one heap block of uninitialized
+ * storage: elements are constructed in place when pushed and destroyed
+ * when popped, and are moved (copied only if the move may throw) when
+ * the block grows. FixedLinearVector offers the same interface on inline
+ * storage of a fixed capacity and never allocates.
+ *
+ * Both are usable in constant expressions: a LinearVector may allocate
+ * during constant evaluation as long as it is destroyed before the
+ * evaluation ends, while a FixedLinearVector of a literal element type
+ * may itself be the value of a constexpr variable.
+ *
+ * Built with GDS_INSTRUMENTATION, both count the elements they copy and
+ * move, and LinearVector its allocations, bytes and reallocations, under
+ * util::instrumentation::structure::linear_vector.
  *
  * \author Xuhua Huang
  * \date   March 25, 2023
  *********************************************************************/
 
+#ifndef LINEAR_VECTOR_HPP
+#define LINEAR_VECTOR_HPP
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../Instrumentation/instrumentation.hpp"
+
+// Default resizing policy doubles the capacity of the vector
+struct DefaultResizePolicy {
+    constexpr size_t operator()(const size_t current_capacity) const {
+        return current_capacity * 2;
+    }
+};
+
+// Resizing policy that increases the capacity of the vector by a fixed amount
+struct FixedResizePolicy {
+    constexpr FixedResizePolicy(const size_t increment) : increment_(increment) {}
+
+    constexpr size_t operator()(const size_t current_capacity) const {
+        return current_capacity + increment_;
+    }
+
+private:
+    size_t increment_;
+};
+
 template <typename T, size_t InitialCapacity = 8, typename ResizePolicy = DefaultResizePolicy>
 struct LinearVector {
 public:
-    LinearVector() : size_(0), capacity_(InitialCapacity) {
-        data_ = new T[capacity_];
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr LinearVector() : data_(allocate(InitialCapacity)), size_(0), capacity_(InitialCapacity) {}
+
+    constexpr LinearVector(const LinearVector<T, InitialCapacity, ResizePolicy>& other)
+        : data_(allocate(other.capacity_)), size_(0), capacity_(other.capacity_) {
+        // One by one rather than std::uninitialized_copy, which is not constexpr
+        try {
+            for (; size_ < other.size_; ++size_) {
+                std::construct_at(data_ + size_, other.data_[size_]);
+            }
+        }
+        catch (...) {
+            std::destroy(data_, data_ + size_);
+            deallocate(data_, capacity_);
+            throw;
+        }
+        record(util::instrumentation::event::copies, size_);
     }
 
-    LinearVector(const LinearVector<T, InitialCapacity, ResizePolicy>& other) : size_(other.size_), capacity_(other.capacity_) {
-        data_ = new T[capacity_];
-        for (size_t i = 0; i < size_; ++i) {
-            data_[i] = other.data_[i];
+    // The moved-from vector is left empty, without storage
+    constexpr LinearVector(LinearVector<T, InitialCapacity, ResizePolicy>&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+        , capacity_(std::exchange(other.capacity_, 0)) {}
+
+    constexpr LinearVector& operator=(const LinearVector<T, InitialCapacity, ResizePolicy>& other) {
+        if (this != &other) {
+            LinearVector copy(other);
+            swap(copy);
         }
+        return *this;
+    }
+
+    constexpr LinearVector& operator=(LinearVector<T, InitialCapacity, ResizePolicy>&& other) noexcept {
+        LinearVector moved(std::move(other));
+        swap(moved);
+        return *this;
     }
 
-    ~LinearVector() {
-        delete[] data_;
+    constexpr ~LinearVector() {
+        std::destroy(begin(), end());
+        deallocate(data_, capacity_);
     }
 
     // Add an element to the end of the vector
-    void push_back(const T& value) {
+    constexpr void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Construct an element in place at the end of the vector
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args) {
         if (size_ == capacity_) {
-            resize();
+            return grow_and_emplace_back(std::forward<Args>(args)...);
         }
-        data_[size_++] = value;
+        T* element = std::construct_at(data_ + size_, std::forward<Args>(args)...);
+        util::instrumentation::record_construction<T, Args...>(util::instrumentation::structure::linear_vector);
+        ++size_;
+        return *element;
     }
 
     // Remove the last element from the vector
-    void pop_back() {
+    constexpr void pop_back() {
         if (size_ == 0) {
-            throw std::out_of_range("vector is empty");
+            throw_out_of_range("vector is empty");
         }
         --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    // Get a reference to the last element
+    constexpr T& back() {
+        if (size_ == 0) {
+            throw_out_of_range("vector is empty");
+        }
+        return data_[size_ - 1];
+    }
+
+    constexpr const T& back() const {
+        if (size_ == 0) {
+            throw_out_of_range("vector is empty");
+        }
+        return data_[size_ - 1];
     }
 
     // Get a reference to the element at the specified index
-    T& operator[](const size_t index) {
+    constexpr T& operator[](const size_t index) {
         if (index >= size_) {
-            throw std::out_of_range("index out of range");
+            throw_out_of_range("index out of range");
         }
         return data_[index];
     }
 
     // Get a const reference to the element at the specified index
-    const T& operator[](const size_t index) const {
+    constexpr const T& operator[](const size_t index) const {
         if (index >= size_) {
-            throw std::out_of_range("index out of range");
+            throw_out_of_range("index out of range");
         }
         return data_[index];
     }
 
+    constexpr T* data() { return data_; }
+    constexpr const T* data() const { return data_; }
+
+    constexpr T* begin() { return data_; }
+    constexpr T* end() { return data_ + size_; }
+    constexpr const T* begin() const { return data_; }
+    constexpr const T* end() const { return data_ + size_; }
+
     // Get the number of elements in the vector
-    size_t size() const {
+    constexpr size_t size() const {
         return size_;
     }
 
     // Get the current capacity of the vector
-    size_t capacity() const {
+    constexpr size_t capacity() const {
         return capacity_;
     }
 
     // Check if the vector is empty
-    bool empty() const {
+    constexpr bool empty() const {
         return size_ == 0;
     }
 
+    // Destroy every element, keeping the storage
+    constexpr void clear() {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    // Make room for at least `capacity` elements without further allocation
+    constexpr void reserve(const size_t capacity) {
+        if (capacity > capacity_) {
+            relocate(capacity);
+        }
+    }
+
+    constexpr void swap(LinearVector<T, InitialCapacity, ResizePolicy>& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    friend constexpr void swap(LinearVector& lhs, LinearVector& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+    friend constexpr bool operator==(const LinearVector& lhs, const LinearVector& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    // Lexicographical comparison, as for std::vector
+    friend constexpr auto operator<=>(const LinearVector& lhs, const LinearVector& rhs)
+    requires std::three_way_comparable<T> {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
 private:
     T* data_;
     size_t size_;
     size_t capacity_;
 
-    // Resize the vector using the ResizePolicy
-    void resize() {
+    // Throwing from a [[noreturn]] helper keeps the checks cheap in push and pop loops
+    [[noreturn]] static constexpr void throw_out_of_range(const char* what) {
+        throw std::out_of_range(what);
+    }
+
+    // Counted only when built with GDS_INSTRUMENTATION
+    static constexpr void record(const util::instrumentation::event event, const size_t n = 1) noexcept {
+        util::instrumentation::record(util::instrumentation::structure::linear_vector, event, n);
+    }
+
+    static constexpr T* allocate(const size_t capacity) {
+        if (capacity == 0) {
+            return nullptr;
+        }
+        T* data = std::allocator<T>{}.allocate(capacity);
+        record(util::instrumentation::event::allocations);
+        record(util::instrumentation::event::bytes_allocated, capacity * sizeof(T));
+        return data;
+    }
+
+    static constexpr void deallocate(T* data, const size_t capacity) {
+        if (data != nullptr) {
+            std::allocator<T>{}.deallocate(data, capacity);
+            record(util::instrumentation::event::deallocations);
+            record(util::instrumentation::event::bytes_deallocated, capacity * sizeof(T));
+        }
+    }
+
+    // Next capacity from the ResizePolicy, growing by at least one element
+    constexpr size_t next_capacity() const {
         ResizePolicy resize_policy;
-        capacity_ = resize_policy(capacity_);
-        T* new_data = new T[capacity_];
-        for (size_t i = 0; i < size_; ++i) {
-            new_data[i] = data_[i];
+        return std::max(resize_policy(capacity_), capacity_ + 1);
+    }
+
+    // Move the elements to a new block of `capacity` elements
+    constexpr void relocate(const size_t capacity) {
+        T* new_data = allocate(capacity);
+        try {
+            move_elements(new_data);
+        }
+        catch (...) {
+            deallocate(new_data, capacity);
+            throw;
         }
-        delete[] data_;
+        deallocate(data_, capacity_);
         data_ = new_data;
+        capacity_ = capacity;
+        record(util::instrumentation::event::reallocations);
     }
-};
 
-// Default resizing policy doubles the capacity of the vector
-struct DefaultResizePolicy {
-    size_t operator()(const size_t current_capacity) const {
-        return current_capacity * 2;
+    // Move, or copy if moving may throw, the elements into new_data and destroy
+    // the originals; on an exception the elements constructed so far are destroyed
+    constexpr void move_elements(T* new_data) {
+        size_t moved = 0;
+        try {
+            for (; moved < size_; ++moved) {
+                std::construct_at(new_data + moved, std::move_if_noexcept(data_[moved]));
+            }
+        }
+        catch (...) {
+            std::destroy(new_data, new_data + moved);
+            throw;
+        }
+        record(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>
+                   ? util::instrumentation::event::moves
+                   : util::instrumentation::event::copies,
+               size_);
+        std::destroy(begin(), end());
+    }
+
+    // Resize the vector using the ResizePolicy; the new element is constructed
+    // first, so arguments referring to an element of this vector stay valid
+    template <typename... Args>
+    constexpr T& grow_and_emplace_back(Args&&... args) {
+        const size_t capacity = next_capacity();
+        T* new_data = allocate(capacity);
+        T* element = nullptr;
+        try {
+            element = std::construct_at(new_data + size_, std::forward<Args>(args)...);
+            util::instrumentation::record_construction<T, Args...>(util::instrumentation::structure::linear_vector);
+            move_elements(new_data);
+        }
+        catch (...) {
+            if (element != nullptr) {
+                std::destroy_at(element);
+            }
+            deallocate(new_data, capacity);
+            throw;
+        }
+        deallocate(data_, capacity_);
+        data_ = new_data;
+        capacity_ = capacity;
+        ++size_;
+        record(util::instrumentation::event::reallocations);
+        return *element;
     }
 };
 
-// Resizing policy that increases the capacity of the vector by a fixed amount
-struct FixedResizePolicy {
-    FixedResizePolicy(const size_t increment) : increment_(increment) {}
+/**
+ * Vector of at most Capacity elements stored inline, in the object itself:
+ * it never allocates, and pushing onto a full vector throws std::length_error.
+ * Capacity must be positive, the elements being an array of that many.
+ */
+template <typename T, size_t Capacity>
+requires (Capacity > 0)
+struct FixedLinearVector {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
 
-    size_t operator()(const size_t current_capacity) const {
-        return current_capacity + increment_;
+    constexpr FixedLinearVector() : size_(0) {
+        start_lifetimes();
+    }
+
+    constexpr FixedLinearVector(const FixedLinearVector<T, Capacity>& other) : size_(0) {
+        start_lifetimes();
+        for (const T& value : other) {
+            emplace_back(value);
+        }
+    }
+
+    constexpr FixedLinearVector(FixedLinearVector<T, Capacity>&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : size_(0) {
+        start_lifetimes();
+        for (T& value : other) {
+            emplace_back(std::move(value));
+        }
+        other.clear();
+    }
+
+    constexpr FixedLinearVector& operator=(const FixedLinearVector<T, Capacity>& other) {
+        if (this != &other) {
+            clear();
+            for (const T& value : other) {
+                emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    constexpr FixedLinearVector& operator=(FixedLinearVector<T, Capacity>&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            for (T& value : other) {
+                emplace_back(std::move(value));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    constexpr ~FixedLinearVector() {
+        clear();
+    }
+
+    // Add an element to the end of the vector
+    constexpr void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Construct an element in place at the end of the vector
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args) {
+        if (size_ == Capacity) {
+            throw_length_error();
+        }
+        T* element = std::construct_at(data() + size_, std::forward<Args>(args)...);
+        util::instrumentation::record_construction<T, Args...>(util::instrumentation::structure::linear_vector);
+        ++size_;
+        return *element;
+    }
+
+    // Remove the last element from the vector
+    constexpr void pop_back() {
+        if (size_ == 0) {
+            throw_out_of_range("vector is empty");
+        }
+        --size_;
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy_at(data() + size_);
+        }
+    }
+
+    // Get a reference to the last element
+    constexpr T& back() {
+        if (size_ == 0) {
+            throw_out_of_range("vector is empty");
+        }
+        return data()[size_ - 1];
+    }
+
+    constexpr const T& back() const {
+        if (size_ == 0) {
+            throw_out_of_range("vector is empty");
+        }
+        return data()[size_ - 1];
+    }
+
+    // Get a reference to the element at the specified index
+    constexpr T& operator[](const size_t index) {
+        if (index >= size_) {
+            throw_out_of_range("index out of range");
+        }
+        return data()[index];
+    }
+
+    // Get a const reference to the element at the specified index
+    constexpr const T& operator[](const size_t index) const {
+        if (index >= size_) {
+            throw_out_of_range("index out of range");
+        }
+        return data()[index];
+    }
+
+    constexpr T* data() { return storage_.elements; }
+    constexpr const T* data() const { return storage_.elements; }
+
+    constexpr T* begin() { return data(); }
+    constexpr T* end() { return data() + size_; }
+    constexpr const T* begin() const { return data(); }
+    constexpr const T* end() const { return data() + size_; }
+
+    constexpr size_t size() const { return size_; }
+    static constexpr size_t capacity() { return Capacity; }
+    constexpr bool empty() const { return size_ == 0; }
+
+    // Destroy every element
+    constexpr void clear() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy(begin(), end());
+        }
+        size_ = 0;
+    }
+
+    // Nothing to reserve up to the fixed capacity
+    constexpr void reserve(const size_t capacity) {
+        if (capacity > Capacity) {
+            throw_length_error();
+        }
+    }
+
+    friend constexpr bool operator==(const FixedLinearVector& lhs, const FixedLinearVector& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    // Lexicographical comparison, as for std::vector
+    friend constexpr auto operator<=>(const FixedLinearVector& lhs, const FixedLinearVector& rhs)
+    requires std::three_way_comparable<T> {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
 private:
-    size_t increment_;
+    [[noreturn]] static constexpr void throw_out_of_range(const char* what) {
+        throw std::out_of_range(what);
+    }
+
+    [[noreturn]] static constexpr void throw_length_error() {
+        throw std::length_error("fixed capacity exceeded");
+    }
+
+    // Every element of a constexpr variable must be initialized, unused ones
+    // included, so during constant evaluation elements of trivial types are
+    // value-initialized up front; pushing constructs over them and popping
+    // leaves them alive. At run time they stay unconstructed.
+    constexpr void start_lifetimes() {
+        if constexpr (std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>) {
+            if consteval {
+                for (size_t i = 0; i < Capacity; ++i) {
+                    std::construct_at(storage_.elements + i);
+                }
+            }
+        }
+    }
+
+    // A union leaves the elements unconstructed until they are pushed
+    union storage {
+        constexpr storage() {}
+        constexpr ~storage() {}
+        T elements[Capacity];
+    };
+
+    storage storage_;
+    size_t size_;
 };
+
+#endif // LINEAR_VECTOR_HPP
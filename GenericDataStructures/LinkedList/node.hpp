@@ -35,7 +35,7 @@
 #include <new>
 #endif
 
-#ifndef _FORMAT_
+#if !defined(_FORMAT_) && __has_include(<format>)
 #include <format>
 #endif
 
@@ -43,6 +43,10 @@
 #include <type_traits>
 #endif
 
+/* counts allocations, links followed and element copies and moves */
+/* when built with GDS_INSTRUMENTATION, otherwise compiles to nothing */
+#include "../Instrumentation/instrumentation.hpp"
+
 namespace util::data_structure {
 
 template<typename _Elem>
@@ -58,77 +62,90 @@ class node final {
 public:
     /* default constructor */
     /* std::is_default_constructible<elem_type>::value */
-    explicit node<elem_type>()
+    constexpr explicit node()
     requires std::default_initializable<elem_type>
     : elem_value(elem_type())
     , next_node(nullptr) {}
 
     /* overloaded constructor */
     /* std::is_copy_constructible<elem_type>::value */
-    explicit node<elem_type>(const elem_type& value, node<elem_type>* const next = nullptr)
+    constexpr explicit node(const elem_type& value, node<elem_type>* const next = nullptr)
     requires std::copy_constructible<elem_type>
     : elem_value(value)
-    , next_node(next) {}
+    , next_node(next) {
+        record(util::instrumentation::event::copies);
+    }
 
     /* copy constructor */
     /* std::is_copy_constructible<elem_type>::value */
     /* std::is_copy_constructible<node<elem_type>>::value */
-    node<elem_type>(const node<elem_type>& rhs)
+    constexpr node(const node<elem_type>& rhs)
     requires std::copy_constructible<elem_type>
     : elem_value(rhs.elem_value)
-    , next_node(rhs.next_node) {}
+    , next_node(rhs.next_node) {
+        record(util::instrumentation::event::copies);
+    }
 
     /* copy assignment operator */
     /* std::is_copy_assignable<elem_type>::value */
-    [[nodiscard]] node<elem_type>& operator = (const node<elem_type>& rhs)
+    [[nodiscard]] constexpr node<elem_type>& operator = (const node<elem_type>& rhs)
     requires std::copyable<elem_type> {
         // guard self assignment
         if (this == &rhs) { return *this; }
         elem_value = rhs.elem_value;
         next_node = rhs.next_node;
+        record(util::instrumentation::event::copies);
         return *this;
     }
 
     /* move constructor */
     /* std::is_move_constructible<elem_type>::value */
-    node<elem_type>(node<elem_type>&& rhs) noexcept
+    constexpr node(node<elem_type>&& rhs) noexcept
     requires std::movable<elem_type>
     : elem_value(std::move(rhs.elem_value))
-    , next_node(std::move(rhs.next_node)) {}
+    , next_node(std::move(rhs.next_node)) {
+        record(util::instrumentation::event::moves);
+    }
 
     /* move assignment operator */
     /* std::is_move_assignable<elem_type>::value
     && std::is_copy_assignable<elem_type>::value */
-    [[nodiscard]] node<elem_type>& operator = (node<elem_type>&& rhs) noexcept
+    [[nodiscard]] constexpr node<elem_type>& operator = (node<elem_type>&& rhs) noexcept
     requires std::copyable<elem_type> && std::movable<elem_type>
     && std::is_nothrow_move_assignable<elem_type>::value {
         // guard self assignment
         if (this == &rhs) { return *this; }
         elem_value = std::move(rhs.elem_value);
         next_node = std::move(rhs.next_node);
+        record(util::instrumentation::event::moves);
         return *this;
     }
 
     /* destructor */
-    ~node<elem_type>()
+    constexpr ~node()
     requires std::destructible<elem_type> = default;
 
     /* elem_value mutator and accessor */
     /* std::is_copy_assignable<elem_type>::value */
     /* std::is_copy_assignable_v<elem_type> */
-    inline elem_type& value()
+    constexpr elem_type& value()
     requires std::is_copy_assignable<elem_type>::value { return elem_value; }
-    inline const elem_type value() const
+    constexpr const elem_type value() const
     requires std::copyable<elem_type> { return elem_value; }
 
     /* next_node mutator and accessor */
-    inline node<elem_type>* next() const { return next_node; }
+    constexpr node<elem_type>* next() const {
+        if (next_node != nullptr) {
+            record(util::instrumentation::event::traversal_steps);
+        }
+        return next_node;
+    }
     /* link_next function does not check for nullptr connection */
     /* consider using linear_insert(node<elem_type>* n) instead */
-    inline void link_next(node<elem_type>* node) { next_node = node; }
+    constexpr void link_next(node<elem_type>* node) { next_node = node; }
 
     /* member function */
-    void linear_insert(node<elem_type>* elem) noexcept;
+    constexpr void linear_insert(node<elem_type>* elem) noexcept;
 
     void debug_this(void);
     void debug_this(std::ostream& out);
@@ -145,20 +162,24 @@ public:
     /* ------------------------------- */
     /* next_node require manual deallocation if it is allocated on the heap */
     /* or automatically destructed when it goes out of scope if it is on the stack */
-    static inline void drop_all_after(node<elem_type>* elem) {
+    static constexpr void drop_all_after(node<elem_type>* elem) {
         elem->link_next(nullptr);
     }
 
     /* overloaded new and delete operator */
     /* otherwise linked_list<>* will fail */
+    /* allocation functions cannot be constexpr: during constant evaluation */
+    /* use nodes with automatic storage, or std::allocator<node<elem_type>> */
+    /* with std::construct_at and std::destroy_at, which bypass these */
     [[nodiscard]] static void* operator new(std::size_t size);
-    static void operator delete(void* ptr) noexcept;
+    static void operator delete(void* ptr, std::size_t size) noexcept;
     [[nodiscard]] static void* operator new[](std::size_t count);
     static void operator delete[](void* ptr, std::size_t size);
 
     /* prefix increment */
-    [[nodiscard]] inline node<elem_type>& operator ++ () {
+    [[nodiscard]] constexpr node<elem_type>& operator ++ () {
         if (next_node != nullptr) {
+            record(util::instrumentation::event::traversal_steps);
             return *next_node;
         }
         else {
@@ -174,13 +195,13 @@ public:
     node<elem_type> operator -- (int) = delete;
 
     /* comparison operator */
-    inline auto operator <=> (const node<elem_type>& elem) const
+    constexpr auto operator <=> (const node<elem_type>& elem) const
     requires std::three_way_comparable<elem_type> {
         return elem_value <=> elem.elem_value;
     }
 
     /* equality comparator */
-    inline bool operator == (const node<elem_type>& elem) const
+    constexpr bool operator == (const node<elem_type>& elem) const
     requires std::equality_comparable<elem_type> {
         /* another alternative approach is to use <=> operator */
         /* and compare the output with std::strong_ordering::equal */
@@ -188,7 +209,7 @@ public:
     }
 
     /* inequality comparator */
-    inline bool operator != (const node<elem_type>& elem) const
+    constexpr bool operator != (const node<elem_type>& elem) const
     requires std::equality_comparable<elem_type> {
         return !(operator == (elem));
     }
@@ -196,7 +217,7 @@ public:
     /* operator >> overload to link nodes */
     /* lhs >> &rhs */
     /* does not support chained linking operation */
-    inline friend void operator >> (node<elem_type>& lhs, node<elem_type>* rhs) noexcept {
+    constexpr friend void operator >> (node<elem_type>& lhs, node<elem_type>* rhs) noexcept {
         lhs.linear_insert(rhs);
         return;
     }
@@ -206,7 +227,7 @@ public:
         return out << __func__ << " [[std::ostream&]] << node data: " << elem.value() << "\n";
     }
 
-    inline friend node<elem_type>& operator << (node<elem_type>& lhs, node<elem_type>* rhs) {
+    constexpr friend node<elem_type>& operator << (node<elem_type>& lhs, node<elem_type>* rhs) {
         lhs.linear_insert(rhs);
         return (node<elem_type>&)*rhs;
     }
@@ -214,6 +235,10 @@ public:
 private:
     elem_type elem_value;
     node<elem_type>* next_node;
+
+    static constexpr void record(const util::instrumentation::event event, const std::size_t n = 1) noexcept {
+        util::instrumentation::record(util::instrumentation::structure::node, event, n);
+    }
 };
 
 /**
@@ -223,7 +248,7 @@ private:
  * \return void
  */
 template<typename elem_type>
-void
+constexpr void
 node<elem_type>::linear_insert(node<elem_type>* elem) noexcept {
     if (elem == nullptr) {
         std::cout << "Warning! Attempting to linearly link a null pointer" << "\n";
@@ -310,6 +335,7 @@ node<elem_type>::print_all_after(const linked_list<elem_type>* const elem) {
     while (temp != nullptr) {
         std::cout << temp->value() << " -> ";
         temp = temp->next_node;
+        record(util::instrumentation::event::traversal_steps);
     }
     std::cout << "nullptr\n";
 
@@ -330,6 +356,8 @@ node<elem_type>::operator new(std::size_t size) {
     }
 
     if (void* ptr = std::malloc(size)) {
+        record(util::instrumentation::event::allocations);
+        record(util::instrumentation::event::bytes_allocated, size);
         return ptr;
     }
 
@@ -340,11 +368,16 @@ node<elem_type>::operator new(std::size_t size) {
  * Overloaded delete operator to deallocate a node on the heap.
  *
  * \param ptr
+ * \param size, the size requested from operator new
  * \return void
  */
 template<typename elem_type>
 void
-node<elem_type>::operator delete(void* ptr) noexcept {
+node<elem_type>::operator delete(void* ptr, std::size_t size) noexcept {
+    if (ptr != nullptr) {
+        record(util::instrumentation::event::deallocations);
+        record(util::instrumentation::event::bytes_deallocated, size);
+    }
     std::free(ptr);
     return;
 }
@@ -359,7 +392,10 @@ node<elem_type>::operator delete(void* ptr) noexcept {
 template<typename elem_type>
 [[nodiscard]] void*
 node<elem_type>::operator new[](std::size_t count) {
-    return ::operator new[](count);
+    void* ptr = ::operator new[](count);
+    record(util::instrumentation::event::allocations);
+    record(util::instrumentation::event::bytes_allocated, count);
+    return ptr;
 }
 
 /**
@@ -371,6 +407,10 @@ node<elem_type>::operator new[](std::size_t count) {
 template<typename elem_type>
 void
 node<elem_type>::operator delete[](void* ptr, std::size_t size) {
+    if (ptr != nullptr) {
+        record(util::instrumentation::event::deallocations);
+        record(util::instrumentation::event::bytes_deallocated, size);
+    }
     ::operator delete[](ptr);
     return;
 }
@@ -7,6 +7,7 @@
  *********************************************************************/
 
 #include <iostream>
+#include <memory>
 #include <QTest>
 #include <QDebug>
 #include <node.hpp>
@@ -36,6 +37,9 @@ private slots:
 
     /* miscellaneous print overloads */
     void testMiscPrintFn();
+
+    /* constant evaluation */
+    void testConstantEvaluation();
 };
 
 void TestPrimitiveNode::testDefaultInit()
@@ -211,5 +215,49 @@ void TestPrimitiveNode::testMiscPrintFn()
     return;
 }
 
+void TestPrimitiveNode::testConstantEvaluation()
+{
+    using namespace util::data_structure;
+    std::cout << "\033[32mTesting nodes in constant expressions \033[m" << "\n";
+
+    /* nodes with automatic storage, linked with operator >> */
+    constexpr auto linked_on_stack = [] {
+        node<int> n1(1), n2(2), n3(3);
+        n1 >> &n3;
+        n1 >> &n2;
+        int digits = 0;
+        for (const node<int>* n = &n1; n != nullptr; n = n->next()) {
+            digits = digits * 10 + n->value();
+        }
+        return digits;
+    };
+    static_assert(linked_on_stack() == 123);
+
+    /* nodes from std::allocator, since the class operator new cannot be constexpr */
+    constexpr auto sum_allocated = [](const int count) {
+        std::allocator<node<int>> allocator;
+        node<int>* head = nullptr;
+        for (int i = 1; i <= count; ++i) {
+            head = std::construct_at(allocator.allocate(1), i, head);
+        }
+        int sum = 0;
+        while (head != nullptr) {
+            sum += head->value();
+            node<int>* const next = head->next();
+            std::destroy_at(head);
+            allocator.deallocate(head, 1);
+            head = next;
+        }
+        return sum;
+    };
+    static_assert(sum_allocated(10) == 55);
+    static_assert(node<int>(1) < node<int>(2));
+
+    QCOMPARE_EQ(linked_on_stack(), 123);
+    QCOMPARE_EQ(sum_allocated(100), 5050);
+
+    return;
+}
+
 QTEST_MAIN(TestPrimitiveNode)
 #include "qtest_primitive_node.moc"
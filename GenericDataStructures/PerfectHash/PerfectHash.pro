@@ -0,0 +1,20 @@
+######################################################################
+# Compile-time perfect hash map test cases with QTest framework
+######################################################################
+
+QT += core testlib
+TEMPLATE = app
+TARGET = PerfectHash
+INCLUDEPATH += .
+QMAKE_CXXFLAGS += -std=c++23 -Wall -Wextra -pedantic
+
+# You can make your code fail to compile if you use deprecated APIs.
+# In order to do so, uncomment the following line.
+# Please consult the documentation of the deprecated API in order to know
+# how to port your code away from it.
+# You can also select to disable deprecated APIs only up to a certain version of Qt.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+# Input
+HEADERS += perfect_hash.hpp ../LinearVector/linear_vector.hpp ../../DataStructures/HashTable/person.h
+SOURCES += qtest_perfect_hash.cpp
@@ -0,0 +1,48 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Compile-time perfect hash map test cases.
+ *
+ * The CPerson names of "../../DataStructures/HashTable/main.c" hashed
+ * into a table built by the compiler, checked with static_assert, then
+ * looked up at run time next to the hash_name64 of the C hash tables.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <stdlib.h>
+#include <string_view>
+
+#include <perfect_hash.hpp>
+#include "../../DataStructures/HashTable/person.h"
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+
+    /* ---------------------------------------------- */
+    /* testing construction at compile time           */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mBuilding a table of CPerson names at compile time \033[m" << "\n";
+    constexpr auto ages = make_perfect_hash_map<std::string_view, int>({
+        { "Jacob", 40 }, { "Andy", 20 }, { "Liam", 34 }
+    });
+    static_assert(ages.at("Jacob") == 40 && ages.at("Andy") == 20 && ages.at("Liam") == 34);
+    static_assert(!ages.contains("Emma"));
+    for (const auto& [name, age] : ages) {
+        std::cout << "slot " << ages.index_of(name) << ": " << name << " is " << age << "\n";
+    }
+
+    /* ---------------------------------------------- */
+    /* testing lookup at run time                     */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mLooking names up at run time \033[m" << "\n";
+    for (const std::string_view name : { "Liam", "Emma" }) {
+        std::cout << name << " is " << (ages.contains(name) ? "found" : "missing")
+                  << ", hash_name64 agrees: " << std::boolalpha
+                  << (constexpr_hash<std::string_view>{}(name) == hash_name64(name.data(), name.size())) << "\n";
+    }
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,245 @@
+/*****************************************************************//**
+ * \file   perfect_hash.hpp
+ * \brief  Minimal perfect hash map built at compile time.
+ *
+ * perfect_hash_map<Key, Value, N> holds a fixed set of N keys in exactly
+ * N slots, each key in a slot of its own, so a lookup hashes the key
+ * once, reads one seed and one slot and compares one key: no probing and
+ * no empty slots. The table is built by hash and displace: the keys are
+ * split into N buckets by their hash, and for each bucket, largest first,
+ * a seed is searched for that sends all of its keys to free slots when
+ * mixed into their hash. Lookup mixes in the seed of the key's bucket.
+ *
+ * The constructor is constexpr, so a table of static keys, such as the
+ * names of the CPerson records, can be a constexpr variable: built by the
+ * compiler and placed in read-only data with no start-up cost. Duplicate
+ * keys throw std::invalid_argument, which is a compile error there.
+ *
+ * The hash is constexpr_hash, since std::hash is not usable in constant
+ * expressions; for strings it is hash_name64 of
+ * "../../DataStructures/HashTable/person.h", so compile-time and run-time
+ * tables agree on the hash of a name.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef PERFECT_HASH_HPP
+#define PERFECT_HASH_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "../LinearVector/linear_vector.hpp"
+
+namespace util::data_structure {
+
+/* the murmur3 64-bit finalizer, which maps 0 to 0 */
+constexpr std::uint64_t mix64(std::uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+/* a 64-bit hash usable in constant expressions */
+template<typename _Key>
+struct constexpr_hash;
+
+/* FNV-1a over the characters, then mix64: hash_name64 of person.h */
+template<>
+struct constexpr_hash<std::string_view> {
+    constexpr std::uint64_t operator () (const std::string_view key) const {
+        std::uint64_t hash_value = 0xcbf29ce484222325ULL;
+        for (const char c : key) {
+            hash_value ^= static_cast<unsigned char>(c);
+            hash_value *= 0x100000001b3ULL;
+        }
+        return mix64(hash_value);
+    }
+};
+
+template<std::integral _Key>
+struct constexpr_hash<_Key> {
+    constexpr std::uint64_t operator () (const _Key key) const {
+        return mix64(static_cast<std::uint64_t>(key));
+    }
+};
+
+template<typename _Key, typename _Value, std::size_t _Size, typename _Hash = constexpr_hash<_Key>>
+requires std::default_initializable<_Key> && std::default_initializable<_Value>
+class perfect_hash_map {
+public:
+    using key_type = _Key;
+    using mapped_type = _Value;
+    using value_type = std::pair<_Key, _Value>;
+    using size_type = std::size_t;
+    using const_iterator = const value_type*;
+    using iterator = const_iterator;
+
+    /* seeds tried per bucket before giving up, far more than a bucket needs */
+    static constexpr std::uint32_t max_seed = std::uint32_t{ 1 } << 20;
+
+    /*
+     * Place every entry in a slot of its own. Throws std::invalid_argument
+     * on duplicate keys, and std::length_error on two keys of the same hash
+     * or if some bucket finds no seed within max_seed tries.
+     */
+    constexpr explicit perfect_hash_map(const std::array<value_type, _Size>& entries, const _Hash& h = _Hash())
+        : hash(h) {
+        build(entries);
+    }
+
+    /* iterators, over the entries in slot order */
+    constexpr const_iterator begin() const { return table.data(); }
+    constexpr const_iterator end() const { return table.data() + _Size; }
+
+    /* capacity */
+    [[nodiscard]] constexpr bool empty() const { return _Size == 0; }
+    constexpr size_type size() const { return _Size; }
+
+    /* the slot of key in [0, size()), or size() if it is not in the map; a dense index for parallel arrays */
+    constexpr size_type index_of(const _Key& key) const {
+        if constexpr (_Size == 0) {
+            return 0;
+        }
+        else {
+            const std::uint64_t hash_value = hash(key);
+            const size_type slot = slot_of(hash_value, seeds[bucket_of(hash_value)]);
+            return table[slot].first == key ? slot : _Size;
+        }
+    }
+
+    /* lookup */
+    constexpr const_iterator find(const _Key& key) const { return begin() + index_of(key); }
+    constexpr bool contains(const _Key& key) const { return index_of(key) != _Size; }
+
+    /* the value of key, throws std::out_of_range if it is not in the map */
+    constexpr const _Value& at(const _Key& key) const {
+        const size_type slot = index_of(key);
+        if (slot == _Size) {
+            throw std::out_of_range("key is not in the map");
+        }
+        return table[slot].second;
+    }
+
+private:
+    std::array<value_type, _Size> table{};
+    std::array<std::uint32_t, _Size> seeds{};
+    [[no_unique_address]] _Hash hash;
+
+    static constexpr size_type bucket_of(const std::uint64_t hash_value) {
+        return static_cast<size_type>(hash_value % _Size);
+    }
+
+    static constexpr size_type slot_of(const std::uint64_t hash_value, const std::uint32_t seed) {
+        return static_cast<size_type>(mix64(hash_value ^ (seed * 0x9e3779b97f4a7c15ULL)) % _Size);
+    }
+
+    constexpr void build(const std::array<value_type, _Size>& entries) {
+        if constexpr (_Size > 0) {
+            LinearVector<std::uint64_t> hashes;
+            for (const value_type& entry : entries) {
+                hashes.push_back(hash(entry.first));
+            }
+
+            /* the entries of each bucket, contiguous in members from first[bucket] on, by counting sort */
+            LinearVector<size_type> first;
+            for (size_type bucket = 0; bucket <= _Size; ++bucket) {
+                first.push_back(0);
+            }
+            for (const std::uint64_t hash_value : hashes) {
+                ++first[bucket_of(hash_value) + 1];
+            }
+            for (size_type bucket = 0; bucket < _Size; ++bucket) {
+                first[bucket + 1] += first[bucket];
+            }
+            LinearVector<size_type> members;
+            LinearVector<size_type> filled;
+            for (size_type i = 0; i < _Size; ++i) {
+                members.push_back(0);
+                filled.push_back(first[i]);
+            }
+            for (size_type i = 0; i < _Size; ++i) {
+                members[filled[bucket_of(hashes[i])]++] = i;
+            }
+
+            /* the largest buckets are placed first, while most slots are free */
+            LinearVector<size_type> order;
+            for (size_type bucket = 0; bucket < _Size; ++bucket) {
+                order.push_back(bucket);
+            }
+            const auto bucket_size = [&](const size_type bucket) { return first[bucket + 1] - first[bucket]; };
+            std::sort(order.begin(), order.end(), [&](const size_type lhs, const size_type rhs) {
+                return bucket_size(lhs) != bucket_size(rhs) ? bucket_size(lhs) > bucket_size(rhs) : lhs < rhs;
+            });
+
+            std::array<bool, _Size> taken{};
+            LinearVector<size_type> placed;
+            for (const size_type bucket : order) {
+                if (bucket_size(bucket) == 0) {
+                    break;
+                }
+                const size_type* const begin_member = members.data() + first[bucket];
+                const size_type* const end_member = members.data() + first[bucket + 1];
+                for (const size_type* m = begin_member; m != end_member; ++m) {
+                    for (const size_type* other = begin_member; other != m; ++other) {
+                        if (entries[*m].first == entries[*other].first) {
+                            throw std::invalid_argument("duplicate key in perfect_hash_map");
+                        }
+                        if (hashes[*m] == hashes[*other]) {
+                            throw std::length_error("two keys of the same hash in perfect_hash_map");
+                        }
+                    }
+                }
+                seeds[bucket] = place(entries, hashes, begin_member, end_member, taken, placed);
+            }
+        }
+        return;
+    }
+
+    /* the first seed that sends every member of a bucket to a free slot, filling those slots */
+    constexpr std::uint32_t place(const std::array<value_type, _Size>& entries, const LinearVector<std::uint64_t>& hashes,
+                                  const size_type* const begin_member, const size_type* const end_member,
+                                  std::array<bool, _Size>& taken, LinearVector<size_type>& placed) {
+        for (std::uint32_t seed = 1; seed <= max_seed; ++seed) {
+            placed.clear();
+            for (const size_type* m = begin_member; m != end_member; ++m) {
+                const size_type slot = slot_of(hashes[*m], seed);
+                if (taken[slot]) {
+                    break;
+                }
+                taken[slot] = true;
+                placed.push_back(slot);
+            }
+            if (placed.size() == static_cast<size_type>(end_member - begin_member)) {
+                for (size_type i = 0; i < placed.size(); ++i) {
+                    table[placed[i]] = entries[begin_member[i]];
+                }
+                return seed;
+            }
+            for (const size_type slot : placed) {
+                taken[slot] = false;
+            }
+        }
+        throw std::length_error("no seed places the bucket in perfect_hash_map");
+    }
+};
+
+/* make_perfect_hash_map<std::string_view, int>({ { "Jacob", 40 }, { "Andy", 20 } }) */
+template<typename _Key, typename _Value, std::size_t _Size>
+constexpr perfect_hash_map<_Key, _Value, _Size> make_perfect_hash_map(std::pair<_Key, _Value> (&&entries)[_Size]) {
+    return perfect_hash_map<_Key, _Value, _Size>(std::to_array(std::move(entries)));
+}
+
+} // namespace util::data_structure
+
+#endif // PERFECT_HASH_HPP
@@ -0,0 +1,140 @@
+/*****************************************************************//**
+ * \file   qtest_perfect_hash.cpp
+ * \brief  perfect_hash_map<> test cases with QTest framework.
+ *
+ * Tables are built at compile time and checked with static_assert, and
+ * at run time from thousands of generated names, every key of which must
+ * land in a slot of its own and be found again.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include <perfect_hash.hpp>
+#include "../../DataStructures/HashTable/person.h"
+
+class TestPerfectHash : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    void compileTimeNames() const;
+    void compileTimeIntegers() const;
+    void runTimeNames() const;
+    void hashIsHashName64() const;
+    void duplicateAndMissingKeysThrow() const;
+};
+
+void TestPerfectHash::compileTimeNames() const
+{
+    using namespace util::data_structure;
+    constexpr auto ages = make_perfect_hash_map<std::string_view, int>({
+        { "Jacob", 40 }, { "Andy", 20 }, { "Liam", 34 }, { "Emma", 28 }, { "Olivia", 31 }
+    });
+
+    qDebug() << "The table is a constant: lookups are checked by the compiler";
+    static_assert(ages.size() == 5);
+    static_assert(ages.at("Jacob") == 40 && ages.at("Andy") == 20 && ages.at("Olivia") == 31);
+    static_assert(!ages.contains("Noah") && ages.find("Noah") == ages.end());
+
+    qDebug() << "Every name has a slot of its own";
+    std::array<bool, 5> seen{};
+    for (const auto& [name, age] : ages) {
+        QCOMPARE_EQ(ages.at(name), age);
+        QVERIFY(!seen[ages.index_of(name)]);
+        seen[ages.index_of(name)] = true;
+    }
+
+    return;
+}
+
+void TestPerfectHash::compileTimeIntegers() const
+{
+    using namespace util::data_structure;
+    constexpr auto squares = [] {
+        std::array<std::pair<int, long>, 500> entries{};
+        for (int i = 0; i < 500; ++i) {
+            entries[i] = { i * 7919, static_cast<long>(i) * i };
+        }
+        return perfect_hash_map<int, long, 500>(entries);
+    }();
+
+    qDebug() << "Five hundred integer keys placed by the compiler";
+    static_assert(squares.at(7919 * 499) == 499L * 499);
+    static_assert(!squares.contains(1));
+    for (int i = 0; i < 500; ++i) {
+        QCOMPARE_EQ(squares.at(i * 7919), static_cast<long>(i) * i);
+    }
+
+    return;
+}
+
+void TestPerfectHash::runTimeNames() const
+{
+    using namespace util::data_structure;
+    constexpr std::size_t count = 5000;
+    std::vector<std::string> names;
+    std::array<std::pair<std::string_view, std::size_t>, count> entries{};
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        names.push_back("person " + std::to_string(i));
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        entries[i] = { names[i], i };
+    }
+
+    qDebug() << "The constructor also runs at run time, here on 5000 names";
+    const perfect_hash_map<std::string_view, std::size_t, count> people(entries);
+    std::vector<bool> seen(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        QCOMPARE_EQ(people.at(names[i]), i);
+        QVERIFY(!seen[people.index_of(names[i])]);
+        seen[people.index_of(names[i])] = true;
+    }
+    QVERIFY(!people.contains("person 5000"));
+
+    return;
+}
+
+void TestPerfectHash::hashIsHashName64() const
+{
+    using namespace util::data_structure;
+    qDebug() << "constexpr_hash of a name is the hash_name64 of the C hash tables";
+    for (const std::string_view name : { "", "Jacob", "Andy", "Liam", "person 42" }) {
+        QCOMPARE_EQ(constexpr_hash<std::string_view>{}(name), hash_name64(name.data(), name.size()));
+    }
+
+    return;
+}
+
+void TestPerfectHash::duplicateAndMissingKeysThrow() const
+{
+    using namespace util::data_structure;
+    const std::array<std::pair<std::string_view, int>, 3> entries = { {
+        { "Jacob", 40 }, { "Andy", 20 }, { "Jacob", 41 }
+    } };
+    QVERIFY_THROWS_EXCEPTION(std::invalid_argument, (perfect_hash_map<std::string_view, int, 3>(entries)));
+
+    const auto ages = make_perfect_hash_map<std::string_view, int>({ { "Jacob", 40 } });
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, ages.at("Andy"));
+
+    return;
+}
+
+QTEST_MAIN(TestPerfectHash)
+#include "qtest_perfect_hash.moc"
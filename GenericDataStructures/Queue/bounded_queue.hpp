@@ -0,0 +1,359 @@
+/*****************************************************************//**
+ * \file   bounded_queue.hpp
+ * \brief  Lock-free bounded queues on power-of-two ring buffers.
+ *
+ * spsc_ring_buffer hands elements from exactly one producer thread to
+ * exactly one consumer thread. Each side owns one index and keeps a cached
+ * copy of the other side's, on its own cache line, so an uncontended push
+ * or pop touches no cache line written by the other thread. The batch
+ * operations publish a whole run of elements with one release store.
+ *
+ * mpmc_queue is Dmitry Vyukov's bounded MPMC queue: every slot carries a
+ * sequence number telling producers and consumers whose turn it is, so one
+ * compare-and-swap on the shared position claims a slot and no thread ever
+ * waits on a lock.
+ *
+ * Capacities are rounded up to a power of two so an index maps to its slot
+ * with a mask. Both queues only offer try_ operations that fail instead of
+ * blocking; callers pick their own spinning or back-off policy.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef BOUNDED_QUEUE_HPP
+#define BOUNDED_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace util::data_structure {
+
+/* fixed rather than std::hardware_destructive_interference_size, which may change between compiler versions */
+inline constexpr std::size_t cache_line_size = 64;
+
+template<typename _Elem>
+class spsc_ring_buffer final {
+    using elem_type = _Elem;
+
+public:
+    /* capacity is rounded up to a power of two */
+    explicit spsc_ring_buffer(const std::size_t capacity)
+        : mask(std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1)
+        , buffer(std::allocator<elem_type>{}.allocate(mask + 1)) {}
+
+    spsc_ring_buffer(const spsc_ring_buffer<elem_type>&) = delete;
+    spsc_ring_buffer<elem_type>& operator = (const spsc_ring_buffer<elem_type>&) = delete;
+
+    /* destroys the elements still queued, no thread may use the queue any more */
+    ~spsc_ring_buffer() {
+        for (std::size_t index = consumer.head.load(std::memory_order_relaxed);
+             index != producer.tail.load(std::memory_order_relaxed); ++index) {
+            std::destroy_at(buffer + (index & mask));
+        }
+        std::allocator<elem_type>{}.deallocate(buffer, mask + 1);
+    }
+
+    /* producer: construct an element at the back, false if the queue is full */
+    template<typename... _Args>
+    bool try_emplace(_Args&&... args) {
+        const std::size_t tail = producer.tail.load(std::memory_order_relaxed);
+        if (tail - producer.cached_head > mask) {
+            producer.cached_head = consumer.head.load(std::memory_order_acquire);
+            if (tail - producer.cached_head > mask) {
+                return false;
+            }
+        }
+        std::construct_at(buffer + (tail & mask), std::forward<_Args>(args)...);
+        producer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const elem_type& value) { return try_emplace(value); }
+    bool try_push(elem_type&& value) { return try_emplace(std::move(value)); }
+
+    /* producer: push up to count elements from first, returns how many were pushed */
+    template<std::input_iterator _InputIt>
+    std::size_t try_push_n(_InputIt first, const std::size_t count) {
+        const std::size_t tail = producer.tail.load(std::memory_order_relaxed);
+        std::size_t space = mask + 1 - (tail - producer.cached_head);
+        if (space < count) {
+            producer.cached_head = consumer.head.load(std::memory_order_acquire);
+            space = mask + 1 - (tail - producer.cached_head);
+        }
+        const std::size_t n = std::min(space, count);
+        std::size_t pushed = 0;
+        try {
+            for (; pushed < n; ++pushed, ++first) {
+                std::construct_at(buffer + ((tail + pushed) & mask), *first);
+            }
+        }
+        catch (...) {
+            /* publish what was constructed before the exception */
+            producer.tail.store(tail + pushed, std::memory_order_release);
+            throw;
+        }
+        producer.tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /* consumer: move the front element into value, false if the queue is empty */
+    bool try_pop(elem_type& value) {
+        const std::size_t head = consumer.head.load(std::memory_order_relaxed);
+        if (head == consumer.cached_tail) {
+            consumer.cached_tail = producer.tail.load(std::memory_order_acquire);
+            if (head == consumer.cached_tail) {
+                return false;
+            }
+        }
+        elem_type* const slot = buffer + (head & mask);
+        value = std::move(*slot);
+        std::destroy_at(slot);
+        consumer.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<elem_type> try_pop() {
+        const std::size_t head = consumer.head.load(std::memory_order_relaxed);
+        if (head == consumer.cached_tail) {
+            consumer.cached_tail = producer.tail.load(std::memory_order_acquire);
+            if (head == consumer.cached_tail) {
+                return std::nullopt;
+            }
+        }
+        elem_type* const slot = buffer + (head & mask);
+        std::optional<elem_type> value(std::move(*slot));
+        std::destroy_at(slot);
+        consumer.head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+    /* consumer: move up to count elements to out, returns how many were popped */
+    template<std::weakly_incrementable _OutputIt>
+    requires std::indirectly_writable<_OutputIt, elem_type&&>
+    std::size_t try_pop_n(_OutputIt out, const std::size_t count) {
+        const std::size_t head = consumer.head.load(std::memory_order_relaxed);
+        std::size_t available = consumer.cached_tail - head;
+        if (available < count) {
+            consumer.cached_tail = producer.tail.load(std::memory_order_acquire);
+            available = consumer.cached_tail - head;
+        }
+        const std::size_t n = std::min(available, count);
+        std::size_t popped = 0;
+        try {
+            for (; popped < n; ++out) {
+                elem_type* const slot = buffer + ((head + popped) & mask);
+                *out = std::move(*slot);
+                std::destroy_at(slot);
+                ++popped;
+            }
+        }
+        catch (...) {
+            /* release the slots already moved out and destroyed, the one that threw stays queued */
+            consumer.head.store(head + popped, std::memory_order_release);
+            throw;
+        }
+        consumer.head.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    /* exact only when called from the producer or the consumer while the other is idle */
+    std::size_t size() const {
+        /* head first: the tail read afterwards can only be further ahead */
+        const std::size_t head = consumer.head.load(std::memory_order_acquire);
+        return producer.tail.load(std::memory_order_acquire) - head;
+    }
+
+    [[nodiscard]] bool empty() const { return size() == 0; }
+    std::size_t capacity() const { return mask + 1; }
+
+private:
+    /* written by the producer only */
+    struct alignas(cache_line_size) producer_side {
+        std::atomic<std::size_t> tail{ 0 };
+        std::size_t cached_head{ 0 };
+    };
+
+    /* written by the consumer only */
+    struct alignas(cache_line_size) consumer_side {
+        std::atomic<std::size_t> head{ 0 };
+        std::size_t cached_tail{ 0 };
+    };
+
+    /* read-only after construction, on a line of its own */
+    alignas(cache_line_size) const std::size_t mask;
+    elem_type* const buffer;
+
+    producer_side producer;
+    consumer_side consumer;
+};
+
+template<typename _Elem>
+class mpmc_queue final {
+    using elem_type = _Elem;
+
+    /* a claimed slot must be filled, so elements are moved in without throwing */
+    static_assert(std::is_nothrow_move_constructible_v<elem_type>, "mpmc_queue requires a nothrow move constructor");
+
+public:
+    /* capacity is rounded up to a power of two of at least 2 */
+    explicit mpmc_queue(const std::size_t capacity)
+        : mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+        , cells(std::allocator<cell>{}.allocate(mask + 1)) {
+        /* slot i is free for the producer claiming position i */
+        for (std::size_t i = 0; i <= mask; ++i) {
+            std::construct_at(cells + i, i);
+        }
+    }
+
+    mpmc_queue(const mpmc_queue<elem_type>&) = delete;
+    mpmc_queue<elem_type>& operator = (const mpmc_queue<elem_type>&) = delete;
+
+    /* destroys the elements still queued, no thread may use the queue any more */
+    ~mpmc_queue() {
+        for (std::size_t position = dequeue_position.load(std::memory_order_relaxed);
+             position != enqueue_position.load(std::memory_order_relaxed); ++position) {
+            std::destroy_at(cells[position & mask].element());
+        }
+        std::destroy(cells, cells + mask + 1);
+        std::allocator<cell>{}.deallocate(cells, mask + 1);
+    }
+
+    /* construct an element at the back, false if the queue is full */
+    template<typename... _Args>
+    bool try_emplace(_Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<elem_type, _Args...>) {
+            std::size_t position = 0;
+            cell* const slot = claim_for_push(position);
+            if (slot == nullptr) {
+                return false;
+            }
+            std::construct_at(slot->element(), std::forward<_Args>(args)...);
+            slot->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+        else {
+            /* construct first, a throwing constructor must not leave a claimed slot empty */
+            elem_type value(std::forward<_Args>(args)...);
+            return try_emplace(std::move(value));
+        }
+    }
+
+    bool try_push(const elem_type& value) { return try_emplace(value); }
+    bool try_push(elem_type&& value) { return try_emplace(std::move(value)); }
+
+    /* move the front element into value, false if the queue is empty */
+    bool try_pop(elem_type& value) {
+        std::size_t position = 0;
+        cell* const slot = claim_for_pop(position);
+        if (slot == nullptr) {
+            return false;
+        }
+        /* move out without throwing and free the slot first: an assignment that
+         * throws must not leave the slot claimed, wedging every later lap */
+        elem_type popped(std::move(*slot->element()));
+        release_pop(slot, position);
+        value = std::move(popped);
+        return true;
+    }
+
+    std::optional<elem_type> try_pop() {
+        std::size_t position = 0;
+        cell* const slot = claim_for_pop(position);
+        if (slot == nullptr) {
+            return std::nullopt;
+        }
+        std::optional<elem_type> value(std::move(*slot->element()));
+        release_pop(slot, position);
+        return value;
+    }
+
+    /* a snapshot, possibly stale by the time it is returned */
+    std::size_t size() const {
+        const std::size_t dequeued = dequeue_position.load(std::memory_order_acquire);
+        const std::size_t enqueued = enqueue_position.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    [[nodiscard]] bool empty() const { return size() == 0; }
+    std::size_t capacity() const { return mask + 1; }
+
+private:
+    /* sequence == position: free for the producer of that position;
+       sequence == position + 1: full, ready for the consumer of that position */
+    struct cell {
+        explicit cell(const std::size_t position) : sequence(position) {}
+
+        std::atomic<std::size_t> sequence;
+        alignas(elem_type) std::byte storage[sizeof(elem_type)];
+
+        elem_type* element() { return std::launder(reinterpret_cast<elem_type*>(storage)); }
+    };
+
+    cell* claim_for_push(std::size_t& position) {
+        position = enqueue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            cell* const slot = cells + (position & mask);
+            const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0) {
+                if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    return slot;
+                }
+            }
+            else if (difference < 0) {
+                /* the consumer of the previous lap has not freed the slot: full */
+                return nullptr;
+            }
+            else {
+                position = enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    cell* claim_for_pop(std::size_t& position) {
+        position = dequeue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            cell* const slot = cells + (position & mask);
+            const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0) {
+                if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    return slot;
+                }
+            }
+            else if (difference < 0) {
+                /* no producer has filled the slot yet: empty */
+                return nullptr;
+            }
+            else {
+                position = dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /* free the slot for the producer of the next lap */
+    void release_pop(cell* const slot, const std::size_t position) {
+        std::destroy_at(slot->element());
+        slot->sequence.store(position + mask + 1, std::memory_order_release);
+        return;
+    }
+
+    alignas(cache_line_size) const std::size_t mask;
+    cell* const cells;
+
+    alignas(cache_line_size) std::atomic<std::size_t> enqueue_position{ 0 };
+    alignas(cache_line_size) std::atomic<std::size_t> dequeue_position{ 0 };
+};
+
+} // namespace util::data_structure
+
+#endif // BOUNDED_QUEUE_HPP
@@ -0,0 +1,97 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Lock-free bounded queue test cases.
+ *
+ * A two-stage pipeline: a producer thread hands numbers to a worker
+ * through an spsc_ring_buffer in batches, and two workers hand their
+ * results to the main thread through one mpmc_queue.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <stdlib.h>
+#include <thread>
+
+#include <bounded_queue.hpp>
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+
+    static constexpr std::int64_t count = 100000;
+    static constexpr std::size_t batch = 32;
+
+    /* ------------------------------------ */
+    /* testing spsc_ring_buffer batch moves */
+    /* ------------------------------------ */
+    std::cout << "\033[32mHanding " << count << " numbers through spsc_ring_buffer<> \033[m" << "\n";
+    spsc_ring_buffer<std::int64_t> numbers(1000);
+    std::cout << "capacity() -> " << numbers.capacity() << "\n";
+
+    std::thread producer([&numbers] {
+        std::array<std::int64_t, batch> staged{};
+        for (std::int64_t next = 0; next < count;) {
+            const std::size_t n = std::min<std::size_t>(batch, static_cast<std::size_t>(count - next));
+            std::iota(staged.begin(), staged.begin() + n, next);
+            std::size_t pushed = 0;
+            while (pushed < n) {
+                pushed += numbers.try_push_n(staged.begin() + pushed, n - pushed);
+                std::this_thread::yield();
+            }
+            next += static_cast<std::int64_t>(n);
+        }
+    });
+
+    /* ---------------------------------------------------- */
+    /* testing mpmc_queue with two producers and one reader */
+    /* ---------------------------------------------------- */
+    mpmc_queue<std::int64_t> squares(64);
+    std::thread worker([&numbers, &squares] {
+        std::array<std::int64_t, batch> received{};
+        for (std::int64_t seen = 0; seen < count;) {
+            const std::size_t n = numbers.try_pop_n(received.begin(), batch);
+            for (std::size_t i = 0; i < n; ++i) {
+                while (!squares.try_push(received[i] * received[i])) {
+                    std::this_thread::yield();
+                }
+            }
+            seen += static_cast<std::int64_t>(n);
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::thread counter([&squares] {
+        for (std::int64_t i = 0; i < 1000; ++i) {
+            while (!squares.try_push(-1)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::int64_t sum = 0;
+    std::int64_t markers = 0;
+    for (std::int64_t received = 0; received < count + 1000;) {
+        if (const auto value = squares.try_pop()) {
+            *value < 0 ? ++markers : sum += *value;
+            ++received;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    worker.join();
+    counter.join();
+
+    std::cout << "Sum of squares -> " << sum << " (expected " << (count - 1) * count * (2 * count - 1) / 6 << ")\n";
+    std::cout << "Markers from the second producer -> " << markers << "\n";
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
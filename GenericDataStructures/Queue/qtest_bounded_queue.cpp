@@ -0,0 +1,331 @@
+/*****************************************************************//**
+ * \file   qtest_bounded_queue.cpp
+ * \brief  spsc_ring_buffer<> and mpmc_queue<> test cases with QTest framework.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include <bounded_queue.hpp>
+
+/* counts live instances, to check that queued elements are destroyed */
+struct Tracked
+{
+    static inline int live = 0;
+    int value;
+
+    explicit Tracked(int v = 0) noexcept : value(v) { ++live; }
+    Tracked(const Tracked& other) noexcept : value(other.value) { ++live; }
+    Tracked& operator = (const Tracked&) = default;
+    ~Tracked() { --live; }
+};
+
+/* moved in without throwing, but its assignment throws when asked to or once the countdown runs out */
+struct ThrowingAssign
+{
+    static inline bool throw_on_assign = false;
+    static inline int assignments_left = -1;
+    int value;
+
+    explicit ThrowingAssign(int v = 0) noexcept : value(v) {}
+    ThrowingAssign(ThrowingAssign&& other) noexcept : value(other.value) {}
+    ThrowingAssign& operator = (ThrowingAssign&& other) {
+        if (throw_on_assign || assignments_left == 0) {
+            throw std::runtime_error("assign");
+        }
+        if (assignments_left > 0) {
+            --assignments_left;
+        }
+        value = other.value;
+        return *this;
+    }
+};
+
+class TestBoundedQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    /* spsc_ring_buffer<> */
+    void spscCapacityAndOrder() const;
+    void spscBatchWrapAround() const;
+    void spscTwoThreads() const;
+    void spscBatchThrowingAssignment() const;
+
+    /* mpmc_queue<> */
+    void mpmcCapacityAndOrder() const;
+    void mpmcManyThreads() const;
+    void mpmcThrowingAssignment() const;
+
+    /* both */
+    void moveOnlyAndDestruction() const;
+};
+
+void TestBoundedQueue::spscCapacityAndOrder() const
+{
+    using util::data_structure::spsc_ring_buffer;
+
+    qDebug() << "Capacity is rounded up to a power of two";
+    spsc_ring_buffer<int> queue(5);
+    QCOMPARE_EQ(queue.capacity(), 8);
+    QVERIFY(queue.empty());
+
+    qDebug() << "Push until full, pop in FIFO order until empty";
+    for (int i = 0; i < 8; ++i) {
+        QVERIFY(queue.try_push(i));
+    }
+    QVERIFY(!queue.try_push(8));
+    QCOMPARE_EQ(queue.size(), 8);
+    for (int i = 0; i < 8; ++i) {
+        QCOMPARE_EQ(queue.try_pop().value(), i);
+    }
+    QVERIFY(!queue.try_pop().has_value());
+
+    return;
+}
+
+void TestBoundedQueue::spscBatchWrapAround() const
+{
+    using util::data_structure::spsc_ring_buffer;
+
+    spsc_ring_buffer<int> queue(8);
+    const std::array<int, 6> batch = { 0, 1, 2, 3, 4, 5 };
+    std::array<int, 8> received{};
+
+    qDebug() << "Batches that wrap around the end of the ring";
+    for (int lap = 0; lap < 5; ++lap) {
+        QCOMPARE_EQ(queue.try_push_n(batch.begin(), batch.size()), 6);
+        QCOMPARE_EQ(queue.try_pop_n(received.begin(), 4), 4);
+        QCOMPARE_EQ(queue.try_pop_n(received.begin() + 4, 4), 2);
+        QVERIFY(std::equal(batch.begin(), batch.end(), received.begin()));
+    }
+
+    qDebug() << "A batch larger than the free space is cut short";
+    QCOMPARE_EQ(queue.try_push_n(batch.begin(), 6), 6);
+    QCOMPARE_EQ(queue.try_push_n(batch.begin(), 6), 2);
+    QCOMPARE_EQ(queue.size(), 8);
+
+    return;
+}
+
+void TestBoundedQueue::spscTwoThreads() const
+{
+    using util::data_structure::spsc_ring_buffer;
+
+    constexpr int count = 200000;
+    spsc_ring_buffer<int> queue(64);
+    std::thread producer([&queue] {
+        for (int i = 0; i < count; ++i) {
+            while (!queue.try_push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    qDebug() << "Every element arrives once and in order";
+    bool in_order = true;
+    for (int expected = 0; expected < count;) {
+        int value = -1;
+        if (queue.try_pop(value)) {
+            in_order = in_order && value == expected;
+            ++expected;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    QVERIFY(in_order);
+    QVERIFY(queue.empty());
+
+    return;
+}
+
+void TestBoundedQueue::spscBatchThrowingAssignment() const
+{
+    using util::data_structure::spsc_ring_buffer;
+
+    qDebug() << "An assignment that throws in try_pop_n releases the elements popped before it";
+    spsc_ring_buffer<ThrowingAssign> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        QVERIFY(queue.try_emplace(i));
+    }
+    ThrowingAssign popped[4];
+    ThrowingAssign::assignments_left = 2;
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, queue.try_pop_n(popped, 4));
+    ThrowingAssign::assignments_left = -1;
+    QCOMPARE_EQ(popped[0].value, 0);
+    QCOMPARE_EQ(popped[1].value, 1);
+    QCOMPARE_EQ(queue.size(), 2);
+
+    qDebug() << "The producer reuses the released slots, the consumer resumes at the one that threw";
+    QVERIFY(queue.try_emplace(4));
+    QVERIFY(queue.try_emplace(5));
+    QVERIFY(!queue.try_emplace(-1));
+    QCOMPARE_EQ(queue.try_pop_n(popped, 4), 4);
+    for (int i = 0; i < 4; ++i) {
+        QCOMPARE_EQ(popped[i].value, i + 2);
+    }
+
+    return;
+}
+
+void TestBoundedQueue::mpmcCapacityAndOrder() const
+{
+    using util::data_structure::mpmc_queue;
+
+    qDebug() << "Capacity is a power of two of at least 2";
+    mpmc_queue<int> tiny(1);
+    QCOMPARE_EQ(tiny.capacity(), 2);
+    mpmc_queue<int> queue(100);
+    QCOMPARE_EQ(queue.capacity(), 128);
+
+    qDebug() << "Single-threaded use is FIFO, across several laps";
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 128; ++i) {
+            QVERIFY(queue.try_push(i));
+        }
+        QVERIFY(!queue.try_push(128));
+        for (int i = 0; i < 128; ++i) {
+            QCOMPARE_EQ(queue.try_pop().value(), i);
+        }
+        QVERIFY(!queue.try_pop().has_value());
+    }
+
+    return;
+}
+
+void TestBoundedQueue::mpmcManyThreads() const
+{
+    using util::data_structure::mpmc_queue;
+
+    constexpr int producers = 3;
+    constexpr int consumers = 3;
+    constexpr std::int64_t per_producer = 50000;
+    mpmc_queue<std::int64_t> queue(32);
+    std::vector<std::thread> threads;
+    std::array<std::int64_t, consumers> sums{};
+    std::array<std::int64_t, consumers> counts{};
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            for (std::int64_t i = 0; i < per_producer; ++i) {
+                while (!queue.try_push(p * per_producer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::atomic<std::int64_t> remaining = producers * per_producer;
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            std::int64_t value = 0;
+            while (remaining.load() > 0) {
+                if (queue.try_pop(value)) {
+                    sums[c] += value;
+                    ++counts[c];
+                    --remaining;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    qDebug() << "Every element is popped exactly once";
+    constexpr std::int64_t total = producers * per_producer;
+    std::int64_t sum = 0;
+    std::int64_t count = 0;
+    for (int c = 0; c < consumers; ++c) {
+        sum += sums[c];
+        count += counts[c];
+    }
+    QCOMPARE_EQ(count, total);
+    QCOMPARE_EQ(sum, total * (total - 1) / 2);
+
+    return;
+}
+
+void TestBoundedQueue::mpmcThrowingAssignment() const
+{
+    using util::data_structure::mpmc_queue;
+
+    qDebug() << "An assignment that throws in try_pop still frees the slot";
+    mpmc_queue<ThrowingAssign> queue(2);
+    QVERIFY(queue.try_emplace(1));
+    QVERIFY(queue.try_emplace(2));
+    ThrowingAssign popped;
+    ThrowingAssign::throw_on_assign = true;
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, queue.try_pop(popped));
+    ThrowingAssign::throw_on_assign = false;
+    QCOMPARE_EQ(queue.size(), 1);
+
+    qDebug() << "Later laps go through the slot that was popped";
+    int expected = 2;
+    for (int lap = 0; lap < 4; ++lap) {
+        QVERIFY(queue.try_emplace(10 + lap));
+        QVERIFY(!queue.try_emplace(-1));
+        QVERIFY(queue.try_pop(popped));
+        QCOMPARE_EQ(popped.value, expected);
+        expected = 10 + lap;
+    }
+    QVERIFY(queue.try_pop(popped));
+    QCOMPARE_EQ(popped.value, 13);
+    QVERIFY(!queue.try_pop(popped));
+
+    return;
+}
+
+void TestBoundedQueue::moveOnlyAndDestruction() const
+{
+    using util::data_structure::mpmc_queue;
+    using util::data_structure::spsc_ring_buffer;
+
+    qDebug() << "Move-only elements";
+    spsc_ring_buffer<std::unique_ptr<int>> spsc(4);
+    QVERIFY(spsc.try_push(std::make_unique<int>(1)));
+    QVERIFY(spsc.try_emplace(new int(2)));
+    QCOMPARE_EQ(*spsc.try_pop().value(), 1);
+    mpmc_queue<std::unique_ptr<int>> mpmc(4);
+    QVERIFY(mpmc.try_push(std::make_unique<int>(3)));
+    QCOMPARE_EQ(*mpmc.try_pop().value(), 3);
+
+    qDebug() << "Elements still queued are destroyed with the queue";
+    {
+        spsc_ring_buffer<Tracked> tracked_spsc(8);
+        mpmc_queue<Tracked> tracked_mpmc(8);
+        for (int i = 0; i < 5; ++i) {
+            tracked_spsc.try_emplace(i);
+            tracked_mpmc.try_emplace(i);
+        }
+        Tracked popped;
+        tracked_spsc.try_pop(popped);
+        tracked_mpmc.try_pop(popped);
+        QCOMPARE_EQ(Tracked::live, 9);
+    }
+    QCOMPARE_EQ(Tracked::live, 0);
+
+    return;
+}
+
+QTEST_MAIN(TestBoundedQueue)
+#include "qtest_bounded_queue.moc"
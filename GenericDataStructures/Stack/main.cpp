@@ -0,0 +1,82 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Contiguous stack adaptor test cases.
+ *
+ * Evaluates a postfix expression on stack<> and walks a small graph
+ * depth-first on fixed_stack<>, the two tight push and pop loops the
+ * adaptor is meant for.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <array>
+#include <cctype>
+#include <iostream>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string_view>
+
+#include <stack.hpp>
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+
+    /* ------------------------------------- */
+    /* testing postfix expression evaluation */
+    /* ------------------------------------- */
+    std::cout << "\033[32mEvaluating postfix expression 3 4 + 2 * 7 - \033[m" << "\n";
+    constexpr std::string_view expression = "3 4 + 2 * 7 -";
+    stack<long> operands;
+    for (const char token : expression) {
+        if (std::isdigit(static_cast<unsigned char>(token))) {
+            operands.emplace(token - '0');
+        }
+        else if (token != ' ') {
+            const long rhs = operands.top();
+            operands.pop();
+            long& lhs = operands.top();
+            switch (token) {
+            case '+': lhs += rhs; break;
+            case '-': lhs -= rhs; break;
+            case '*': lhs *= rhs; break;
+            default: break;
+            }
+        }
+    }
+    std::cout << "Result -> " << operands.top() << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing depth-first traversal on fixed_stack<> */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mDepth-first traversal from vertex 0 \033[m" << "\n";
+    constexpr std::array<std::array<int, 2>, 6> edges = { { { 1, 2 }, { 3, 4 }, { 5, -1 }, { -1, -1 }, { -1, -1 }, { -1, -1 } } };
+    fixed_stack<int, 8> pending;
+    pending.push(0);
+    while (!pending.empty()) {
+        const int vertex = pending.top();
+        pending.pop();
+        std::cout << vertex << " ";
+        for (const int next : edges[vertex]) {
+            if (next >= 0) {
+                pending.push(next);
+            }
+        }
+    }
+    std::cout << "\n";
+
+    /* --------------------------------------- */
+    /* testing push_range and bounded capacity */
+    /* --------------------------------------- */
+    std::cout << "\033[32mPushing a range beyond the fixed capacity \033[m" << "\n";
+    fixed_stack<int, 4> bounded;
+    try {
+        bounded.push_range(std::array{ 1, 2, 3, 4, 5 });
+    }
+    catch (const std::length_error& error) {
+        std::cout << "Caught std::length_error -> " << error.what() << ", size() -> " << bounded.size() << "\n";
+    }
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,204 @@
+/*****************************************************************//**
+ * \file   qtest_stack.cpp
+ * \brief  stack<> and fixed_stack<> test cases with QTest framework.
+ *
+ * Mirrors "../../DataStructures/Stack/qtest_stdstack.cpp" so both
+ * adaptors are held to the same construction and comparison semantics
+ * as std::stack.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <compare>
+#include <deque>
+#include <forward_list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+#include <QString>
+
+#include <stack.hpp>
+
+class TestStack : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestStack() : is(init_vec), is_copy(is) {}
+    void initTestCase()
+    {
+        // make sure private data member are initialized
+        QVERIFY2(is.size() == 5, "Private data member constructed from init_vec is not initalized properly");
+        QVERIFY2(is_copy.size() == 5, "Private data member copy constructed is not initalized properly");
+    }
+    void cleanupTestCase() {}
+
+private slots:
+    void miscStackObjectConstruction() const;
+    void spaceshipComparator() const;
+    void lessThanAndLessThanEqualsOperator() const;
+    void emplaceAndPushRange() const;
+    void fixedCapacityStack() const;
+    void emptyStackThrows() const;
+
+private:
+    const LinearVector<int> init_vec = make_init_vec();
+    util::data_structure::stack<int> is;
+    util::data_structure::stack<int> is_copy;
+
+    static LinearVector<int> make_init_vec()
+    {
+        LinearVector<int> vec;
+        for (const int value : { 5, 4, 3, 2, 1 }) {
+            vec.push_back(value);
+        }
+        return vec;
+    }
+};
+
+void TestStack::miscStackObjectConstruction() const
+{
+    using util::data_structure::stack;
+
+    qDebug() << "Default constructor";
+    stack<int> is;
+    QVERIFY(is.empty() == true);
+    QCOMPARE_EQ(is.size(), 0);
+
+    qDebug() << "Initialization from container iterator";
+    const std::initializer_list<int> init_list = { 5, 4, 3, 2, 1 };
+    stack<int> is2{ init_list.begin(), init_list.end() };
+    QVERIFY(init_list.size() == 5 && is2.size() == 5);
+    QVERIFY(is2.top() == 1);
+
+    qDebug() << "Initialization from LinearVector";
+    stack<int> is3(this->init_vec);
+    QVERIFY(this->init_vec.size() == 5 && is3.size() == 5);
+    QVERIFY(is3.top() == 1);
+
+    qDebug() << "Copy constructor and equality comparator";
+    const stack<int> is4(is3);
+    QVERIFY(is3 == is4);
+
+    qDebug() << "Move constructor leaves the source empty";
+    const stack<int> is5(std::move(is3));
+    QVERIFY(is5 == is4);
+    QVERIFY(is3.empty());
+
+    return;
+}
+
+void TestStack::spaceshipComparator() const
+{
+    // <=> operator returns the std::strong_ordering of the LinearVector<int>
+    qDebug() << "Calling <=> spaceship comparator";
+    QVERIFY((is <=> is_copy) == std::strong_ordering::equal);
+
+    util::data_structure::stack<int> greater(is);
+    greater.top() = 2;
+    QVERIFY((is <=> greater) == std::strong_ordering::less);
+
+    return;
+}
+
+void TestStack::lessThanAndLessThanEqualsOperator() const
+{
+    util::data_structure::stack<int> mutable_is(this->is);
+    QVERIFY(!mutable_is.empty());
+    QVERIFY(mutable_is.top() == 1);
+    mutable_is.pop();
+
+    qDebug() << "Calling less-than operator";
+    QVERIFY(mutable_is < is);
+    QCOMPARE(is < mutable_is, false);
+
+    qDebug() << "Calling less-than-or-equals-to operator";
+    QVERIFY(mutable_is <= is); // less-than
+    mutable_is.push(1);
+    QVERIFY(mutable_is <= is); // equality
+
+    return;
+}
+
+void TestStack::emplaceAndPushRange() const
+{
+    using util::data_structure::stack;
+
+    qDebug() << "Emplace constructs the top element in place";
+    stack<std::pair<int, std::string>> ps;
+    std::pair<int, std::string>& top = ps.emplace(1, "one");
+    QVERIFY(&top == &ps.top());
+    QCOMPARE(ps.top().second, std::string("one"));
+
+    qDebug() << "Push a sized range, its last element ends up on top";
+    stack<int> is;
+    is.push(0);
+    is.push_range(std::vector<int>{ 1, 2, 3 });
+    QCOMPARE_EQ(is.size(), 4);
+    QCOMPARE_EQ(is.top(), 3);
+
+    qDebug() << "Push a forward range of unknown size";
+    const std::forward_list<int> list = { 4, 5 };
+    is.push_range(list);
+    QCOMPARE_EQ(is.size(), 6);
+    QCOMPARE_EQ(is.top(), 5);
+
+    qDebug() << "Push a range onto a container without reserve, std::deque as in std::stack";
+    stack<int, std::deque<int>> ds;
+    ds.push_range(std::vector<int>{ 1, 2, 3 });
+    ds.push_range(list);
+    QCOMPARE_EQ(ds.size(), 5);
+    QCOMPARE_EQ(ds.top(), 5);
+
+    return;
+}
+
+void TestStack::fixedCapacityStack() const
+{
+    using util::data_structure::fixed_stack;
+
+    qDebug() << "Fixed capacity stack stores its elements inline";
+    fixed_stack<int, 4> fs;
+    QCOMPARE_EQ(fs.size(), 0);
+    QVERIFY(sizeof(fs) >= 4 * sizeof(int));
+    fs.push_range(std::vector<int>{ 1, 2, 3 });
+    fs.push(4);
+    QCOMPARE_EQ(fs.top(), 4);
+
+    qDebug() << "Pushing onto a full stack throws std::length_error";
+    QVERIFY_THROWS_EXCEPTION(std::length_error, fs.push(5));
+    QCOMPARE_EQ(fs.size(), 4);
+
+    qDebug() << "A range that does not fit is rejected before any push";
+    fixed_stack<int, 4> partial;
+    partial.push(0);
+    QVERIFY_THROWS_EXCEPTION(std::length_error, partial.push_range(std::vector<int>{ 1, 2, 3, 4 }));
+    QCOMPARE_EQ(partial.size(), 1);
+
+    qDebug() << "Comparisons of fixed capacity stacks";
+    fixed_stack<int, 4> copy(fs);
+    QVERIFY(copy == fs);
+    copy.pop();
+    QVERIFY(copy < fs);
+    QVERIFY((fs <=> copy) == std::strong_ordering::greater);
+
+    return;
+}
+
+void TestStack::emptyStackThrows() const
+{
+    util::data_structure::stack<int> is;
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, is.top());
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, is.pop());
+
+    return;
+}
+
+QTEST_MAIN(TestStack)
+#include "qtest_stack.moc"
@@ -0,0 +1,121 @@
+/*****************************************************************//**
+ * \file   stack.hpp
+ * \brief  Contiguous stack adaptor on LinearVector.
+ *
+ * Same interface and comparisons as std::stack, but the elements live in
+ * one contiguous block: push and pop touch the end of a LinearVector
+ * instead of the chunk map of a std::deque. fixed_stack keeps at most N
+ * elements inline, in the stack object itself, and never allocates.
+ *
+ * Consider "../../DataStructures/Stack/qtest_stdstack.cpp"
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef STACK_HPP
+#define STACK_HPP
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "../LinearVector/linear_vector.hpp"
+
+namespace util::data_structure {
+
+template<typename _Elem, typename _Container = LinearVector<_Elem>>
+class stack {
+public:
+    using container_type = _Container;
+    using value_type = typename _Container::value_type;
+    using size_type = typename _Container::size_type;
+    using reference = typename _Container::reference;
+    using const_reference = typename _Container::const_reference;
+
+    /* default constructor */
+    stack() = default;
+
+    /* initialization from a container, bottom element first */
+    explicit stack(const _Container& cont) : c(cont) {}
+    explicit stack(_Container&& cont) : c(std::move(cont)) {}
+
+    /* initialization from an iterator pair, bottom element first */
+    template<std::input_iterator _InputIt, std::sentinel_for<_InputIt> _Sentinel>
+    stack(_InputIt first, _Sentinel last) {
+        push_range(std::ranges::subrange(std::move(first), std::move(last)));
+    }
+
+    /* element access, throws std::out_of_range on an empty stack */
+    reference top() { return c.back(); }
+    const_reference top() const { return c.back(); }
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return c.empty(); }
+    size_type size() const { return c.size(); }
+
+    /* modifiers */
+    void push(const value_type& value) { c.push_back(value); }
+    void push(value_type&& value) { c.push_back(std::move(value)); }
+
+    /* construct the new top element in place */
+    template<typename... _Args>
+    decltype(auto) emplace(_Args&&... args) {
+        return c.emplace_back(std::forward<_Args>(args)...);
+    }
+
+    /* push every element of the range in order, so its last element ends up on top */
+    template<std::ranges::input_range _Range>
+    requires std::convertible_to<std::ranges::range_reference_t<_Range>, value_type>
+    void push_range(_Range&& range) {
+        /* one allocation for a sized range, or length_error before any push on a fixed stack;
+         * containers without reserve, such as std::deque, grow as they go */
+        if constexpr ((std::ranges::sized_range<_Range> || std::ranges::forward_range<_Range>)
+                      && requires { c.reserve(size_type{}); }) {
+            c.reserve(c.size() + static_cast<size_type>(std::ranges::distance(range)));
+        }
+        for (auto&& value : range) {
+            c.emplace_back(std::forward<decltype(value)>(value));
+        }
+        return;
+    }
+
+    /* remove the top element, throws std::out_of_range on an empty stack */
+    void pop() { c.pop_back(); }
+
+    void swap(stack& other) noexcept(std::is_nothrow_swappable_v<_Container>) {
+        using std::swap;
+        swap(c, other.c);
+        return;
+    }
+
+    /* comparisons of the underlying containers, bottom element first */
+    friend bool operator == (const stack& lhs, const stack& rhs) { return lhs.c == rhs.c; }
+
+    /* <, <=, > and >= are rewritten in terms of <=> */
+    friend auto operator <=> (const stack& lhs, const stack& rhs)
+    requires std::three_way_comparable<_Container> {
+        return lhs.c <=> rhs.c;
+    }
+
+protected:
+    _Container c;
+};
+
+/* stack of at most _Capacity elements on inline storage, push throws std::length_error when full */
+template<typename _Elem, std::size_t _Capacity>
+using fixed_stack = stack<_Elem, FixedLinearVector<_Elem, _Capacity>>;
+
+template<typename _Elem, typename _Container>
+void swap(stack<_Elem, _Container>& lhs, stack<_Elem, _Container>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+    return;
+}
+
+} // namespace util::data_structure
+
+#endif // STACK_HPP
@@ -0,0 +1,62 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Structure-of-arrays container test cases.
+ *
+ * The CPerson records of "../../DataStructures/HashTable/main.c" kept
+ * column by column: an average age computed over the age column alone,
+ * then one person looked up, edited and removed row by row.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <stdlib.h>
+
+#include <soa_vector.hpp>
+#include "../../DataStructures/HashTable/person.h"
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+
+    /* ---------------------------------------------- */
+    /* testing push_back of whole records             */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mStoring 10000 CPerson records column by column \033[m" << "\n";
+    soa_vector<CPerson, &CPerson::name, &CPerson::age> people;
+    people.reserve(10000);
+    for (int i = 0; i < 10000; ++i) {
+        CPerson person{};
+        std::snprintf(person.name, MAX_NAME, "person %d", i);
+        person.age = 18 + i % 70;
+        people.push_back(person);
+    }
+    std::cout << "rows: " << people.size() << ", bytes per record: " << sizeof(CPerson)
+              << ", bytes per age: " << sizeof(people.column<&CPerson::age>()[0]) << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing a scan over one column                 */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mAverage age from the age column alone \033[m" << "\n";
+    const auto ages = people.column<&CPerson::age>();
+    const long total = std::accumulate(ages.begin(), ages.end(), 0L);
+    std::cout << "average age: " << static_cast<double>(total) / static_cast<double>(ages.size()) << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing rows                                   */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mEditing and removing a row \033[m" << "\n";
+    const auto row = people[42];
+    std::cout << row.get<&CPerson::name>().data() << " is " << row.get<&CPerson::age>() << "\n";
+    row.get<&CPerson::age>() += 1;
+    const CPerson copy = people.record(42);
+    std::cout << copy.name << " is now " << copy.age << "\n";
+    people.erase(42);
+    std::cout << "row 42 is now " << people[42].get<&CPerson::name>().data() << ", rows: " << people.size() << "\n";
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
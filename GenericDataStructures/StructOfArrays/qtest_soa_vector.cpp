@@ -0,0 +1,197 @@
+/*****************************************************************//**
+ * \file   qtest_soa_vector.cpp
+ * \brief  soa_vector<> test cases with QTest framework.
+ *
+ * Records are kept in a std::vector alongside the soa_vector, and every
+ * column is compared with the matching member of the records after
+ * pushes, erases and writes through rows, including a member whose copy
+ * throws halfway through appending a row.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include <soa_vector.hpp>
+#include "../../DataStructures/HashTable/person.h"
+
+class TestSoaVector : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    void columnsFollowRecords() const;
+    void rowsReadAndWrite() const;
+    void eraseKeepsColumnsAligned() const;
+    void throwingMemberLeavesColumnsAligned() const;
+    void outOfRangeThrows() const;
+
+private:
+    using people_type = util::data_structure::soa_vector<CPerson, &CPerson::name, &CPerson::age>;
+
+    static CPerson make_person(const int i)
+    {
+        CPerson person{};
+        std::snprintf(person.name, MAX_NAME, "person %d", i);
+        person.age = i % 90;
+        return person;
+    }
+
+    /* whether every column of people holds the members of records, row by row */
+    static bool sameRecords(const people_type& people, const std::vector<CPerson>& records)
+    {
+        const auto names = people.column<&CPerson::name>();
+        const auto ages = people.column<&CPerson::age>();
+        if (names.size() != records.size() || ages.size() != records.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            if (std::string(names[i].data()) != records[i].name || ages[i] != records[i].age) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* a member whose copy throws for negative values */
+    struct Fragile {
+        int value = 0;
+        Fragile() = default;
+        Fragile(const int v) : value(v) {}
+        Fragile(const Fragile& other) : value(other.value) {
+            if (value < 0) {
+                throw std::runtime_error("fragile copy");
+            }
+        }
+        Fragile(Fragile&&) noexcept = default;
+        Fragile& operator = (const Fragile&) = default;
+        Fragile& operator = (Fragile&&) noexcept = default;
+    };
+
+    struct Order {
+        std::string customer;
+        long quantity = 0;
+        Fragile tag;
+    };
+};
+
+void TestSoaVector::columnsFollowRecords() const
+{
+    people_type people;
+    std::vector<CPerson> records;
+    for (int i = 0; i < 1000; ++i) {
+        records.push_back(make_person(i));
+        people.push_back(records.back());
+    }
+
+    qDebug() << "Each member is stored in its own column, in record order";
+    QCOMPARE_EQ(people.size(), 1000);
+    QVERIFY(sameRecords(people, records));
+
+    qDebug() << "An age column is one contiguous span of ints";
+    const auto ages = people.column<&CPerson::age>();
+    QCOMPARE_EQ(ages.size(), 1000);
+    QCOMPARE_EQ(&ages.back() - &ages.front(), 999);
+    const long total = std::accumulate(ages.begin(), ages.end(), 0L);
+    QCOMPARE_EQ(total, std::accumulate(records.begin(), records.end(), 0L,
+                                       [](const long sum, const CPerson& person) { return sum + person.age; }));
+
+    return;
+}
+
+void TestSoaVector::rowsReadAndWrite() const
+{
+    people_type people;
+    for (int i = 0; i < 10; ++i) {
+        people.push_back(make_person(i));
+    }
+
+    qDebug() << "A row reads and writes one member in place";
+    QCOMPARE_EQ(people[3].get<&CPerson::age>(), 3);
+    people[3].get<&CPerson::age>() = 42;
+    QCOMPARE_EQ(people.column<&CPerson::age>()[3], 42);
+
+    qDebug() << "record() copies a row out, assign() writes a record back";
+    const CPerson copy = people.record(7);
+    QCOMPARE_EQ(std::string(copy.name), "person 7");
+    people.row(0).assign(copy);
+    QCOMPARE_EQ(std::string(people[0].record().name), "person 7");
+
+    return;
+}
+
+void TestSoaVector::eraseKeepsColumnsAligned() const
+{
+    people_type people;
+    std::vector<CPerson> records;
+    for (int i = 0; i < 100; ++i) {
+        records.push_back(make_person(i));
+        people.push_back(records.back());
+    }
+
+    qDebug() << "erase() shifts every column";
+    for (const std::size_t index : { 0, 50, 97 }) {
+        people.erase(index);
+        records.erase(records.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+    QVERIFY(sameRecords(people, records));
+
+    qDebug() << "erase_unordered() moves the last row into the hole in every column";
+    people.erase_unordered(10);
+    records[10] = records.back();
+    records.pop_back();
+    QVERIFY(sameRecords(people, records));
+
+    people.pop_back();
+    records.pop_back();
+    QVERIFY(sameRecords(people, records));
+
+    return;
+}
+
+void TestSoaVector::throwingMemberLeavesColumnsAligned() const
+{
+    util::data_structure::soa_vector<Order, &Order::customer, &Order::quantity, &Order::tag> orders;
+    for (int i = 0; i < 20; ++i) {
+        orders.push_back(Order{ "customer " + std::to_string(i), i, Fragile(i) });
+    }
+
+    qDebug() << "The last column throws, the first two are popped again";
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, orders.push_back(Order{ "late", 1, Fragile(-1) }));
+    QCOMPARE_EQ(orders.size(), 20);
+    QCOMPARE_EQ(orders.column<&Order::customer>().size(), 20);
+    QCOMPARE_EQ(orders.column<&Order::quantity>().size(), 20);
+    QCOMPARE_EQ(orders.column<&Order::tag>().size(), 20);
+    QCOMPARE_EQ(orders.record(19).customer, "customer 19");
+
+    return;
+}
+
+void TestSoaVector::outOfRangeThrows() const
+{
+    people_type people;
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, people.pop_back());
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, people.row(0));
+    people.push_back(make_person(1));
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, people.erase(1));
+    QVERIFY_THROWS_EXCEPTION(std::out_of_range, people.record(1));
+
+    return;
+}
+
+QTEST_MAIN(TestSoaVector)
+#include "qtest_soa_vector.moc"
@@ -0,0 +1,327 @@
+/*****************************************************************//**
+ * \file   soa_vector.hpp
+ * \brief  Structure-of-arrays container of records on LinearVector.
+ *
+ * soa_vector<Record, &Record::a, &Record::b, ...> stores the described
+ * members of each record in their own LinearVector column, in record
+ * order, instead of whole records next to each other. A pass that reads
+ * one member then reads only that column: summing the ages of CPerson
+ * records reads 4 bytes per record instead of the 260 of the record, and
+ * column<&Record::member>() hands the column out as a std::span that
+ * loops over it vectorize. A member that is an array, as CPerson::name,
+ * is stored as a std::array of the same elements.
+ *
+ * Rows are read and written through row(i), a view of row i across the
+ * columns, or copied out whole with record(i). push_back and erase change
+ * every column together: if constructing a member throws, the columns
+ * already appended to are popped again, so all keep the same length.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../LinearVector/linear_vector.hpp"
+
+namespace util::data_structure {
+
+namespace detail::soa {
+
+/* the class and member types of a pointer to data member */
+template<typename _Pointer>
+struct member_traits;
+
+template<typename _Class, typename _Member>
+struct member_traits<_Member _Class::*> {
+    using class_type = _Class;
+    using member_type = _Member;
+};
+
+/* how a member is stored in its column: an array T[N] as std::array<T, N>, anything else as itself */
+template<typename _Member>
+struct column_element {
+    using type = _Member;
+};
+
+template<typename _Elem, std::size_t _Extent>
+struct column_element<_Elem[_Extent]> {
+    using type = std::array<_Elem, _Extent>;
+};
+
+template<auto _Lhs, auto _Rhs>
+constexpr bool same_member() {
+    if constexpr (std::is_same_v<decltype(_Lhs), decltype(_Rhs)>) {
+        return _Lhs == _Rhs;
+    }
+    else {
+        return false;
+    }
+}
+
+} // namespace detail::soa
+
+template<typename _Record, auto... _Members>
+requires (sizeof...(_Members) > 0)
+    && (std::is_member_object_pointer_v<decltype(_Members)> && ...)
+    && (std::is_same_v<typename detail::soa::member_traits<decltype(_Members)>::class_type, _Record> && ...)
+class soa_vector {
+public:
+    using record_type = _Record;
+    using size_type = std::size_t;
+
+    static constexpr size_type column_count = sizeof...(_Members);
+
+    /* the element type of the column of _Member */
+    template<auto _Member>
+    using column_type = typename detail::soa::column_element<
+        typename detail::soa::member_traits<decltype(_Member)>::member_type>::type;
+
+    static_assert(((std::is_nothrow_move_constructible_v<column_type<_Members>>
+                    && std::is_nothrow_move_assignable_v<column_type<_Members>>) && ...),
+                  "column elements are shifted by erase and must move without throwing");
+
+    /* a view of one row across the columns, valid until the container is changed */
+    template<bool _Const>
+    class basic_row {
+    public:
+        using owner_type = std::conditional_t<_Const, const soa_vector, soa_vector>;
+
+        /* the member _Member of this row, in its column */
+        template<auto _Member>
+        decltype(auto) get() const {
+            return owner->template column<_Member>()[row_index];
+        }
+
+        size_type index() const { return row_index; }
+
+        /* copy of the whole record */
+        _Record record() const { return owner->record(row_index); }
+
+        /* overwrite the described members of this row with those of record */
+        void assign(const _Record& record) const
+        requires (!_Const) {
+            (store<_Members>(owner->template column<_Members>()[row_index], record.*_Members), ...);
+            return;
+        }
+
+    private:
+        friend class soa_vector;
+
+        basic_row(owner_type* const o, const size_type i) : owner(o), row_index(i) {}
+
+        owner_type* owner;
+        size_type row_index;
+    };
+
+    using row_reference = basic_row<false>;
+    using const_row_reference = basic_row<true>;
+
+    /* default constructor */
+    soa_vector() = default;
+
+    /* capacity */
+    [[nodiscard]] bool empty() const { return size() == 0; }
+    size_type size() const { return std::get<0>(columns).size(); }
+
+    /* make room for n rows in every column */
+    void reserve(const size_type n) {
+        for_each_column([n](auto& column) { column.reserve(n); });
+        return;
+    }
+
+    /* the column of _Member, contiguous and in row order */
+    template<auto _Member>
+    std::span<column_type<_Member>> column() {
+        auto& storage = std::get<column_index<_Member>()>(columns);
+        return { storage.data(), storage.size() };
+    }
+
+    template<auto _Member>
+    std::span<const column_type<_Member>> column() const {
+        const auto& storage = std::get<column_index<_Member>()>(columns);
+        return { storage.data(), storage.size() };
+    }
+
+    /* row access, throws std::out_of_range past the last row */
+    row_reference row(const size_type index) { return row_reference(this, checked(index)); }
+    const_row_reference row(const size_type index) const { return const_row_reference(this, checked(index)); }
+
+    row_reference operator [] (const size_type index) { return row(index); }
+    const_row_reference operator [] (const size_type index) const { return row(index); }
+
+    /* a record with the members of row index; members not described are value-initialized */
+    _Record record(const size_type index) const
+    requires std::default_initializable<_Record> {
+        checked(index);
+        _Record result{};
+        (load<_Members>(result.*_Members, std::get<column_index<_Members>()>(columns).data()[index]), ...);
+        return result;
+    }
+
+    /* modifiers */
+    void push_back(const _Record& record) {
+        emplace_back(record.*_Members...);
+        return;
+    }
+
+    /*
+     * Append a row from one argument per column, in the order the members
+     * are described: every column makes room first, then each constructs
+     * its element, and a throw pops the elements constructed so far.
+     */
+    template<typename... _Fields>
+    requires (sizeof...(_Fields) == column_count)
+    void emplace_back(_Fields&&... fields) {
+        grow_for(size() + 1);
+        append(std::make_index_sequence<column_count>{}, std::forward<_Fields>(fields)...);
+        return;
+    }
+
+    /* remove the last row, throws std::out_of_range if there is none */
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("soa_vector is empty");
+        }
+        for_each_column([](auto& column) { column.pop_back(); });
+        return;
+    }
+
+    /* remove row index, shifting the rows after it, O(n) */
+    void erase(const size_type index) {
+        checked(index);
+        for_each_column([index](auto& column) {
+            std::move(column.begin() + index + 1, column.end(), column.begin() + index);
+            column.pop_back();
+        });
+        return;
+    }
+
+    /* remove row index by moving the last row into its place, O(1) but the row order changes */
+    void erase_unordered(const size_type index) {
+        checked(index);
+        for_each_column([index](auto& column) {
+            if (index + 1 != column.size()) {
+                column.data()[index] = std::move(column.data()[column.size() - 1]);
+            }
+            column.pop_back();
+        });
+        return;
+    }
+
+    void clear() {
+        for_each_column([](auto& column) { column.clear(); });
+        return;
+    }
+
+    void swap(soa_vector& other) noexcept {
+        using std::swap;
+        swap(columns, other.columns);
+        return;
+    }
+
+    friend void swap(soa_vector& lhs, soa_vector& rhs) noexcept { lhs.swap(rhs); }
+
+private:
+    std::tuple<LinearVector<column_type<_Members>>...> columns;
+
+    /* position of _Member among the described members */
+    template<auto _Member>
+    static constexpr size_type column_index() {
+        constexpr std::array<bool, column_count> matches = { detail::soa::same_member<_Member, _Members>()... };
+        constexpr size_type index = static_cast<size_type>(std::find(matches.begin(), matches.end(), true) - matches.begin());
+        static_assert(index < column_count, "the member is not one of the columns");
+        return index;
+    }
+
+    size_type checked(const size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("row index out of range");
+        }
+        return index;
+    }
+
+    template<typename _Function>
+    void for_each_column(_Function&& function) {
+        std::apply([&](auto&... column) { (function(column), ...); }, columns);
+        return;
+    }
+
+    /* grow every column that is full, doubling so that appends stay amortized O(1) */
+    void grow_for(const size_type n) {
+        for_each_column([n](auto& column) {
+            if (column.capacity() < n) {
+                column.reserve(std::max(n, column.capacity() * 2));
+            }
+        });
+        return;
+    }
+
+    template<std::size_t... _Indices, typename... _Fields>
+    void append(std::index_sequence<_Indices...>, _Fields&&... fields) {
+        size_type appended = 0;
+        try {
+            ((emplace_field(std::get<_Indices>(columns), std::forward<_Fields>(fields)), ++appended), ...);
+        }
+        catch (...) {
+            size_type column = 0;
+            for_each_column([&](auto& storage) {
+                if (column++ < appended) {
+                    storage.pop_back();
+                }
+            });
+            throw;
+        }
+        return;
+    }
+
+    /* an array member is copied element by element into the std::array of its column */
+    template<typename _Elem, typename _Field>
+    static void emplace_field(LinearVector<_Elem>& column, _Field&& field) {
+        if constexpr (std::is_array_v<std::remove_reference_t<_Field>>) {
+            _Elem& element = column.emplace_back();
+            std::copy(std::begin(field), std::end(field), element.begin());
+        }
+        else {
+            column.emplace_back(std::forward<_Field>(field));
+        }
+        return;
+    }
+
+    template<auto _Member, typename _Field>
+    static void store(column_type<_Member>& element, const _Field& field) {
+        if constexpr (std::is_array_v<_Field>) {
+            std::copy(std::begin(field), std::end(field), element.begin());
+        }
+        else {
+            element = field;
+        }
+        return;
+    }
+
+    template<auto _Member, typename _Field>
+    static void load(_Field& field, const column_type<_Member>& element) {
+        if constexpr (std::is_array_v<_Field>) {
+            std::copy(element.begin(), element.end(), std::begin(field));
+        }
+        else {
+            field = element;
+        }
+        return;
+    }
+};
+
+} // namespace util::data_structure
+
+#endif // SOA_VECTOR_HPP
@@ -0,0 +1,61 @@
+/*****************************************************************//**
+ * \file   main.cpp
+ * \brief  Timer wheel test cases.
+ *
+ * Request timeouts that are cancelled when the reply arrives, and a
+ * heartbeat that re-arms itself from its own callback.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+
+#include <timer_wheel.hpp>
+
+auto main(void) -> int {
+    using namespace util::data_structure;
+    using wheel_type = timer_wheel<>;
+
+    /* timers outlive the wheel they are scheduled on */
+    std::array<wheel_type::timer, 4> requests;
+    wheel_type::timer heartbeat;
+    wheel_type wheel;
+
+    /* ---------------------------------------------- */
+    /* testing schedule() and cancel() of timeouts    */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mRequest timeouts, two replies arrive in time \033[m" << "\n";
+    const std::array<std::uint64_t, 4> timeouts = { 30, 5000, 120, 300000 };
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        wheel.schedule(requests[i], timeouts[i], [&wheel, i] {
+            std::cout << "request " << i << " timed out at tick " << wheel.now() << "\n";
+        });
+    }
+    std::cout << "cancel request 1: " << std::boolalpha << wheel.cancel(requests[1]) << "\n";
+    std::cout << "cancel request 1 again: " << wheel.cancel(requests[1]) << "\n";
+
+    /* ---------------------------------------------- */
+    /* testing a timer re-armed from its own callback */
+    /* ---------------------------------------------- */
+    std::cout << "\033[32mHeartbeat every 100 ticks \033[m" << "\n";
+    int beats = 0;
+    wheel.schedule(heartbeat, 100, [&] {
+        std::cout << "heartbeat " << ++beats << " at tick " << wheel.now() << "\n";
+        if (beats < 3) {
+            wheel.schedule(heartbeat, 100);
+        }
+    });
+
+    std::cout << "advance 250 ticks, " << wheel.advance(250) << " callbacks run" << "\n";
+    wheel.cancel(requests[0]);
+    std::cout << "advance 400000 ticks, " << wheel.advance(400000) << " callbacks run" << "\n";
+    std::cout << "timers left: " << wheel.size() << "\n";
+
+    system("pause");
+    return EXIT_SUCCESS;
+}
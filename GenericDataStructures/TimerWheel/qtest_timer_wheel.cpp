@@ -0,0 +1,214 @@
+/*****************************************************************//**
+ * \file   qtest_timer_wheel.cpp
+ * \brief  timer_wheel<> test cases with QTest framework.
+ *
+ * Random schedules, cancels and advances are checked against the tick
+ * each timer is expected to expire on, for wheels small enough that
+ * cascades and the overflow list are exercised all the time.
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#include <iostream>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <QTest>
+#include <QDebug>
+
+#include <timer_wheel.hpp>
+
+class TestTimerWheel : public QObject
+{
+    Q_OBJECT
+
+public:
+    void initTestCase() {}
+    void cleanupTestCase() {}
+
+private slots:
+    void expiresOnScheduledTick() const;
+    void cancelIsIdempotent() const;
+    void rearmFromCallback() const;
+    void sameTickRunsInScheduleOrder() const;
+    void destructorUnlinksTimers() const;
+
+private:
+    /* random operations on a wheel, comparing every expiry with the tick it is due */
+    template<std::size_t _LevelBits, std::size_t _Levels>
+    static bool matchesExpectedTicks(unsigned seed, std::uint64_t max_delay);
+};
+
+template<std::size_t _LevelBits, std::size_t _Levels>
+bool TestTimerWheel::matchesExpectedTicks(const unsigned seed, const std::uint64_t max_delay)
+{
+    using wheel_type = util::data_structure::timer_wheel<std::function<void()>, _LevelBits, _Levels>;
+    constexpr std::size_t count = 500;
+
+    std::vector<typename wheel_type::timer> timers(count);
+    wheel_type wheel(seed * 7);
+    std::mt19937_64 engine(seed);
+    /* the tick each timer is due, or -1 when it is not scheduled */
+    std::vector<std::int64_t> due(count, -1);
+    std::vector<std::pair<std::uint64_t, std::size_t>> fired;
+
+    for (int step = 0; step < 20000; ++step) {
+        const std::size_t i = engine() % count;
+        switch (engine() % 4) {
+        case 0: {
+            const std::uint64_t delay = engine() % max_delay;
+            wheel.schedule(timers[i], delay, [&wheel, &fired, i] { fired.emplace_back(wheel.now(), i); });
+            due[i] = static_cast<std::int64_t>(wheel.now() + (delay == 0 ? 1 : delay));
+            break;
+        }
+        case 1:
+            if (wheel.cancel(timers[i]) != (due[i] >= 0)) {
+                return false;
+            }
+            due[i] = -1;
+            break;
+        default: {
+            const std::uint64_t from = wheel.now();
+            fired.clear();
+            wheel.advance(engine() % 8);
+            for (const auto& [when, id] : fired) {
+                if (static_cast<std::int64_t>(when) != due[id] || when <= from) {
+                    return false;
+                }
+                due[id] = -1;
+            }
+            for (std::size_t k = 0; k < count; ++k) {
+                if (due[k] >= 0 && due[k] <= static_cast<std::int64_t>(wheel.now())) {
+                    return false;
+                }
+            }
+            break;
+        }
+        }
+        std::size_t scheduled = 0;
+        for (std::size_t k = 0; k < count; ++k) {
+            scheduled += due[k] >= 0;
+            if (wheel_type::scheduled(timers[k]) != (due[k] >= 0)) {
+                return false;
+            }
+        }
+        if (scheduled != wheel.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TestTimerWheel::expiresOnScheduledTick() const
+{
+    qDebug() << "2 levels of 4 slots, delays mostly in the overflow list";
+    QVERIFY((matchesExpectedTicks<2, 2>(1, 100)));
+    QVERIFY((matchesExpectedTicks<2, 2>(2, 100)));
+
+    qDebug() << "3 levels of 2 slots";
+    QVERIFY((matchesExpectedTicks<1, 3>(3, 40)));
+
+    qDebug() << "Default 6 levels of 64 slots";
+    QVERIFY((matchesExpectedTicks<6, 6>(4, 5000)));
+
+    return;
+}
+
+void TestTimerWheel::cancelIsIdempotent() const
+{
+    using wheel_type = util::data_structure::timer_wheel<>;
+
+    wheel_type::timer timer;
+    wheel_type wheel;
+    bool ran = false;
+
+    qDebug() << "A cancelled timer never runs";
+    wheel.schedule(timer, 10, [&ran] { ran = true; });
+    QVERIFY(wheel_type::scheduled(timer));
+    QVERIFY(wheel.cancel(timer));
+    QVERIFY(!wheel.cancel(timer));
+    QVERIFY(!wheel_type::scheduled(timer));
+    QCOMPARE_EQ(wheel.advance(20), 0);
+    QVERIFY(!ran);
+
+    qDebug() << "An expired timer cannot be cancelled";
+    wheel.schedule(timer, 0, [&ran] { ran = true; });
+    QCOMPARE_EQ(wheel.advance(), 1);
+    QVERIFY(ran);
+    QVERIFY(!wheel.cancel(timer));
+    QVERIFY(wheel.empty());
+
+    return;
+}
+
+void TestTimerWheel::rearmFromCallback() const
+{
+    using wheel_type = util::data_structure::timer_wheel<std::function<void()>, 2, 2>;
+
+    wheel_type::timer timer;
+    wheel_type wheel;
+    std::vector<std::uint64_t> ticks;
+
+    qDebug() << "A periodic timer re-arms itself, also beyond the last level";
+    wheel.schedule(timer, 7, [&] {
+        ticks.push_back(wheel.now());
+        if (ticks.size() < 4) {
+            wheel.schedule(timer, ticks.size() * 20);
+        }
+    });
+    QCOMPARE_EQ(wheel.advance(1000), 4);
+    QVERIFY((ticks == std::vector<std::uint64_t>{ 7, 27, 67, 127 }));
+    QVERIFY(wheel.empty());
+
+    qDebug() << "Schedule on a scheduled timer moves it";
+    wheel.schedule(timer, 50);
+    wheel.schedule(timer, 5);
+    QCOMPARE_EQ(wheel.size(), 1);
+    QCOMPARE_EQ(wheel.advance(5), 1);
+
+    return;
+}
+
+void TestTimerWheel::sameTickRunsInScheduleOrder() const
+{
+    using wheel_type = util::data_structure::timer_wheel<std::function<void()>, 3, 2>;
+
+    std::vector<wheel_type::timer> timers(4);
+    wheel_type wheel;
+    std::vector<int> order;
+
+    qDebug() << "Timers due on one tick run in the order they were scheduled";
+    /* the first two start above the last level and cascade down twice */
+    wheel.schedule(timers[0], 100, [&order] { order.push_back(0); });
+    wheel.advance(10);
+    wheel.schedule(timers[1], 90, [&order] { order.push_back(1); });
+    wheel.advance(60);
+    wheel.schedule(timers[2], 30, [&order] { order.push_back(2); });
+    wheel.advance(25);
+    wheel.schedule(timers[3], 5, [&order] { order.push_back(3); });
+    QCOMPARE_EQ(wheel.advance(5), 4);
+    QVERIFY((order == std::vector<int>{ 0, 1, 2, 3 }));
+
+    return;
+}
+
+void TestTimerWheel::destructorUnlinksTimers() const
+{
+    using wheel_type = util::data_structure::timer_wheel<>;
+
+    wheel_type::timer timer;
+    {
+        wheel_type wheel;
+        wheel.schedule(timer, 1000000, [] {});
+    }
+    QVERIFY(!wheel_type::scheduled(timer));
+
+    return;
+}
+
+QTEST_MAIN(TestTimerWheel)
+#include "qtest_timer_wheel.moc"
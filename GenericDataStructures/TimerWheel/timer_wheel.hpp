@@ -0,0 +1,232 @@
+/*****************************************************************//**
+ * \file   timer_wheel.hpp
+ * \brief  Hierarchical timing wheel on intrusive doubly linked lists.
+ *
+ * Every timer is a denode owned by the caller, so scheduling never
+ * allocates, and every bucket of the wheel is a ring of such denodes
+ * closed by a sentinel: scheduling links a timer before the sentinel and
+ * cancelling unlinks it, both in O(1) regardless of how many are active.
+ *
+ * Level l has 2^LevelBits slots of 2^(LevelBits * l) ticks each. A timer
+ * goes to the lowest level whose slot still separates its expiry from the
+ * current tick: the level of the highest bit in which they differ. When
+ * the current tick crosses into the span of a higher-level slot, that
+ * slot's timers cascade to lower levels; when it reaches a level-0 slot,
+ * all of its timers expire together. Expiries beyond the last level wait
+ * in an overflow list that is redistributed whenever the top level wraps.
+ *
+ * Consider "../DoubleLinkedList/denode.hpp"
+ *
+ * \author Xuhua Huang
+ * \date   October 19, 2026
+ *********************************************************************/
+
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "../DoubleLinkedList/denode.hpp"
+
+namespace util::data_structure {
+
+/* what a timer carries: the tick it expires on and what to run then */
+template<typename _Callback>
+struct timer_entry {
+    std::uint64_t expiry = 0;
+    _Callback callback{};
+};
+
+template<typename _Callback = std::function<void()>, std::size_t _LevelBits = 6, std::size_t _Levels = 6>
+requires (_LevelBits >= 1 && _Levels >= 1 && _LevelBits * _Levels < 64)
+class timer_wheel final {
+public:
+    using callback_type = _Callback;
+    using entry_type = timer_entry<_Callback>;
+
+    /* a timer lives in the caller's storage and must outlive its schedule */
+    using timer = denode<entry_type>;
+
+    static constexpr std::size_t slot_count = std::size_t{ 1 } << _LevelBits;
+    static constexpr std::size_t level_count = _Levels;
+
+    explicit timer_wheel(const std::uint64_t start = 0) : current(start) {
+        for (timer& bucket : buckets) {
+            close(bucket);
+        }
+        close(overflow);
+    }
+
+    timer_wheel(const timer_wheel&) = delete;
+    timer_wheel& operator = (const timer_wheel&) = delete;
+
+    /* unlinks the timers still scheduled, so they do not point into a destroyed wheel */
+    ~timer_wheel() {
+        for (timer& bucket : buckets) {
+            release(bucket);
+        }
+        release(overflow);
+    }
+
+    /* the current tick */
+    std::uint64_t now() const { return current; }
+
+    /* number of scheduled timers */
+    std::size_t size() const { return count; }
+    [[nodiscard]] bool empty() const { return count == 0; }
+
+    /* whether t is scheduled, on this wheel or on another one */
+    static bool scheduled(const timer& t) { return t.linked(); }
+
+    /*
+     * Run callback once delay ticks from now; a delay of 0 counts as 1.
+     * A timer that is already scheduled is re-armed.
+     */
+    void schedule(timer& t, const std::uint64_t delay, callback_type callback) {
+        t.value().callback = std::move(callback);
+        schedule(t, delay);
+        return;
+    }
+
+    /* re-arm t with the callback it already has, also from inside that callback */
+    void schedule(timer& t, const std::uint64_t delay) {
+        if (t.linked()) {
+            t.unlink();
+            --count;
+        }
+        t.value().expiry = current + (delay == 0 ? 1 : delay);
+        place(t);
+        ++count;
+        return;
+    }
+
+    /* O(1), false if t was not scheduled (already expired or cancelled) */
+    bool cancel(timer& t) noexcept {
+        if (!t.linked()) {
+            return false;
+        }
+        t.unlink();
+        --count;
+        return true;
+    }
+
+    /*
+     * Move the current tick forward by ticks, running the callback of every
+     * timer that expires on the way in expiry order; timers of the same tick
+     * run in the order they were scheduled. Callbacks may schedule and cancel
+     * timers. Returns the number of callbacks run.
+     */
+    std::size_t advance(std::uint64_t ticks = 1) {
+        std::size_t expired = 0;
+        for (; ticks > 0; --ticks) {
+            if (count == 0) {
+                /* nothing to cascade or expire, jump to the end */
+                current += ticks;
+                break;
+            }
+            expired += tick();
+        }
+        return expired;
+    }
+
+private:
+    std::array<timer, slot_count * _Levels> buckets;
+    timer overflow;
+    std::uint64_t current;
+    std::size_t count = 0;
+
+    static constexpr std::uint64_t mask = slot_count - 1;
+
+    /* an empty ring: the sentinel is its own neighbour on both sides */
+    static void close(timer& sentinel) {
+        sentinel.set_next(&sentinel);
+        return;
+    }
+
+    static bool is_empty(const timer& sentinel) { return sentinel.next() == &sentinel; }
+
+    static void release(timer& sentinel) {
+        while (!is_empty(sentinel)) {
+            sentinel.next()->unlink();
+        }
+        sentinel.unlink();
+        return;
+    }
+
+    timer& bucket(const std::size_t level, const std::uint64_t tick) {
+        return buckets[level * slot_count + ((tick >> (_LevelBits * level)) & mask)];
+    }
+
+    /*
+     * Link t at the back of the bucket of the level where its expiry first
+     * differs from now; a timer cascading on its own expiry tick differs in
+     * no bit and goes to the level-0 slot about to expire.
+     */
+    void place(timer& t) {
+        const std::uint64_t expiry = t.value().expiry;
+        const std::size_t level = (static_cast<std::size_t>(std::bit_width((expiry ^ current) | 1)) - 1) / _LevelBits;
+        timer& target = level < _Levels ? bucket(level, expiry) : overflow;
+        target.linear_prepend(&t);
+        return;
+    }
+
+    /* re-place every timer of a bucket relative to the new current tick */
+    void cascade(timer& sentinel) {
+        /* detach the whole ring first: re-placed timers may land in the same bucket (overflow) */
+        if (is_empty(sentinel)) {
+            return;
+        }
+        timer pending;
+        sentinel.prev()->set_next(&pending);
+        pending.set_next(sentinel.next());
+        close(sentinel);
+        while (!is_empty(pending)) {
+            timer& t = *pending.next();
+            t.unlink();
+            place(t);
+        }
+        pending.unlink();
+        return;
+    }
+
+    std::size_t tick() {
+        ++current;
+        /* the bits of the tick that changed tell which higher-level slots were entered */
+        const std::uint64_t changed = (current - 1) ^ current;
+        if ((changed >> _LevelBits) != 0) {
+            /* highest level first, so its timers can still cascade further down this tick */
+            std::size_t level = (static_cast<std::size_t>(std::bit_width(changed)) - 1) / _LevelBits;
+            if (level >= _Levels) {
+                cascade(overflow);
+                level = _Levels - 1;
+            }
+            for (; level > 0; --level) {
+                cascade(bucket(level, current));
+            }
+        }
+
+        /* every timer left in this level-0 slot expires on the current tick */
+        timer& due = bucket(0, current);
+        if (is_empty(due)) {
+            return 0;
+        }
+        std::size_t expired = 0;
+        while (!is_empty(due)) {
+            timer& t = *due.next();
+            t.unlink();
+            --count;
+            ++expired;
+            t.value().callback();
+        }
+        return expired;
+    }
+};
+
+} // namespace util::data_structure
+
+#endif // TIMER_WHEEL_HPP